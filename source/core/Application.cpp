@@ -10,11 +10,23 @@
 #include "Application.h"
 
 #include "Log.h"
+#include "actions/CaptureActions.h"
 #include "actions/FileActions.h"
 #include "event/AppEvent.h"
+#include "parallel/Parallel.h"
+#include "utilities.h"
+#include "views/AcquisitionView.h"
+#include "views/CaptureView.h"
+#include "views/ComputeView.h"
+#include "views/CoroutineView.h"
 #include "views/DemoView.h"
 #include "views/FirstView.h"
+#include "views/FrameRateView.h"
+#include "views/JobsView.h"
+#include "views/ReferenceView.h"
 #include "views/SecondView.h"
+#include "views/TextView.h"
+#include "views/ViewportView.h"
 
 
 namespace mvi::core {
@@ -27,16 +39,64 @@ Application::Application() {
 	m_mainWindow.init();
 	if (m_state == State::Error)
 		return;
-	// Create views
-	const auto scdV = std::make_shared<views::SecondView>();
-	scdV->hide();
-	const auto dmoV = std::make_shared<views::DemoView>();
-	m_views.push_back(std::make_shared<views::FirstView>(dmoV->visibility(), scdV->visibility(), m_clearColor));
-	m_views.push_back(scdV);
-	m_views.push_back(dmoV);
+	// Fixed rate ticks
+	const auto settings = getSettings();
+	m_scheduler.setConfig({.tickRate = settings->getValue<double>("scheduler/tick_rate", 120.0),
+						   .maxSteps = static_cast<uint32_t>(settings->getValue<int>("scheduler/max_steps", 8))});
+	// Frame rate caps
+	m_governor.setConfig({.caps = {settings->getValue<double>("frame_rate/focused_fps", 0.0),
+								   settings->getValue<double>("frame_rate/unfocused_fps", 30.0),
+								   settings->getValue<double>("frame_rate/occluded_fps", 20.0),
+								   settings->getValue<double>("frame_rate/iconified_fps", 20.0)}});
+	// Worker threads, posting to the main thread
+	m_dispatcher.setWakeFunction([]() -> void { MainWindow::wake(); });
+	m_jobs = std::make_unique<jobs::JobSystem>(jobs::JobSystem::Config{
+			.workers = static_cast<uint32_t>(settings->getValue<int>("jobs/workers", 0)),
+			.ioWorkers = static_cast<uint32_t>(settings->getValue<int>("jobs/io_workers", 1))});
+	parallel::setJobSystem(m_jobs.get());
+	m_coroutines = std::make_unique<coro::Scheduler>(m_dispatcher, *m_jobs);
+	// Register views, built on their first show
+	m_viewRegistry.setDestroyDelay(settings->getValue<double>("views/destroy_delay", 60.0));
+	m_viewRegistry.registerView(
+			"first_view", [this]() -> std::shared_ptr<views::View> {
+				return std::make_shared<views::FirstView>(m_clearColor);
+			},
+			{.label = "", .shown = true, .keepAlive = true});
+	m_viewRegistry.registerView<views::DemoView>("demo_view",
+												 {.label = "Demo Window", .shown = true, .keepAlive = false});
+	m_viewRegistry.registerView<views::SecondView>("second_view",
+												   {.label = "Another Window", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::TextView>("text_view",
+												 {.label = "Text Rendering", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::CaptureView>("capture_view",
+													{.label = "Frame Capture", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::ViewportView>(
+			"viewport_view", {.label = "Offscreen Viewport", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::ComputeView>("compute_view",
+													{.label = "GPU Compute", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::ReferenceView>(
+			"reference_view", {.label = "Reference Table", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::AcquisitionView>(
+			"acquisition_view", {.label = "Data Acquisition", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::FrameRateView>(
+			"frame_rate_view", {.label = "Frame Rate Governor", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::JobsView>("jobs_view",
+												 {.label = "Job System", .shown = false, .keepAlive = false});
+	m_viewRegistry.registerView<views::CoroutineView>("coroutine_view",
+													  {.label = "Coroutines", .shown = false, .keepAlive = false});
 	// Create actions
-	m_actions.push_back(std::make_shared<actions::QuitAction>());
-	m_actions.back()->setShortcut({.key = KeyCode::A, .modifiers = {.ctrl = true}});
+	const auto quit = std::make_shared<actions::QuitAction>();
+	quit->setShortcut({.key = KeyCode::A, .modifiers = {.ctrl = true}});
+	m_actionRegistry.add(quit);
+	const auto record = std::make_shared<actions::RecordAction>();
+	record->setShortcut({.key = KeyCode::F12, .modifiers = {.shift = true}});
+	m_actionRegistry.add(record);
+	const auto screenshot = std::make_shared<actions::ScreenshotAction>();
+	screenshot->setShortcut({.key = KeyCode::F12});
+	m_actionRegistry.add(screenshot);
+	const auto drawData = std::make_shared<actions::DrawDataAction>();
+	drawData->setShortcut({.key = KeyCode::F11, .modifiers = {.shift = true}});
+	m_actionRegistry.add(drawData);
 
 	// Set callback for events
 	m_mainWindow.setEventCallback([this]<typename T>(T&& ioEvent) -> auto { onEvent(std::forward<T>(ioEvent)); });
@@ -46,21 +106,66 @@ Application::Application() {
 
 Application::~Application() {
 	log_info("Shutting down application.");
-	// Cleanup
+	// Cleanup, views may hold GPU resources and wait for their jobs
+	m_viewRegistry.clear();
+	parallel::setJobSystem(nullptr);
+	m_jobs.reset();
+	// The coroutines posted back by the jobs are destroyed at their resumption.
+	dispatchPosted();
+	m_coroutines.reset();
+	m_dispatcher.setWakeFunction({});
 	m_mainWindow.close();
 }
 
 void Application::run() {
+	// The startup (window, device, fonts) is not the duration of the first frame.
+	m_scheduler.reset();
 	// Main loop
 	while (m_state == State::Running || m_state == State::Waiting) {
 		if (m_mainWindow.shouldClose()) {
 			m_state = State::Closed;
 			continue;
 		}
+		auto windowState = getWindowState();
+		// Out of focus, wait in GLFW to be woken by the window events and the posts.
+		if (windowState != FrameGovernor::State::Focused) {
+			for (const auto wake = m_governor.getNextFrameTime(windowState); FrameGovernor::clock::now() < wake;) {
+				MainWindow::waitEvents(wake);
+				dispatchPosted();
+				// Back in focus: the focused cap applies at once.
+				if (windowState = getWindowState(); windowState == FrameGovernor::State::Focused)
+					break;
+			}
+		}
+		m_governor.waitForFrame(windowState);
 		m_mainWindow.newFrame();
+		if (m_state != State::Running && m_state != State::Waiting)
+			continue;
+		// Results of the other threads, before the frame uses them.
+		dispatchPosted();
+		// Coroutines waiting for this frame, before the views update.
+		m_coroutines->resumeFrame();
+		// Views shown or hidden during the last frame.
+		m_viewRegistry.update(std::chrono::steady_clock::now());
+		// Fixed rate ticks, also run while waiting so the acquisitions keep sampling.
+		m_scheduler.beginFrame();
+		while (m_scheduler.step()) {
+			event::AppTickEvent tick(m_scheduler.getStepSeconds(), m_scheduler.getTick());
+			broadcast(tick);
+		}
 		if (m_state != State::Running)
 			continue;
-		for (const auto& view: m_views) { view->update(); }
+		event::AppUpdateEvent update(m_scheduler.getFrameSeconds());
+		broadcast(update);
+		// Two phases: the views prepare their data in parallel, then emit their ImGui calls in order.
+		prepareViews();
+		const auto updateStart = std::chrono::steady_clock::now();
+		for (const auto& view: m_viewRegistry.getViews()) { view->update(); }
+		m_frameTimings.updateMs =
+				std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+		++m_frame;
+		event::AppRenderEvent render(m_scheduler.getAlpha());
+		broadcast(render);
 		m_mainWindow.render(m_clearColor);
 	}
 }
@@ -82,14 +187,19 @@ void Application::onEvent(event::Event& ioEvent) {
 		log_trace("Resize Event");
 		return true;
 	});
+	// Focus changes are also for ImGui.
+	dispatcher.dispatch<event::WindowFocusEvent>([this]<typename T>(const T&) -> auto {
+		m_focused = true;
+		return false;
+	});
+	dispatcher.dispatch<event::WindowLostFocusEvent>([this]<typename T>(const T&) -> auto {
+		m_focused = false;
+		return false;
+	});
 	// does any action handle the event?
-	for (const auto& action: m_actions) {
-		if (ioEvent.handled)
-			return;
-		action->onEvent(ioEvent);
-	}
+	m_actionRegistry.onEvent(ioEvent);
 	// does any view handle the event?
-	for (const auto& view: m_views) {
+	for (const auto& view: m_viewRegistry.getViews()) {
 		if (ioEvent.handled)
 			return;
 		view->onEvent(ioEvent);
@@ -97,6 +207,43 @@ void Application::onEvent(event::Event& ioEvent) {
 	m_mainWindow.onEvent(ioEvent);
 }
 
+auto Application::getWindowState() const -> FrameGovernor::State {
+	if (m_mainWindow.isIconified())
+		return FrameGovernor::State::Iconified;
+	if (m_mainWindow.isOccluded())
+		return FrameGovernor::State::Occluded;
+	if (!m_focused && !m_mainWindow.hasFocusedViewport())
+		return FrameGovernor::State::Unfocused;
+	return FrameGovernor::State::Focused;
+}
+
+void Application::dispatchPosted() {
+	m_dispatcher.dispatch([this](event::Event& ioEvent) -> void { onEvent(ioEvent); });
+}
+
+void Application::prepareViews() {
+	const auto start = std::chrono::steady_clock::now();
+	const views::FrameContext context{.frame = m_frame,
+									  .delta = m_scheduler.getFrameSeconds(),
+									  .alpha = m_scheduler.getAlpha(),
+									  .tick = m_scheduler.getTick()};
+	for (const auto& view: m_viewRegistry.getViews()) {
+		if (view->isVisible() && view->scheduleRefresh(context))
+			m_prepareViews.push_back(view.get());
+	}
+	// The main thread takes the next view like the workers, instead of waiting on jobs where it could run any
+	// other one: the phase never lasts longer than preparing all the views on the main thread.
+	parallel::parallelFor(m_prepareViews, [&context](views::View* iView) -> void { iView->prepare(context); }, 1);
+	m_frameTimings.preparedViews = m_prepareViews.size();
+	m_prepareViews.clear();
+	m_frameTimings.prepareMs =
+			std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void Application::broadcast(event::Event& ioEvent) const {
+	for (const auto& view: m_viewRegistry.getViews()) { view->onEvent(ioEvent); }
+}
+
 auto Application::isKeyPressed(const KeyCode& iKeycode) const -> bool { return m_mainWindow.isKeyPressed(iKeycode); }
 auto Application::getModifiers() const -> Modifiers { return m_mainWindow.getModifiers(); }
 
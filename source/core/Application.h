@@ -8,12 +8,17 @@
 
 #pragma once
 
+#include "FrameGovernor.h"
+#include "FrameScheduler.h"
+#include "MainThreadDispatcher.h"
 #include "MainWindow.h"
-#include "actions/Action.h"
+#include "actions/ActionRegistry.h"
+#include "coro/Scheduler.h"
+#include "jobs/JobSystem.h"
 #include "views/View.h"
+#include "views/ViewRegistry.h"
 
 #include <array>
-#include <list>
 #include <memory>
 
 namespace mvi::core {
@@ -101,29 +106,49 @@ public:
 	void requestClose();
 
 	/**
-	 * @brief Get a view by name.
+	 * @brief Get a built view by name.
 	 * @param iName The view name.
-	 * @return The view pointer or nullptr if not found.
-	 */
-	[[nodiscard]] auto getView(const std::string& iName) const -> std::shared_ptr<views::View> {
-		for (const auto& view: m_views) {
-			if (view->getName() == iName)
-				return view;
-		}
-		return nullptr;
+	 * @return The view pointer or nullptr if not built or not found.
+	 */
+	[[nodiscard]] auto getView(const std::string_view iName) const -> std::shared_ptr<views::View> {
+		return m_viewRegistry.get(iName);
+	}
+	/**
+	 * @brief Get a built view by interned name.
+	 * @param iId The interned view name.
+	 * @return The view pointer or nullptr if not built or not found.
+	 */
+	[[nodiscard]] auto getView(const NameId iId) const -> std::shared_ptr<views::View> {
+		return m_viewRegistry.get(iId);
+	}
+	/**
+	 * @brief Get the built views.
+	 * @return The views, in registration order.
+	 */
+	[[nodiscard]] auto getViews() const -> const std::vector<std::shared_ptr<views::View>>& {
+		return m_viewRegistry.getViews();
 	}
+	/**
+	 * @brief Get the view registry.
+	 * @return The view registry.
+	 */
+	[[nodiscard]] auto getViewRegistry() -> views::ViewRegistry& { return m_viewRegistry; }
 
 	/**
 	 * @brief Get an action by name.
 	 * @param iName The action name.
 	 * @return The action pointer or nullptr if not found.
 	 */
-	[[nodiscard]] auto getAction(const std::string& iName) const -> std::shared_ptr<actions::Action> {
-		for (const auto& action: m_actions) {
-			if (action->getName() == iName)
-				return action;
-		}
-		return nullptr;
+	[[nodiscard]] auto getAction(const std::string_view iName) const -> std::shared_ptr<actions::Action> {
+		return m_actionRegistry.get(iName);
+	}
+	/**
+	 * @brief Get an action by interned name.
+	 * @param iId The interned action name.
+	 * @return The action pointer or nullptr if not found.
+	 */
+	[[nodiscard]] auto getAction(const NameId iId) const -> std::shared_ptr<actions::Action> {
+		return m_actionRegistry.get(iId);
 	}
 
 	/**
@@ -145,17 +170,108 @@ public:
 	 */
 	[[nodiscard]] auto getModifiers() const -> Modifiers;
 
+	/**
+	 * @brief Get the main window.
+	 * @return The main window.
+	 */
+	[[nodiscard]] auto getMainWindow() -> MainWindow& { return m_mainWindow; }
+
+	/**
+	 * @brief Get the tick scheduler.
+	 * @return The scheduler.
+	 */
+	[[nodiscard]] auto getScheduler() -> FrameScheduler& { return m_scheduler; }
+
+	/**
+	 * @brief Get the frame rate governor.
+	 * @return The governor.
+	 */
+	[[nodiscard]] auto getGovernor() -> FrameGovernor& { return m_governor; }
+
+	/**
+	 * @brief Get the job system.
+	 * @return The job system.
+	 */
+	[[nodiscard]] auto getJobs() -> jobs::JobSystem& { return *m_jobs; }
+
+	/**
+	 * @brief Get the dispatcher of the tasks and events posted to the main thread.
+	 * @return The dispatcher.
+	 */
+	[[nodiscard]] auto getDispatcher() -> MainThreadDispatcher& { return m_dispatcher; }
+
+	/**
+	 * @brief Get the scheduler of the coroutines.
+	 * @return The coroutine scheduler.
+	 */
+	[[nodiscard]] auto getCoroutines() -> coro::Scheduler& { return *m_coroutines; }
+
+	/**
+	 * @brief Durations of the view phases of the last frame.
+	 */
+	struct FrameTimings {
+		/// Wall time of the parallel preparation, in milliseconds.
+		double prepareMs = 0.0;
+		/// Wall time of the updates, in milliseconds.
+		double updateMs = 0.0;
+		/// Number of prepared views.
+		size_t preparedViews = 0;
+	};
+
+	/**
+	 * @brief Get the durations of the view phases of the last frame.
+	 * @return The durations.
+	 */
+	[[nodiscard]] auto getFrameTimings() const -> const FrameTimings& { return m_frameTimings; }
+
 private:
+	/**
+	 * @brief Get the state of the window, selecting the frame rate cap.
+	 * @return The window state.
+	 */
+	[[nodiscard]] auto getWindowState() const -> FrameGovernor::State;
+	/**
+	 * @brief Send a main loop event to all the views.
+	 * @param[in,out] ioEvent The event.
+	 */
+	void broadcast(event::Event& ioEvent) const;
+	/**
+	 * @brief Run the tasks and send the events posted by the other threads.
+	 */
+	void dispatchPosted();
+	/**
+	 * @brief Prepare the visible views in parallel, and wait for them.
+	 */
+	void prepareViews();
+
 	/// The application Instance.
 	static Application* m_instance;
 	/// The application state.
 	State m_state = State::Created;
 	/// The main window.
 	MainWindow m_mainWindow;
-	//// The views list.
-	std::list<std::shared_ptr<views::View>> m_views;
-	/// The actions list.
-	std::list<std::shared_ptr<actions::Action>> m_actions;
+	/// The tick scheduler.
+	FrameScheduler m_scheduler;
+	/// The frame rate governor.
+	FrameGovernor m_governor;
+	/// The main window has the focus.
+	bool m_focused = true;
+	/// Tasks and events posted to the main thread.
+	MainThreadDispatcher m_dispatcher;
+	/// The job system.
+	std::unique_ptr<jobs::JobSystem> m_jobs;
+	/// The coroutine scheduler.
+	std::unique_ptr<coro::Scheduler> m_coroutines;
+	/// Index of the current frame.
+	uint64_t m_frame = 0;
+	/// Views to prepare in the current frame.
+	std::vector<views::View*> m_prepareViews;
+	/// Durations of the view phases of the last frame.
+	FrameTimings m_frameTimings;
+	/// The views, built on their first show.
+	views::ViewRegistry m_viewRegistry;
+	/// The actions.
+	actions::ActionRegistry m_actionRegistry;
 	/// The clear color.
 	std::array<float, 4> m_clearColor = {0.45f, 0.55f, 0.60f, 1.00f};
 };
@@ -0,0 +1,96 @@
+/**
+ * @file FrameGovernor.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "FrameGovernor.h"
+
+#include "utilities.h"
+
+#ifdef MVI_PLATFORM_WINDOWS
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <ctime>
+#endif
+
+namespace mvi::core {
+
+namespace {
+
+/// Duration of the windows measuring the recent rate and CPU usage, in seconds.
+constexpr double g_measureWindow = 0.5;
+
+/**
+ * @brief Get the CPU time used by the process, all threads together.
+ * @return The CPU time, in seconds.
+ */
+auto processCpuSeconds() -> double {
+#ifdef MVI_PLATFORM_WINDOWS
+	// std::clock() is the wall time with MSVC.
+	FILETIME creation;
+	FILETIME exit;
+	FILETIME kernel;
+	FILETIME user;
+	if (GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user) == 0)
+		return 0.0;
+	const auto ticks = [](const FILETIME& iTime) -> uint64_t {
+		return (static_cast<uint64_t>(iTime.dwHighDateTime) << 32u) | iTime.dwLowDateTime;
+	};
+	// In 100 ns units.
+	return static_cast<double>(ticks(kernel) + ticks(user)) * 1e-7;
+#else
+	timespec time{};
+	if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0)
+		return 0.0;
+	return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+#endif
+}
+
+}// namespace
+
+FrameGovernor::FrameGovernor() : m_cpuStart{processCpuSeconds()} {}
+
+void FrameGovernor::waitForFrame(const State iState) {
+	sleepUntil(getNextFrameTime(iState));
+	account(clock::now());
+	m_state = iState;
+}
+
+auto FrameGovernor::getNextFrameTime(const State iState) const -> clock::time_point {
+	const double cap = m_config.caps[static_cast<size_t>(iState)];
+	if (cap <= 0.0)
+		return m_frameStart;
+	return m_frameStart + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(1.0 / cap));
+}
+
+void FrameGovernor::account(const clock::time_point iNow) {
+	const double cpu = processCpuSeconds();
+	const double elapsed = std::chrono::duration<double>(iNow - m_frameStart).count();
+	const double used = cpu - m_cpuStart;
+	m_frameStart = iNow;
+	m_cpuStart = cpu;
+
+	const auto index = static_cast<size_t>(m_state);
+	auto& stats = m_stats[index];
+	++stats.frames;
+	stats.seconds += elapsed;
+	stats.cpuSeconds += used;
+	auto& window = m_windows[index];
+	++window.frames;
+	window.seconds += elapsed;
+	window.cpuSeconds += used;
+	if (window.seconds >= g_measureWindow) {
+		stats.fps = static_cast<double>(window.frames) / window.seconds;
+		stats.cpuUsage = window.cpuSeconds / window.seconds;
+		window = {};
+	}
+}
+
+}// namespace mvi::core
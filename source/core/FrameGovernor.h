@@ -0,0 +1,140 @@
+/**
+ * @file FrameGovernor.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace mvi::core {
+
+/**
+ * @brief Frame rate limiter, adapting the cap to the window state.
+ *
+ * The main loop is throttled to a target rate depending on the window being focused, unfocused, occluded
+ * or iconified, so a window in the background does not use the CPU and GPU as a foreground one. The time
+ * and the process CPU time spent in each state are accounted to show the achieved rate and CPU usage.
+ */
+class FrameGovernor final {
+public:
+	/// Clock of the governor.
+	using clock = std::chrono::steady_clock;
+
+	/**
+	 * @brief Window states.
+	 */
+	enum class State : uint8_t {
+		Focused,///< The window has the input focus.
+		Unfocused,///< The window is visible without focus.
+		Occluded,///< The window is hidden or without surface.
+		Iconified,///< The window is minimized.
+	};
+	/// Number of window states.
+	static constexpr size_t g_stateCount = 4;
+
+	/**
+	 * @brief Governor configuration.
+	 */
+	struct Config {
+		/// Frame rate caps by state, in frames per second, 0 for no cap.
+		std::array<double, g_stateCount> caps = {0.0, 30.0, 20.0, 20.0};
+	};
+
+	/**
+	 * @brief Statistics of a state.
+	 */
+	struct StateStats {
+		/// Frames run in this state.
+		uint64_t frames = 0;
+		/// Time spent in this state, in seconds.
+		double seconds = 0.0;
+		/// Process CPU time spent in this state, in seconds.
+		double cpuSeconds = 0.0;
+		/// Recently achieved frame rate, in frames per second.
+		double fps = 0.0;
+		/// Recent process CPU usage, 1 for a fully used core.
+		double cpuUsage = 0.0;
+	};
+
+	/**
+	 * @brief Default constructor.
+	 */
+	FrameGovernor();
+
+	/**
+	 * @brief Set the configuration.
+	 * @param[in] iConfig The configuration.
+	 */
+	void setConfig(const Config& iConfig) { m_config = iConfig; }
+	/**
+	 * @brief Get the configuration.
+	 * @return The configuration.
+	 */
+	[[nodiscard]] auto getConfig() const -> const Config& { return m_config; }
+
+	/**
+	 * @brief Wait for the time to start the next frame, according to the cap of the window state.
+	 * @param[in] iState The window state for the next frame.
+	 */
+	void waitForFrame(State iState);
+	/**
+	 * @brief Get the time to start the next frame.
+	 * @param[in] iState The window state for the next frame.
+	 * @return The start time, in the past if already due.
+	 */
+	[[nodiscard]] auto getNextFrameTime(State iState) const -> clock::time_point;
+
+	/**
+	 * @brief Get the current window state.
+	 * @return The window state.
+	 */
+	[[nodiscard]] auto getState() const -> State { return m_state; }
+	/**
+	 * @brief Get the statistics of a state.
+	 * @param[in] iState The window state.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats(const State iState) const -> const StateStats& {
+		return m_stats[static_cast<size_t>(iState)];
+	}
+
+private:
+	/**
+	 * @brief Measurement window of a state.
+	 */
+	struct Window {
+		/// Frames in the window.
+		uint64_t frames = 0;
+		/// Elapsed time in the window, in seconds.
+		double seconds = 0.0;
+		/// Process CPU time in the window, in seconds.
+		double cpuSeconds = 0.0;
+	};
+
+	/**
+	 * @brief Account the last frame to its state.
+	 * @param[in] iNow Start time of the next frame.
+	 */
+	void account(clock::time_point iNow);
+
+	/// The configuration.
+	Config m_config;
+	/// State of the current frame.
+	State m_state = State::Focused;
+	/// Start of the current frame.
+	clock::time_point m_frameStart = clock::now();
+	/// Process CPU time at the start of the current frame, in seconds.
+	double m_cpuStart = 0.0;
+	/// Statistics by state.
+	std::array<StateStats, g_stateCount> m_stats{};
+	/// Measurement windows by state.
+	std::array<Window, g_stateCount> m_windows{};
+};
+
+}// namespace mvi::core
@@ -0,0 +1,61 @@
+/**
+ * @file FrameScheduler.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "FrameScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mvi::core {
+
+FrameScheduler::FrameScheduler() = default;
+
+void FrameScheduler::setConfig(const Config& iConfig) {
+	m_config = iConfig;
+	m_config.tickRate = std::clamp(m_config.tickRate, 1.0, 10000.0);
+	m_config.maxSteps = std::max(m_config.maxSteps, 1u);
+	m_step = 1.0 / m_config.tickRate;
+	m_accumulator = std::min(m_accumulator, m_step);
+}
+
+void FrameScheduler::beginFrame() {
+	const auto now = clock::now();
+	const double elapsed = std::chrono::duration<double>(now - m_last).count();
+	m_last = now;
+	beginFrame(elapsed);
+}
+
+void FrameScheduler::beginFrame(const double iSeconds) {
+	m_frame = iSeconds;
+	m_stats.frameMs = m_frame * 1000.0;
+	m_stats.steps = 0;
+	m_accumulator += m_frame;
+	// Too far behind: run the maximum steps, and drop the rest.
+	if (const double limit = m_step * static_cast<double>(m_config.maxSteps); m_accumulator >= limit + m_step) {
+		const double excess = m_accumulator - limit;
+		m_stats.dropped += static_cast<uint64_t>(std::floor(excess / m_step));
+		m_accumulator = limit + std::fmod(excess, m_step);
+	}
+}
+
+auto FrameScheduler::step() -> bool {
+	if (m_accumulator < m_step || m_stats.steps >= m_config.maxSteps)
+		return false;
+	m_accumulator -= m_step;
+	++m_stats.steps;
+	++m_stats.ticks;
+	return true;
+}
+
+void FrameScheduler::reset() {
+	m_last = clock::now();
+	m_accumulator = 0.0;
+}
+
+}// namespace mvi::core
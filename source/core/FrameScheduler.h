@@ -0,0 +1,129 @@
+/**
+ * @file FrameScheduler.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace mvi::core {
+
+/**
+ * @brief Fixed rate tick scheduler, independent of the rendering rate.
+ *
+ * The real time elapsed between two frames is accumulated, and consumed by steps of a fixed duration:
+ * a frame runs as many ticks as needed to catch up, up to a maximum, the excess time being dropped.
+ * The remaining fraction of a step is the interpolation factor between the last two ticks for the rendering.
+ */
+class FrameScheduler final {
+public:
+	/// Clock of the scheduler.
+	using clock = std::chrono::steady_clock;
+
+	/**
+	 * @brief Scheduler configuration.
+	 */
+	struct Config {
+		/// Ticks per second.
+		double tickRate = 120.0;
+		/// Maximum ticks run by a frame.
+		uint32_t maxSteps = 8;
+	};
+
+	/**
+	 * @brief Scheduler statistics.
+	 */
+	struct Stats {
+		/// Ticks since start.
+		uint64_t ticks = 0;
+		/// Ticks run by the last frame.
+		uint32_t steps = 0;
+		/// Ticks dropped because of the step limit.
+		uint64_t dropped = 0;
+		/// Duration of the last frame, in milliseconds.
+		double frameMs = 0.0;
+	};
+
+	/**
+	 * @brief Default constructor.
+	 */
+	FrameScheduler();
+
+	/**
+	 * @brief Set the configuration.
+	 * @param[in] iConfig The configuration.
+	 */
+	void setConfig(const Config& iConfig);
+	/**
+	 * @brief Get the configuration.
+	 * @return The configuration.
+	 */
+	[[nodiscard]] auto getConfig() const -> const Config& { return m_config; }
+
+	/**
+	 * @brief Accumulate the time elapsed since the previous frame.
+	 */
+	void beginFrame();
+	/**
+	 * @brief Accumulate a given frame duration, instead of the elapsed time.
+	 * @param[in] iSeconds The frame duration, in seconds.
+	 */
+	void beginFrame(double iSeconds);
+	/**
+	 * @brief Consume one step of the accumulated time.
+	 * @return True if a tick is to run.
+	 */
+	auto step() -> bool;
+	/**
+	 * @brief Restart the accumulation, dropping the time elapsed since the previous frame.
+	 */
+	void reset();
+
+	/**
+	 * @brief Get the duration of a tick.
+	 * @return The duration in seconds.
+	 */
+	[[nodiscard]] auto getStepSeconds() const -> double { return m_step; }
+	/**
+	 * @brief Get the index of the last tick.
+	 * @return The tick index.
+	 */
+	[[nodiscard]] auto getTick() const -> uint64_t { return m_stats.ticks; }
+	/**
+	 * @brief Get the duration of the last frame.
+	 * @return The duration in seconds.
+	 */
+	[[nodiscard]] auto getFrameSeconds() const -> double { return m_frame; }
+	/**
+	 * @brief Get the interpolation factor between the last two ticks.
+	 * @return The factor in [0, 1[.
+	 */
+	[[nodiscard]] auto getAlpha() const -> double { return m_accumulator / m_step; }
+
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> const Stats& { return m_stats; }
+
+private:
+	/// The configuration.
+	Config m_config;
+	/// Duration of a tick in seconds.
+	double m_step = 1.0 / 120.0;
+	/// Duration of the last frame in seconds.
+	double m_frame = 0.0;
+	/// Time not yet consumed by the ticks, in seconds.
+	double m_accumulator = 0.0;
+	/// Start of the last frame.
+	clock::time_point m_last = clock::now();
+	/// The statistics.
+	Stats m_stats;
+};
+
+}// namespace mvi::core
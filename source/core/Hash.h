@@ -0,0 +1,64 @@
+/**
+ * @file Hash.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace mvi::core {
+
+/// FNV-1a 64 bits offset basis.
+constexpr uint64_t g_hashSeed = 0xcbf29ce484222325ull;
+/// FNV-1a 64 bits prime.
+constexpr uint64_t g_hashPrime = 0x100000001b3ull;
+
+/**
+ * @brief Hash a block of bytes (FNV-1a 64 bits).
+ * @param[in] iData The bytes to hash.
+ * @param[in] iSeed The initial hash value, to chain hashes.
+ * @return The hash.
+ */
+constexpr auto hashBytes(const std::span<const uint8_t> iData, uint64_t iSeed = g_hashSeed) -> uint64_t {
+	for (const uint8_t byte: iData) {
+		iSeed ^= byte;
+		iSeed *= g_hashPrime;
+	}
+	return iSeed;
+}
+
+/**
+ * @brief Hash a string (FNV-1a 64 bits).
+ * @param[in] iString The string to hash.
+ * @param[in] iSeed The initial hash value, to chain hashes.
+ * @return The hash.
+ */
+constexpr auto hashString(const std::string_view iString, uint64_t iSeed = g_hashSeed) -> uint64_t {
+	for (const char character: iString) {
+		iSeed ^= static_cast<uint8_t>(character);
+		iSeed *= g_hashPrime;
+	}
+	return iSeed;
+}
+
+/**
+ * @brief Hash the object representation of a trivially copyable value.
+ * @tparam T The value type.
+ * @param[in] iValue The value to hash.
+ * @param[in] iSeed The initial hash value, to chain hashes.
+ * @return The hash.
+ */
+template<typename T>
+auto hashValue(const T& iValue, const uint64_t iSeed = g_hashSeed) -> uint64_t {
+	static_assert(std::is_trivially_copyable_v<T>);
+	return hashBytes({reinterpret_cast<const uint8_t*>(&iValue), sizeof(T)}, iSeed);
+}
+
+}// namespace mvi::core
@@ -0,0 +1,101 @@
+/**
+ * @file MainThreadDispatcher.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "MainThreadDispatcher.h"
+
+namespace mvi::core {
+
+MainThreadDispatcher::MainThreadDispatcher() : m_head{&m_stub}, m_tail{&m_stub} {}
+
+MainThreadDispatcher::~MainThreadDispatcher() {
+	while (Node* node = pop()) delete node;
+}
+
+void MainThreadDispatcher::post(std::function<void()> iTask) {
+	auto* node = new Node;
+	node->task = std::move(iTask);
+	enqueue(node);
+}
+
+void MainThreadDispatcher::post(std::unique_ptr<event::Event> iEvent) {
+	auto* node = new Node;
+	node->event = std::move(iEvent);
+	enqueue(node);
+}
+
+auto MainThreadDispatcher::dispatch(const std::function<void(event::Event&)>& iOnEvent) -> uint64_t {
+	// Only the items already posted, so a task posting again cannot keep the main thread here.
+	const uint64_t count = m_posted.load(std::memory_order_acquire) - m_dispatched.load(std::memory_order_relaxed);
+	uint64_t done = 0;
+	while (done < count) {
+		const std::unique_ptr<Node> node{pop()};
+		if (node == nullptr)
+			break;
+		++done;
+		m_dispatched.fetch_add(1, std::memory_order_relaxed);
+		if (node->event != nullptr) {
+			if (iOnEvent)
+				iOnEvent(*node->event);
+		} else if (node->task) {
+			node->task();
+		}
+	}
+	return done;
+}
+
+auto MainThreadDispatcher::hasPending() const -> bool {
+	return m_posted.load(std::memory_order_acquire) != m_dispatched.load(std::memory_order_relaxed);
+}
+
+auto MainThreadDispatcher::getStats() const -> Stats {
+	return {.posted = m_posted.load(std::memory_order_relaxed),
+			.dispatched = m_dispatched.load(std::memory_order_relaxed)};
+}
+
+void MainThreadDispatcher::enqueue(Node* iNode) {
+	m_posted.fetch_add(1, std::memory_order_release);
+	push(iNode);
+	if (m_wake)
+		m_wake();
+}
+
+void MainThreadDispatcher::push(Node* iNode) {
+	iNode->next.store(nullptr, std::memory_order_relaxed);
+	Node* previous = m_head.exchange(iNode, std::memory_order_acq_rel);
+	previous->next.store(iNode, std::memory_order_release);
+}
+
+auto MainThreadDispatcher::pop() -> Node* {
+	Node* tail = m_tail;
+	Node* next = tail->next.load(std::memory_order_acquire);
+	// Skip the placeholder.
+	if (tail == &m_stub) {
+		if (next == nullptr)
+			return nullptr;
+		m_tail = next;
+		tail = next;
+		next = next->next.load(std::memory_order_acquire);
+	}
+	if (next != nullptr) {
+		m_tail = next;
+		return tail;
+	}
+	// The tail is the last item: put the placeholder behind it before taking it.
+	if (tail != m_head.load(std::memory_order_acquire))
+		return nullptr;
+	push(&m_stub);
+	next = tail->next.load(std::memory_order_acquire);
+	if (next != nullptr) {
+		m_tail = next;
+		return tail;
+	}
+	return nullptr;
+}
+
+}// namespace mvi::core
@@ -0,0 +1,134 @@
+/**
+ * @file MainThreadDispatcher.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "event/Event.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace mvi::core {
+
+/**
+ * @brief Queue of tasks and events posted by any thread, run by the main thread.
+ *
+ * The queue is a lock-free intrusive list with multiple producers and a single consumer: posting is one
+ * atomic exchange, and never waits for the main thread. Each post calls the wake function, so a main loop
+ * waiting for window events comes back to dispatch it.
+ */
+class MainThreadDispatcher final {
+public:
+	/**
+	 * @brief Dispatch statistics.
+	 */
+	struct Stats {
+		/// Items posted since start.
+		uint64_t posted = 0;
+		/// Items dispatched since start.
+		uint64_t dispatched = 0;
+	};
+
+	/**
+	 * @brief Default constructor.
+	 */
+	MainThreadDispatcher();
+	/**
+	 * @brief Destructor, drop the items not dispatched.
+	 */
+	~MainThreadDispatcher();
+
+	MainThreadDispatcher(const MainThreadDispatcher&) = delete;
+	MainThreadDispatcher(MainThreadDispatcher&&) = delete;
+	auto operator=(const MainThreadDispatcher&) -> MainThreadDispatcher& = delete;
+	auto operator=(MainThreadDispatcher&&) -> MainThreadDispatcher& = delete;
+
+	/**
+	 * @brief Define the function waking the main thread, callable from any thread.
+	 * @param[in] iWake The wake function, empty for none.
+	 *
+	 * @note To set while no other thread posts.
+	 */
+	void setWakeFunction(std::function<void()> iWake) { m_wake = std::move(iWake); }
+
+	/**
+	 * @brief Post a task to run on the main thread (any thread).
+	 * @param[in] iTask The task.
+	 */
+	void post(std::function<void()> iTask);
+	/**
+	 * @brief Post an event to send to the application on the main thread (any thread).
+	 * @param[in] iEvent The event.
+	 */
+	void post(std::unique_ptr<event::Event> iEvent);
+
+	/**
+	 * @brief Run the tasks and send the events posted so far (main thread).
+	 * @param[in] iOnEvent The function receiving the events.
+	 * @return The number of items dispatched.
+	 *
+	 * @note Items posted during the dispatch wait for the next one.
+	 */
+	auto dispatch(const std::function<void(event::Event&)>& iOnEvent) -> uint64_t;
+	/**
+	 * @brief Check if items wait to be dispatched.
+	 * @return True if items are pending.
+	 */
+	[[nodiscard]] auto hasPending() const -> bool;
+
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> Stats;
+
+private:
+	/**
+	 * @brief Queued item.
+	 */
+	struct Node {
+		/// Next item, toward the newest.
+		std::atomic<Node*> next = nullptr;
+		/// Task to run.
+		std::function<void()> task;
+		/// Event to send.
+		std::unique_ptr<event::Event> event;
+	};
+
+	/**
+	 * @brief Count an item, add it and wake the main thread (any thread).
+	 * @param[in] iNode The item.
+	 */
+	void enqueue(Node* iNode);
+	/**
+	 * @brief Link an item at the head of the list (any thread).
+	 * @param[in] iNode The item.
+	 */
+	void push(Node* iNode);
+	/**
+	 * @brief Take the oldest item (main thread).
+	 * @return The item, null if none or if the next one is being added.
+	 */
+	auto pop() -> Node*;
+
+	/// Last added item, where the producers link.
+	std::atomic<Node*> m_head;
+	/// Oldest item, owned by the consumer.
+	Node* m_tail;
+	/// Placeholder item, keeping the list never empty.
+	Node m_stub;
+	/// Items posted.
+	std::atomic<uint64_t> m_posted = 0;
+	/// Items dispatched.
+	std::atomic<uint64_t> m_dispatched = 0;
+	/// Function waking the main thread.
+	std::function<void()> m_wake;
+};
+
+}// namespace mvi::core
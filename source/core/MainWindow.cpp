@@ -10,6 +10,15 @@
 #include "Application.h"
 #include "Log.h"
 #include "MainWindow.h"
+#include "capture/DrawDataRecorder.h"
+#include "fonts/AtlasBudget.h"
+#include "fonts/AtlasBuilder.h"
+#include "fonts/FontCache.h"
+#include "fonts/MsdfAtlas.h"
+#include "utilities.h"
+#include "views/View.h"
+#include "vulkan/FrameCapture.h"
+#include "vulkan/MsdfRenderer.h"
 #include "vulkan/VulkanContext.h"
 
 #define GLFW_INCLUDE_NONE
@@ -22,8 +31,10 @@
 
 
 // memory fonts...
+#ifndef MVI_USE_RESOURCE_PACK
 #include "core/fonts/Roboto-Bold.embed"
 #include "core/fonts/Roboto-Italic.embed"
+#endif
 #include "event/AppEvent.h"
 #include "event/KeyEvent.h"
 #include "event/MouseEvent.h"
@@ -35,8 +46,77 @@ namespace {
 
 std::shared_ptr<vulkan::VulkanContext> g_vkContext;
 std::shared_ptr<ImGui_ImplVulkanH_Window> g_MainWindowData;
+std::unique_ptr<fonts::FontCache> g_fontCache;
+std::unique_ptr<fonts::AtlasBudget> g_atlasBudget;
+std::unique_ptr<fonts::AtlasBuilder> g_atlasBuilder;
+std::unique_ptr<vulkan::MsdfRenderer> g_msdfRenderer;
+std::unique_ptr<vulkan::FrameCapture> g_frameCapture;
+std::unique_ptr<capture::DrawDataRecorder> g_drawDataRecorder;
+
+/// Swap chain images are also copied by the frame capture.
+constexpr VkImageUsageFlags g_swapChainUsage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
 
-void glfw_error_callback(int error, const char* description) { log_error("GLFW Error %d: %s", error, description); }
+/**
+ * @brief Font setup the retained view contents were rendered with.
+ */
+struct FontState {
+	/// The default font.
+	ImFont* font = nullptr;
+	/// Base font size.
+	float sizeBase = 0.f;
+	/// Main font scale.
+	float scaleMain = 0.f;
+	/// DPI font scale.
+	float scaleDpi = 0.f;
+	/// Framebuffer scale.
+	ImVec2 framebufferScale;
+
+	/**
+	 * @brief Check if two font setups differ.
+	 * @param[in] iOther The other setup.
+	 * @return True if they differ.
+	 */
+	[[nodiscard]] auto differs(const FontState& iOther) const -> bool {
+		constexpr float tolerance = 1e-4f;
+		return font != iOther.font || std::abs(sizeBase - iOther.sizeBase) > tolerance ||
+			   std::abs(scaleMain - iOther.scaleMain) > tolerance || std::abs(scaleDpi - iOther.scaleDpi) > tolerance ||
+			   std::abs(framebufferScale.x - iOther.framebufferScale.x) > tolerance ||
+			   std::abs(framebufferScale.y - iOther.framebufferScale.y) > tolerance;
+	}
+};
+/// Font setup of the last frame.
+FontState g_fontState;
+
+void glfw_error_callback(int error, const char* description) { log_error("GLFW Error {}: {}", error, description); }
+
+/**
+ * @brief Name the swap chain objects, recreated with the window.
+ */
+void nameWindowObjects() {
+	const auto& debug = g_vkContext->getDebugUtils();
+	if (!debug.isEnabled())
+		return;
+	const auto* wd = g_MainWindowData.get();
+	debug.setName(VK_OBJECT_TYPE_SURFACE_KHR, wd->Surface, "main surface");
+	debug.setName(VK_OBJECT_TYPE_SWAPCHAIN_KHR, wd->Swapchain, "main swap chain");
+	debug.setName(VK_OBJECT_TYPE_RENDER_PASS, wd->RenderPass, "imgui render pass");
+	for (int i = 0; i < wd->Frames.Size; ++i) {
+		const auto& frame = wd->Frames[i];
+		debug.setName(VK_OBJECT_TYPE_COMMAND_POOL, frame.CommandPool, std::format("frame {} command pool", i));
+		debug.setName(VK_OBJECT_TYPE_COMMAND_BUFFER, frame.CommandBuffer, std::format("frame {} commands", i));
+		debug.setName(VK_OBJECT_TYPE_FENCE, frame.Fence, std::format("frame {} fence", i));
+		debug.setName(VK_OBJECT_TYPE_IMAGE, frame.Backbuffer, std::format("backbuffer {}", i));
+		debug.setName(VK_OBJECT_TYPE_IMAGE_VIEW, frame.BackbufferView, std::format("backbuffer {}", i));
+		debug.setName(VK_OBJECT_TYPE_FRAMEBUFFER, frame.Framebuffer, std::format("backbuffer {}", i));
+	}
+	for (int i = 0; i < wd->FrameSemaphores.Size; ++i) {
+		const auto& semaphores = wd->FrameSemaphores[i];
+		debug.setName(VK_OBJECT_TYPE_SEMAPHORE, semaphores.ImageAcquiredSemaphore,
+					  std::format("image acquired {}", i));
+		debug.setName(VK_OBJECT_TYPE_SEMAPHORE, semaphores.RenderCompleteSemaphore,
+					  std::format("render complete {}", i));
+	}
+}
 
 auto vec(const vec4& v) -> ImVec4 { return {v[0], v[1], v[2], v[3]}; }
 
@@ -89,6 +169,16 @@ void MainWindow::init() {
 	g_MainWindowData->Surface = surface;
 	setupVulkanWindow(w, h);
 
+	// Frame pacing: inputs polled just in time for the next vertical blank.
+	{
+		auto& pacer = g_vkContext->getFramePacer();
+		const auto settings = getSettings();
+		pacer.setConfig({.lowLatency = settings->getValue<bool>("frame_pacing/low_latency", false),
+						 .marginMs = settings->getValue<double>("frame_pacing/margin_ms", 1.0)});
+		if (const GLFWvidmode* mode = glfwGetVideoMode(glfwGetPrimaryMonitor()); mode != nullptr)
+			pacer.setRefreshRate(mode->refreshRate);
+	}
+
 	// Setup Dear ImGui context
 	IMGUI_CHECKVERSION();
 	ImGui::CreateContext();
@@ -137,6 +227,24 @@ void MainWindow::init() {
 	if (Application::get().getState() == Application::State::Error)
 		return;
 
+	// Frames are captured asynchronously into host-visible buffers.
+	{
+		const auto settings = getSettings();
+		g_frameCapture = std::make_unique<vulkan::FrameCapture>(
+				*g_vkContext,
+				vulkan::FrameCapture::Config{
+						.directory = getCaptureDir(),
+						.ringSize = static_cast<uint32_t>(settings->getValue<int>("capture/ring_size", 4)),
+						.queueSize = static_cast<uint32_t>(settings->getValue<int>("capture/queue_size", 8)),
+						.recordFormat = settings->getValue<std::string>("capture/record_format", "y4m") == "png"
+												? vulkan::FrameCapture::Format::Png
+												: vulkan::FrameCapture::Format::Y4m,
+						.frameRate = static_cast<uint32_t>(settings->getValue<int>("capture/frame_rate", 60))});
+		g_vkContext->setFrameCapture(g_frameCapture.get());
+	}
+	// Draw data of the frames, recorded on demand to replay them in the renderer benchmark.
+	g_drawDataRecorder = std::make_unique<capture::DrawDataRecorder>();
+
 	setTheme({});
 	setCallbacks();
 }
@@ -156,6 +264,15 @@ void MainWindow::setCallbacks() {
 		event::WindowCloseEvent event;
 		static_cast<WindowData*>(glfwGetWindowUserPointer(iWindow))->eventCallback(event);
 	});
+	glfwSetWindowFocusCallback(window, [](GLFWwindow* iWindow, const int iFocused) -> void {
+		if (iFocused != 0) {
+			event::WindowFocusEvent event;
+			static_cast<WindowData*>(glfwGetWindowUserPointer(iWindow))->eventCallback(event);
+		} else {
+			event::WindowLostFocusEvent event;
+			static_cast<WindowData*>(glfwGetWindowUserPointer(iWindow))->eventCallback(event);
+		}
+	});
 	glfwSetKeyCallback(
 			window,
 			[](GLFWwindow* iWindow, const int iKey, [[maybe_unused]] int iScancode, const int iAction,
@@ -254,7 +371,8 @@ void MainWindow::setupVulkanWindow(const int iWidth, const int iHeight) {
 	assert(m_minImageCount >= 2);
 	ImGui_ImplVulkanH_CreateOrResizeWindow(vkData.instance, vkData.physicalDevice, vkData.device,
 										   g_MainWindowData.get(), vkData.queueFamily, vkData.allocator, iWidth,
-										   iHeight, m_minImageCount, 0);
+										   iHeight, m_minImageCount, g_swapChainUsage);
+	nameWindowObjects();
 	m_windowSetupDone = true;
 }
 
@@ -270,9 +388,21 @@ void MainWindow::close() {
 	const auto vkData = g_vkContext->getVkData();
 	const auto err = vkDeviceWaitIdle(vkData.device);
 	vulkan::VulkanContext::checkVkResult(err);
+	if (g_fontCache)
+		g_fontCache->flush();
+	g_msdfRenderer.reset();
+	g_vkContext->setFrameCapture(nullptr);
+	g_frameCapture.reset();
+	g_drawDataRecorder.reset();
+	g_vkContext->getTextureUploader().release();
+	// The device is idle: release the deferred objects while the ImGui backend still owns their textures.
+	g_vkContext->getDeletionQueue().flush();
 	ImGui_ImplVulkan_Shutdown();
 	ImGui_ImplGlfw_Shutdown();
 	ImGui::DestroyContext();
+	g_atlasBudget.reset();
+	g_atlasBuilder.reset();
+	g_fontCache.reset();
 
 	cleanupVulkanWindow();
 	g_MainWindowData.reset();
@@ -288,6 +418,39 @@ auto MainWindow::shouldClose() const -> bool {
 	return glfwWindowShouldClose(window) != 0;
 }
 
+void MainWindow::waitEvents(const std::chrono::steady_clock::time_point iUntil) {
+	if (const double timeout = std::chrono::duration<double>(iUntil - std::chrono::steady_clock::now()).count();
+		timeout > 0.0)
+		glfwWaitEventsTimeout(timeout);
+}
+
+void MainWindow::wake() { glfwPostEmptyEvent(); }
+
+auto MainWindow::isIconified() const -> bool {
+	auto* window = static_cast<GLFWwindow*>(m_window);
+	return glfwGetWindowAttrib(window, GLFW_ICONIFIED) != 0;
+}
+
+auto MainWindow::isOccluded() const -> bool {
+	// GLFW does not report the occlusion by other windows, only the cases without visible surface.
+	auto* window = static_cast<GLFWwindow*>(m_window);
+	if (glfwGetWindowAttrib(window, GLFW_VISIBLE) == 0)
+		return true;
+	int fb_width = 0;
+	int fb_height = 0;
+	glfwGetFramebufferSize(window, &fb_width, &fb_height);
+	return fb_width <= 0 || fb_height <= 0;
+}
+
+auto MainWindow::hasFocusedViewport() const -> bool {
+	if (ImGui::GetCurrentContext() == nullptr || (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) == 0)
+		return false;
+	const auto& viewports = ImGui::GetPlatformIO().Viewports;
+	return std::ranges::any_of(viewports.begin() + 1, viewports.end(), [](const ImGuiViewport* iViewport) -> bool {
+		return (iViewport->Flags & ImGuiViewportFlags_IsFocused) != 0;
+	});
+}
+
 
 void MainWindow::newFrame() {
 	// Poll and handle events (inputs, window resize, etc.)
@@ -295,6 +458,8 @@ void MainWindow::newFrame() {
 	// - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
 	// - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
 	// Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+	// In low latency pacing, the inputs are polled just in time for the next vertical blank.
+	g_vkContext->getFramePacer().waitForFrame();
 	glfwPollEvents();
 	auto* window = static_cast<GLFWwindow*>(m_window);
 	const auto vkData = g_vkContext->getVkData();
@@ -308,20 +473,49 @@ void MainWindow::newFrame() {
 		ImGui_ImplVulkan_SetMinImageCount(m_minImageCount);
 		ImGui_ImplVulkanH_CreateOrResizeWindow(vkData.instance, vkData.physicalDevice, vkData.device,
 											   g_MainWindowData.get(), vkData.queueFamily, vkData.allocator, fb_width,
-											   fb_height, m_minImageCount, 0);
+											   fb_height, m_minImageCount, g_swapChainUsage);
+		nameWindowObjects();
 		g_MainWindowData->FrameIndex = 0;
 		m_swapChainRebuild = false;
 	}
 	auto& app = Application::get();
 	if (app.getState() != Application::State::Running && app.getState() != Application::State::Waiting)
 		return;
+	// The frame rate while minimized is limited by the governor.
 	if (glfwGetWindowAttrib(window, GLFW_ICONIFIED) != 0) {
-		ImGui_ImplGlfw_Sleep(10);
 		app.setWaiting();
 		return;
 	}
 	app.setRunning();
 
+	// Evict the least recently used glyphs before the frame bakes new ones.
+	if (g_atlasBudget) {
+		const auto& stats = g_atlasBudget->getStats();
+		const uint32_t changes = stats.evictions + stats.compactions;
+		g_atlasBudget->update(ImGui::GetIO().Fonts);
+		// Cached view contents may draw the evicted or moved glyphs.
+		if (stats.evictions + stats.compactions != changes)
+			views::View::invalidateRetained();
+	}
+
+	// Fonts prepared in the background replace the current ones between two frames.
+	if (ImGuiIO& io = ImGui::GetIO(); g_atlasBuilder && g_atlasBuilder->apply(io.Fonts, &io.FontDefault)) {
+		ImGui::GetStyle().FontSizeBase = g_atlasBuilder->getSize();
+		views::View::invalidateRetained();
+	}
+
+	// Cached view contents hold the glyphs of the previous font, size or scale (DPI change).
+	const ImGuiStyle& style = ImGui::GetStyle();
+	if (const FontState fontState{.font = ImGui::GetIO().FontDefault,
+								  .sizeBase = style.FontSizeBase,
+								  .scaleMain = style.FontScaleMain,
+								  .scaleDpi = style.FontScaleDpi,
+								  .framebufferScale = ImGui::GetIO().DisplayFramebufferScale};
+		fontState.differs(g_fontState)) {
+		g_fontState = fontState;
+		views::View::invalidateRetained();
+	}
+
 	// Start the Dear ImGui frame
 	ImGui_ImplVulkan_NewFrame();
 	ImGui_ImplGlfw_NewFrame();
@@ -330,15 +524,21 @@ void MainWindow::newFrame() {
 
 
 void MainWindow::render(const std::array<float, 4>& iClearColor) {
+	// Compute jobs queued during the frame, independent from the presentation
+	g_vkContext->getCompute().flush();
 	// Rendering
 	ImGui::Render();
+	// Recorded with the pending texture updates.
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	if (g_drawDataRecorder)
+		g_drawDataRecorder->record(*draw_data);
+	// Texture updates first, for all the viewports and the passes sampling them.
+	g_vkContext->getTextureUploader().update(ImGui::GetPlatformIO().Textures);
 	if (const ImGuiIO& io = ImGui::GetIO(); io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
 		ImGui::UpdatePlatformWindows();
 		ImGui::RenderPlatformWindowsDefault();
 	}
 
-	ImDrawData* draw_data = ImGui::GetDrawData();
-
 	if (const bool is_minimized = (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f);
 		!is_minimized) {
 		g_MainWindowData->ClearValue.color.float32[0] = iClearColor[0] * iClearColor[3];
@@ -346,6 +546,8 @@ void MainWindow::render(const std::array<float, 4>& iClearColor) {
 		g_MainWindowData->ClearValue.color.float32[2] = iClearColor[2] * iClearColor[3];
 		g_MainWindowData->ClearValue.color.float32[3] = iClearColor[3];
 		g_vkContext->frameRender(g_MainWindowData.get(), draw_data, m_swapChainRebuild);
+	} else {
+		g_vkContext->discardFrame();
 	}
 }
 
@@ -357,16 +559,57 @@ void MainWindow::setTheme(const Theme& iTheme) {
 	if (!m_fontsLoaded) {
 		m_fontsLoaded = true;
 
+		// Glyphs rasterized by previous runs are mapped back from the disk cache.
+		if (getSettings()->getValue<bool>("fonts/disk_cache", true)) {
+			g_fontCache = std::make_unique<fonts::FontCache>(getCacheDir() / "fonts");
+			g_fontCache->install(io.Fonts);
+		}
+		// Glyphs are baked on demand into a bounded atlas page.
+		const auto settings = getSettings();
+		g_atlasBudget = std::make_unique<fonts::AtlasBudget>(fonts::AtlasBudget::Config{
+				.pageSize = settings->getValue<int>("fonts/atlas_page_size", 2048),
+				.fillRatio = static_cast<float>(settings->getValue<double>("fonts/atlas_fill_ratio", 0.75)),
+				.unusedFrames = settings->getValue<int>("fonts/atlas_unused_frames", 120)});
+
 		ImFontConfig fontConfig;
 		fontConfig.FontDataOwnedByAtlas = false;
 		// NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+#ifdef MVI_USE_RESOURCE_PACK
+		// Font files are expanded from the resource pack, which outlives the atlas.
+		const auto resources = getResourcePack();
+		for (const std::string_view fontName: {"fonts/Roboto-Bold", "fonts/Roboto-Italic"}) {
+			const auto fontData = resources->get(fontName);
+			if (fontData.empty()) {
+				log_error("Font '{}' not found in the resource pack.", fontName);
+				continue;
+			}
+			io.Fonts->AddFontFromMemoryTTF(const_cast<uint8_t*>(fontData.data()), static_cast<int>(fontData.size()),
+										   20.0f, &fontConfig);
+		}
+#else
 		//ImFont* robotoFont = io.Fonts->AddFontFromMemoryTTF(const_cast<void*>(static_cast<const void*>(g_RobotoRegular)),
 		//													sizeof(g_RobotoRegular), 20.0f, &fontConfig);
 		io.Fonts->AddFontFromMemoryTTF(const_cast<void*>(static_cast<const void*>(g_RobotoBold)), sizeof(g_RobotoBold),
 									   20.0f, &fontConfig);
 		io.Fonts->AddFontFromMemoryTTF(const_cast<void*>(static_cast<const void*>(g_RobotoItalic)),
 									   sizeof(g_RobotoItalic), 20.0f, &fontConfig);
+#endif
 		// NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+		// Large character sets (CJK...) come from a fallback font merged into the main one.
+		if (const auto fallback = settings->getValue<std::string>("fonts/fallback_font");
+			!fallback.empty() && !io.Fonts->Fonts.empty()) {
+			if (std::filesystem::exists(fallback)) {
+				ImFontConfig fallbackConfig;
+				fallbackConfig.MergeMode = true;
+				fallbackConfig.DstFont = io.Fonts->Fonts.front();
+				io.Fonts->AddFontFromFileTTF(fallback.c_str(), 20.0f, &fallbackConfig);
+			} else
+				log_warn("Fallback font '{}' not found.", fallback);
+		}
+		// Later font changes are rasterized by a worker thread, with the same loader.
+		if (const ImFontLoader* loader = g_fontCache ? g_fontCache->getInnerLoader() : io.Fonts->FontLoader;
+			loader != nullptr)
+			g_atlasBuilder = std::make_unique<fonts::AtlasBuilder>(loader);
 	}
 	// Setup Dear ImGui style
 	ImGui::StyleColorsDark();
@@ -478,6 +721,8 @@ void MainWindow::setTheme(const Theme& iTheme) {
 		style.WindowRounding = 0.0f;
 		style.Colors[ImGuiCol_WindowBg].w = 1.0f;
 	}
+	// Cached view contents were rendered with the previous colors.
+	views::View::invalidateRetained();
 }
 
 auto MainWindow::isKeyPressed(const KeyCode& iKeycode) const -> bool {
@@ -497,6 +742,11 @@ auto MainWindow::getModifiers() const -> Modifiers {
 
 void MainWindow::onEvent(event::Event& ioEvent) {
 	// Send event to ImGui
+	if (ioEvent.getType() == event::Type::WindowFocus || ioEvent.getType() == event::Type::WindowLostFocus) {
+		ImGui_ImplGlfw_WindowFocusCallback(static_cast<GLFWwindow*>(m_window),
+										   ioEvent.getType() == event::Type::WindowFocus ? GLFW_TRUE : GLFW_FALSE);
+		return;
+	}
 	std::unordered_map<event::Type, int> keyMap = {
 			{event::Type::KeyPressed, GLFW_PRESS},
 			{event::Type::KeyReleased, GLFW_RELEASE},
@@ -538,4 +788,49 @@ void MainWindow::onEvent(event::Event& ioEvent) {
 	}
 }
 
+auto MainWindow::getMsdfRenderer() -> vulkan::MsdfRenderer* {
+	if (g_msdfRenderer != nullptr || m_msdfRequested)
+		return g_msdfRenderer.get();
+	m_msdfRequested = true;
+#ifdef MVI_USE_RESOURCE_PACK
+	const auto fontData = getResourcePack()->get("fonts/Roboto-Bold");
+#else
+	const std::span<const uint8_t> fontData{g_RobotoBold, sizeof(g_RobotoBold)};
+#endif
+	auto atlas = std::make_unique<fonts::MsdfAtlas>(fonts::MsdfAtlas::Config{
+			.glyphSize = static_cast<float>(getSettings()->getValue<double>("fonts/msdf_glyph_size", 32.0))});
+	if (fontData.empty() || !atlas->build(fontData))
+		return nullptr;
+	g_msdfRenderer =
+			std::make_unique<vulkan::MsdfRenderer>(*g_vkContext, g_MainWindowData->RenderPass, std::move(atlas));
+	return g_msdfRenderer.get();
+}
+
+void MainWindow::setFont(const std::filesystem::path& iPath, const float iSize) {
+	if (!g_atlasBuilder)
+		return;
+	fonts::AtlasBuilder::Request request{.sources = {}, .sizes = {iSize}};
+	if (iPath.empty()) {
+#ifdef MVI_USE_RESOURCE_PACK
+		request.sources.push_back({.path = {}, .data = getResourcePack()->get("fonts/Roboto-Bold")});
+#else
+		request.sources.push_back({.path = {}, .data = {g_RobotoBold, sizeof(g_RobotoBold)}});
+#endif
+	} else
+		request.sources.push_back({.path = iPath, .data = {}});
+	if (const auto fallback = getSettings()->getValue<std::string>("fonts/fallback_font"); !fallback.empty())
+		request.sources.push_back({.path = fallback, .data = {}});
+	g_atlasBuilder->request(std::move(request));
+}
+
+auto MainWindow::getAtlasBuilder() -> fonts::AtlasBuilder* { return g_atlasBuilder.get(); }
+
+auto MainWindow::getAtlasBudget() -> fonts::AtlasBudget* { return g_atlasBudget.get(); }
+
+auto MainWindow::getFrameCapture() -> vulkan::FrameCapture* { return g_frameCapture.get(); }
+
+auto MainWindow::getDrawDataRecorder() -> capture::DrawDataRecorder* { return g_drawDataRecorder.get(); }
+
+auto MainWindow::getVulkanContext() -> vulkan::VulkanContext* { return g_vkContext.get(); }
+
 }// namespace mvi::core
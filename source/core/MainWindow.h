@@ -14,10 +14,27 @@
 #include "event/Event.h"
 #include "event/KeyCodes.h"
 #include <array>
+#include <chrono>
+#include <filesystem>
 #include <functional>
 
 namespace mvi::core {
 
+namespace capture {
+class DrawDataRecorder;
+}// namespace capture
+
+namespace fonts {
+class AtlasBudget;
+class AtlasBuilder;
+}// namespace fonts
+
+namespace vulkan {
+class FrameCapture;
+class MsdfRenderer;
+class VulkanContext;
+}// namespace vulkan
+
 /**
  * @brief Class MainWindow.
  */
@@ -44,6 +61,21 @@ public:
 	 * @return True if the window should close.
 	 */
 	[[nodiscard]] auto shouldClose() const -> bool;
+	/**
+	 * @brief Check if the window is minimized.
+	 * @return True if minimized.
+	 */
+	[[nodiscard]] auto isIconified() const -> bool;
+	/**
+	 * @brief Check if the window has nothing to display, hidden or with an empty surface.
+	 * @return True if occluded.
+	 */
+	[[nodiscard]] auto isOccluded() const -> bool;
+	/**
+	 * @brief Check if a window detached from the main one has the focus.
+	 * @return True if a detached viewport is focused.
+	 */
+	[[nodiscard]] auto hasFocusedViewport() const -> bool;
 
 	/**
 	 * @brief Initialize the window.
@@ -55,6 +87,16 @@ public:
 	 */
 	void close();
 
+	/**
+	 * @brief Wait for window events, until a time point at most.
+	 * @param[in] iUntil The end of the wait.
+	 */
+	static void waitEvents(std::chrono::steady_clock::time_point iUntil);
+	/**
+	 * @brief Interrupt a wait for window events (any thread).
+	 */
+	static void wake();
+
 	/**
 	 * @brief Start a new frame.
 	 */
@@ -71,6 +113,15 @@ public:
 	 */
 	void setTheme(const Theme& iTheme);
 
+	/**
+	 * @brief Change the main font, prepared in the background.
+	 * @param[in] iPath The font file, empty for the default font.
+	 * @param[in] iSize The font size.
+	 *
+	 * @note The current font stays in use until the new one is ready.
+	 */
+	void setFont(const std::filesystem::path& iPath, float iSize);
+
 	/**
 	 * @brief Define the Event Callback function.
 	 * @param iCallback The new callback function.
@@ -96,6 +147,42 @@ public:
 	 */
 	void onEvent(event::Event& ioEvent);
 
+	/**
+	 * @brief Get the MSDF text renderer, building its atlas on first call.
+	 * @return The renderer, or nullptr if not available.
+	 */
+	[[nodiscard]] auto getMsdfRenderer() -> vulkan::MsdfRenderer*;
+
+	/**
+	 * @brief Get the font atlas builder.
+	 * @return The builder, or nullptr if not available.
+	 */
+	[[nodiscard]] auto getAtlasBuilder() -> fonts::AtlasBuilder*;
+
+	/**
+	 * @brief Get the font atlas budget.
+	 * @return The budget, or nullptr if not available.
+	 */
+	[[nodiscard]] auto getAtlasBudget() -> fonts::AtlasBudget*;
+
+	/**
+	 * @brief Get the frame capture.
+	 * @return The frame capture, or nullptr if not available.
+	 */
+	[[nodiscard]] auto getFrameCapture() -> vulkan::FrameCapture*;
+
+	/**
+	 * @brief Get the draw data recorder.
+	 * @return The recorder, or nullptr if not available.
+	 */
+	[[nodiscard]] auto getDrawDataRecorder() -> capture::DrawDataRecorder*;
+
+	/**
+	 * @brief Get the Vulkan context.
+	 * @return The Vulkan context, or nullptr if not initialized.
+	 */
+	[[nodiscard]] auto getVulkanContext() -> vulkan::VulkanContext*;
+
 private:
 	/// Native window pointer.
 	void* m_window{};
@@ -109,6 +196,8 @@ private:
 	uint32_t m_minImageCount = 2;
 	/// Vulkan window setup done flag.
 	bool m_windowSetupDone = false;
+	/// MSDF renderer creation attempted flag.
+	bool m_msdfRequested = false;
 	/// Setup Vulkan window.
 	void setupVulkanWindow(int iWidth, int iHeight);
 	/// Cleanup Vulkan window.
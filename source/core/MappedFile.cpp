@@ -0,0 +1,110 @@
+/**
+ * @file MappedFile.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "MappedFile.h"
+
+#include "Log.h"
+
+#ifdef MVI_PLATFORM_WINDOWS
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mvi::core {
+
+MappedFile::MappedFile(const std::filesystem::path& iPath) { open(iPath); }
+
+MappedFile::~MappedFile() { close(); }
+
+MappedFile::MappedFile(MappedFile&& ioOther) noexcept
+	: m_data{std::exchange(ioOther.m_data, nullptr)}, m_size{std::exchange(ioOther.m_size, 0)} {
+#ifdef MVI_PLATFORM_WINDOWS
+	m_mapping = std::exchange(ioOther.m_mapping, nullptr);
+#endif
+}
+
+auto MappedFile::operator=(MappedFile&& ioOther) noexcept -> MappedFile& {
+	if (this == &ioOther)
+		return *this;
+	close();
+	m_data = std::exchange(ioOther.m_data, nullptr);
+	m_size = std::exchange(ioOther.m_size, 0);
+#ifdef MVI_PLATFORM_WINDOWS
+	m_mapping = std::exchange(ioOther.m_mapping, nullptr);
+#endif
+	return *this;
+}
+
+auto MappedFile::open(const std::filesystem::path& iPath) -> bool {
+	close();
+	std::error_code errorCode;
+	const auto fileSize = std::filesystem::file_size(iPath, errorCode);
+	if (errorCode || fileSize == 0)
+		return false;
+#ifdef MVI_PLATFORM_WINDOWS
+	HANDLE file = CreateFileW(iPath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+							  FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		log_warn("Unable to open '{}' for mapping.", iPath.string());
+		return false;
+	}
+	m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (m_mapping == nullptr) {
+		log_warn("Unable to create file mapping for '{}'.", iPath.string());
+		return false;
+	}
+	m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+	if (m_data == nullptr) {
+		log_warn("Unable to map '{}'.", iPath.string());
+		CloseHandle(m_mapping);
+		m_mapping = nullptr;
+		return false;
+	}
+#else
+	const int file = ::open(iPath.c_str(), O_RDONLY);
+	if (file < 0) {
+		log_warn("Unable to open '{}' for mapping.", iPath.string());
+		return false;
+	}
+	void* address = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file);
+	if (address == MAP_FAILED) {
+		log_warn("Unable to map '{}'.", iPath.string());
+		return false;
+	}
+	m_data = static_cast<const uint8_t*>(address);
+#endif
+	m_size = static_cast<size_t>(fileSize);
+	return true;
+}
+
+void MappedFile::close() {
+	if (m_data == nullptr)
+		return;
+#ifdef MVI_PLATFORM_WINDOWS
+	UnmapViewOfFile(m_data);
+	CloseHandle(m_mapping);
+	m_mapping = nullptr;
+#else
+	// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+	munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+	m_data = nullptr;
+	m_size = 0;
+}
+
+}// namespace mvi::core
@@ -0,0 +1,84 @@
+/**
+ * @file MappedFile.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace mvi::core {
+
+/**
+ * @brief Read-only memory mapping of a file.
+ *
+ * Pages are only touched when the mapped bytes are read.
+ */
+class MappedFile final {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	MappedFile() = default;
+	/**
+	 * @brief Constructor that opens the given file.
+	 * @param[in] iPath The file to map.
+	 */
+	explicit MappedFile(const std::filesystem::path& iPath);
+	/**
+	 * @brief Destructor, unmap the file.
+	 */
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile(MappedFile&& ioOther) noexcept;
+	auto operator=(const MappedFile&) -> MappedFile& = delete;
+	auto operator=(MappedFile&& ioOther) noexcept -> MappedFile&;
+
+	/**
+	 * @brief Map a file, closing the previous mapping if any.
+	 * @param[in] iPath The file to map.
+	 * @return True if the file is mapped.
+	 */
+	auto open(const std::filesystem::path& iPath) -> bool;
+
+	/**
+	 * @brief Release the mapping.
+	 */
+	void close();
+
+	/**
+	 * @brief Check if a file is mapped.
+	 * @return True if mapped.
+	 */
+	[[nodiscard]] auto isOpen() const -> bool { return m_data != nullptr; }
+
+	/**
+	 * @brief Access to the mapped bytes.
+	 * @return The mapped bytes.
+	 */
+	[[nodiscard]] auto data() const -> std::span<const uint8_t> { return {m_data, m_size}; }
+
+	/**
+	 * @brief Get the mapped size.
+	 * @return The mapped size in bytes.
+	 */
+	[[nodiscard]] auto size() const -> size_t { return m_size; }
+
+private:
+	/// Mapped bytes.
+	const uint8_t* m_data = nullptr;
+	/// Mapped size.
+	size_t m_size = 0;
+#ifdef MVI_PLATFORM_WINDOWS
+	/// File mapping handle.
+	void* m_mapping = nullptr;
+#endif
+};
+
+}// namespace mvi::core
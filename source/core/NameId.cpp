@@ -0,0 +1,92 @@
+/**
+ * @file NameId.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "NameId.h"
+
+#include "Hash.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
+namespace mvi::core {
+
+namespace {
+
+/**
+ * @brief Transparent hash of the names.
+ */
+struct NameHash {
+	/// Allow the lookups by string view.
+	using is_transparent = void;
+	/**
+	 * @brief Hash a name.
+	 * @param[in] iName The name.
+	 * @return The hash.
+	 */
+	auto operator()(const std::string_view iName) const -> size_t { return static_cast<size_t>(hashString(iName)); }
+};
+
+/**
+ * @brief Table of the interned names.
+ */
+struct NameTable {
+	/// Protect the table, the lookups may come from any thread.
+	std::shared_mutex mutex;
+	/// The names by identifier, stable in memory.
+	std::deque<std::string> names;
+	/// The identifiers by name.
+	std::unordered_map<std::string_view, uint32_t, NameHash, std::equal_to<>> ids;
+};
+
+/**
+ * @brief Get the table of the interned names.
+ * @return The table.
+ */
+auto getTable() -> NameTable& {
+	static NameTable table;
+	return table;
+}
+
+}// namespace
+
+NameId::NameId(const std::string_view iName) {
+	auto& table = getTable();
+	{
+		const std::shared_lock lock(table.mutex);
+		if (const auto found = table.ids.find(iName); found != table.ids.end()) {
+			m_value = found->second;
+			return;
+		}
+	}
+	const std::unique_lock lock(table.mutex);
+	if (const auto found = table.ids.find(iName); found != table.ids.end()) {
+		m_value = found->second;
+		return;
+	}
+	m_value = static_cast<uint32_t>(table.names.size());
+	table.ids.emplace(table.names.emplace_back(iName), m_value);
+}
+
+auto NameId::find(const std::string_view iName) -> NameId {
+	auto& table = getTable();
+	const std::shared_lock lock(table.mutex);
+	const auto found = table.ids.find(iName);
+	return found != table.ids.end() ? fromValue(found->second) : NameId{};
+}
+
+auto NameId::getName() const -> std::string_view {
+	if (!isValid())
+		return {};
+	auto& table = getTable();
+	const std::shared_lock lock(table.mutex);
+	return table.names[m_value];
+}
+
+}// namespace mvi::core
@@ -0,0 +1,123 @@
+/**
+ * @file NameId.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace mvi::core {
+
+/**
+ * @brief Interned name, a small integer unique to a name for the process lifetime.
+ *
+ * The identifiers are dense, allocated in interning order from 0, so the registries index their entries with
+ * plain arrays. Interning and finding hash the name once; comparing and indexing identifiers is free.
+ */
+class NameId final {
+public:
+	/// Value of the invalid identifier.
+	static constexpr uint32_t g_invalid = ~0u;
+
+	/**
+	 * @brief Default constructor, invalid identifier.
+	 */
+	NameId() = default;
+	/**
+	 * @brief Intern a name.
+	 * @param[in] iName The name.
+	 */
+	explicit NameId(std::string_view iName);
+
+	/**
+	 * @brief Find the identifier of a name, without interning it.
+	 * @param[in] iName The name.
+	 * @return The identifier, invalid if the name was never interned.
+	 */
+	[[nodiscard]] static auto find(std::string_view iName) -> NameId;
+
+	/**
+	 * @brief Check if the identifier is valid.
+	 * @return True if valid.
+	 */
+	[[nodiscard]] auto isValid() const -> bool { return m_value != g_invalid; }
+	/**
+	 * @brief Get the identifier value.
+	 * @return The value.
+	 */
+	[[nodiscard]] auto getValue() const -> uint32_t { return m_value; }
+	/**
+	 * @brief Get the interned name.
+	 * @return The name, empty if invalid.
+	 */
+	[[nodiscard]] auto getName() const -> std::string_view;
+
+	/**
+	 * @brief Comparison of identifiers.
+	 * @param[in] iOther The other identifier.
+	 * @return The order.
+	 */
+	auto operator<=>(const NameId& iOther) const = default;
+
+private:
+	/**
+	 * @brief Create an identifier from its value.
+	 * @param[in] iValue The value.
+	 * @return The identifier.
+	 */
+	[[nodiscard]] static auto fromValue(const uint32_t iValue) -> NameId {
+		NameId id;
+		id.m_value = iValue;
+		return id;
+	}
+
+	/// The identifier value.
+	uint32_t m_value = g_invalid;
+};
+
+/**
+ * @brief Index from name identifiers to the slots of a contiguous storage.
+ */
+class SlotIndex final {
+public:
+	/// Value of an absent slot.
+	static constexpr uint32_t g_noSlot = ~0u;
+
+	/**
+	 * @brief Set the slot of an identifier, ignored if invalid.
+	 * @param[in] iId The identifier.
+	 * @param[in] iSlot The slot.
+	 */
+	void insert(const NameId iId, const uint32_t iSlot) {
+		if (!iId.isValid())
+			return;
+		if (iId.getValue() >= m_slots.size())
+			m_slots.resize(iId.getValue() + 1, g_noSlot);
+		m_slots[iId.getValue()] = iSlot;
+	}
+	/**
+	 * @brief Get the slot of an identifier.
+	 * @param[in] iId The identifier.
+	 * @return The slot, g_noSlot if absent.
+	 */
+	[[nodiscard]] auto find(const NameId iId) const -> uint32_t {
+		return iId.getValue() < m_slots.size() ? m_slots[iId.getValue()] : g_noSlot;
+	}
+	/**
+	 * @brief Remove all the slots.
+	 */
+	void clear() { m_slots.clear(); }
+
+private:
+	/// Slots by identifier value.
+	std::vector<uint32_t> m_slots;
+};
+
+}// namespace mvi::core
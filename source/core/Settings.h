@@ -11,6 +11,8 @@
 #include <any>
 #include <filesystem>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
 
 namespace mvi::core {
@@ -48,6 +50,9 @@ public:
 
 	/**
 	 * @brief Get a value from configuration.
+	 *
+	 * A floating point value also accepts an integer one, as the file stores `60` as an integer.
+	 *
 	 * @tparam T Type of the value.
 	 * @param iKey The key.
 	 * @param iDefault The default value.
@@ -57,6 +62,10 @@ public:
 	auto getValue(const std::string& iKey, const T& iDefault = T{}) const -> T {
 		if (const auto it = m_data.find(iKey); it != m_data.end()) {
 			try {
+				if constexpr (std::is_floating_point_v<T>) {
+					if (it->second.type() == typeid(int))
+						return static_cast<T>(std::any_cast<int>(it->second));
+				}
 				return std::any_cast<T>(it->second);
 			} catch (const std::bad_any_cast&) { return iDefault; }
 		}
@@ -0,0 +1,49 @@
+/**
+ * @file ActionRegistry.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ActionRegistry.h"
+
+#include "core/Log.h"
+
+namespace mvi::core::actions {
+
+ActionRegistry::ActionRegistry() = default;
+
+ActionRegistry::~ActionRegistry() = default;
+
+auto ActionRegistry::add(std::shared_ptr<Action> iAction) -> NameId {
+	const NameId id(iAction->getName());
+	if (m_index.find(id) != SlotIndex::g_noSlot) {
+		log_warn("Action '{}' already registered.", id.getName());
+		return id;
+	}
+	m_index.insert(id, static_cast<uint32_t>(m_actions.size()));
+	m_actions.push_back(std::move(iAction));
+	return id;
+}
+
+auto ActionRegistry::get(const NameId iId) const -> std::shared_ptr<Action> {
+	const uint32_t slot = m_index.find(iId);
+	return slot != SlotIndex::g_noSlot ? m_actions[slot] : nullptr;
+}
+
+void ActionRegistry::onEvent(event::Event& ioEvent) const {
+	for (const auto& action: m_actions) {
+		if (ioEvent.handled)
+			return;
+		action->onEvent(ioEvent);
+	}
+}
+
+void ActionRegistry::clear() {
+	m_actions.clear();
+	m_index.clear();
+}
+
+}// namespace mvi::core::actions
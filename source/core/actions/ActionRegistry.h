@@ -0,0 +1,83 @@
+/**
+ * @file ActionRegistry.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Action.h"
+#include "core/NameId.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace mvi::core::actions {
+
+/**
+ * @brief Registry of the actions, stored contiguously in registration order and indexed by interned name.
+ */
+class ActionRegistry final {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	ActionRegistry();
+	/**
+	 * @brief Default destructor.
+	 */
+	~ActionRegistry();
+
+	ActionRegistry(const ActionRegistry&) = delete;
+	ActionRegistry(ActionRegistry&&) = delete;
+	auto operator=(const ActionRegistry&) -> ActionRegistry& = delete;
+	auto operator=(ActionRegistry&&) -> ActionRegistry& = delete;
+
+	/**
+	 * @brief Add an action.
+	 * @param[in] iAction The action.
+	 * @return The interned action name.
+	 */
+	auto add(std::shared_ptr<Action> iAction) -> NameId;
+	/**
+	 * @brief Get an action.
+	 * @param[in] iId The interned action name.
+	 * @return The action, null if unknown.
+	 */
+	[[nodiscard]] auto get(NameId iId) const -> std::shared_ptr<Action>;
+	/**
+	 * @brief Get an action.
+	 * @param[in] iName The action name.
+	 * @return The action, null if unknown.
+	 */
+	[[nodiscard]] auto get(const std::string_view iName) const -> std::shared_ptr<Action> {
+		return get(NameId::find(iName));
+	}
+
+	/**
+	 * @brief Send an event to the actions, in registration order, until handled.
+	 * @param[in,out] ioEvent The Event to react.
+	 */
+	void onEvent(event::Event& ioEvent) const;
+	/**
+	 * @brief Remove all the actions.
+	 */
+	void clear();
+
+	/**
+	 * @brief Get the actions.
+	 * @return The actions, in registration order.
+	 */
+	[[nodiscard]] auto getActions() const -> const std::vector<std::shared_ptr<Action>>& { return m_actions; }
+
+private:
+	/// The actions.
+	std::vector<std::shared_ptr<Action>> m_actions;
+	/// Actions by interned name.
+	SlotIndex m_index;
+};
+
+}// namespace mvi::core::actions
@@ -0,0 +1,58 @@
+/**
+ * @file CaptureActions.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "CaptureActions.h"
+
+#include "core/Application.h"
+#include "core/Log.h"
+#include "core/capture/DrawDataRecorder.h"
+#include "core/utilities.h"
+#include "core/vulkan/FrameCapture.h"
+
+namespace mvi::core::actions {
+
+ScreenshotAction::ScreenshotAction() = default;
+ScreenshotAction::~ScreenshotAction() = default;
+void ScreenshotAction::onExecute() {
+	log_trace("Screenshot action executed.");
+	if (auto* capture = Application::get().getMainWindow().getFrameCapture(); capture != nullptr)
+		capture->requestScreenshot();
+}
+
+RecordAction::RecordAction() = default;
+RecordAction::~RecordAction() = default;
+void RecordAction::onExecute() {
+	log_trace("Record action executed.");
+	auto* capture = Application::get().getMainWindow().getFrameCapture();
+	if (capture == nullptr)
+		return;
+	if (capture->isRecording())
+		capture->stopRecording();
+	else
+		capture->startRecording();
+}
+
+DrawDataAction::DrawDataAction() = default;
+DrawDataAction::~DrawDataAction() = default;
+void DrawDataAction::onExecute() {
+	log_trace("Draw data action executed.");
+	auto* recorder = Application::get().getMainWindow().getDrawDataRecorder();
+	if (recorder == nullptr)
+		return;
+	if (recorder->isOpen()) {
+		recorder->close();
+		return;
+	}
+	const auto stamp =
+			std::format("{:%Y%m%d_%H%M%S}", std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()));
+	if (!recorder->open(getCaptureDir() / std::format("drawdata_{}.mvidraw", stamp)))
+		log_warning("Draw data recording not started.");
+}
+
+}// namespace mvi::core::actions
@@ -0,0 +1,74 @@
+/**
+ * @file CaptureActions.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "Action.h"
+
+namespace mvi::core::actions {
+
+/**
+ * @brief Class ScreenshotAction.
+ */
+class ScreenshotAction final : public Action {
+public:
+	ScreenshotAction();
+	~ScreenshotAction() override;
+	ScreenshotAction(const ScreenshotAction&) = delete;
+	ScreenshotAction(ScreenshotAction&&) = delete;
+	auto operator=(const ScreenshotAction&) -> ScreenshotAction& = delete;
+	auto operator=(ScreenshotAction&&) -> ScreenshotAction& = delete;
+	[[nodiscard]] auto getName() const -> std::string override { return "capture_screenshot"; }
+
+private:
+	/**
+	 * @brief Execute the action.
+	 */
+	void onExecute() override;
+};
+
+/**
+ * @brief Class RecordAction: toggle the continuous frame recording.
+ */
+class RecordAction final : public Action {
+public:
+	RecordAction();
+	~RecordAction() override;
+	RecordAction(const RecordAction&) = delete;
+	RecordAction(RecordAction&&) = delete;
+	auto operator=(const RecordAction&) -> RecordAction& = delete;
+	auto operator=(RecordAction&&) -> RecordAction& = delete;
+	[[nodiscard]] auto getName() const -> std::string override { return "capture_record"; }
+
+private:
+	/**
+	 * @brief Execute the action.
+	 */
+	void onExecute() override;
+};
+
+/**
+ * @brief Class DrawDataAction: toggle the recording of the draw data, for the renderer benchmark.
+ */
+class DrawDataAction final : public Action {
+public:
+	DrawDataAction();
+	~DrawDataAction() override;
+	DrawDataAction(const DrawDataAction&) = delete;
+	DrawDataAction(DrawDataAction&&) = delete;
+	auto operator=(const DrawDataAction&) -> DrawDataAction& = delete;
+	auto operator=(DrawDataAction&&) -> DrawDataAction& = delete;
+	[[nodiscard]] auto getName() const -> std::string override { return "capture_draw_data"; }
+
+private:
+	/**
+	 * @brief Execute the action.
+	 */
+	void onExecute() override;
+};
+
+}// namespace mvi::core::actions
@@ -0,0 +1,295 @@
+/**
+ * @file DrawDataRecorder.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "DrawDataRecorder.h"
+
+#include "core/Log.h"
+
+#include <array>
+#include <cstring>
+
+namespace mvi::core::capture {
+
+namespace {
+
+/// File signature.
+constexpr std::array<char, 8> g_magic = {'M', 'V', 'I', 'D', 'R', 'A', 'W', '1'};
+/// Texture chunk.
+constexpr uint32_t g_textureChunk = 0x54584554;// "TEXT"
+/// Frame chunk.
+constexpr uint32_t g_frameChunk = 0x454d5246;// "FRME"
+
+/**
+ * @brief Append raw bytes.
+ * @param[in,out] ioBuffer The buffer.
+ * @param[in] iData The bytes.
+ * @param[in] iSize The number of bytes.
+ */
+void put(std::vector<uint8_t>& ioBuffer, const void* iData, const size_t iSize) {
+	const auto offset = ioBuffer.size();
+	ioBuffer.resize(offset + iSize);
+	if (iSize > 0)
+		std::memcpy(ioBuffer.data() + offset, iData, iSize);
+}
+
+/**
+ * @brief Append a value.
+ * @tparam T The value type.
+ * @param[in,out] ioBuffer The buffer.
+ * @param[in] iValue The value.
+ */
+template<typename T>
+void put(std::vector<uint8_t>& ioBuffer, const T& iValue) {
+	put(ioBuffer, &iValue, sizeof(T));
+}
+
+/**
+ * @brief Bounds-checked reading of a buffer.
+ */
+class Cursor final {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iData The buffer.
+	 */
+	explicit Cursor(const std::vector<uint8_t>& iData) : m_data{iData} {}
+	/**
+	 * @brief Read raw bytes.
+	 * @param[out] oData The bytes.
+	 * @param[in] iSize The number of bytes.
+	 * @return True if the buffer holds them.
+	 */
+	auto get(void* oData, const size_t iSize) -> bool {
+		if (iSize > m_data.size() - m_offset)
+			return false;
+		if (iSize > 0)
+			std::memcpy(oData, m_data.data() + m_offset, iSize);
+		m_offset += iSize;
+		return true;
+	}
+	/**
+	 * @brief Read a value.
+	 * @tparam T The value type.
+	 * @param[out] oValue The value.
+	 * @return True if the buffer holds it.
+	 */
+	template<typename T>
+	auto get(T& oValue) -> bool {
+		return get(&oValue, sizeof(T));
+	}
+	/**
+	 * @brief Read an array.
+	 * @tparam T The element type.
+	 * @param[out] oValues The elements.
+	 * @param[in] iCount The number of elements.
+	 * @return True if the buffer holds them.
+	 */
+	template<typename T>
+	auto get(std::vector<T>& oValues, const size_t iCount) -> bool {
+		if (iCount > (m_data.size() - m_offset) / sizeof(T))
+			return false;
+		oValues.resize(iCount);
+		return get(oValues.data(), iCount * sizeof(T));
+	}
+
+private:
+	/// The buffer.
+	const std::vector<uint8_t>& m_data;
+	/// Read position.
+	size_t m_offset = 0;
+};
+
+/**
+ * @brief Get the size of a pixel.
+ * @param[in] iFormat The pixel format.
+ * @return The size in bytes.
+ */
+auto pixelSize(const ImTextureFormat iFormat) -> uint32_t { return iFormat == ImTextureFormat_Alpha8 ? 1 : 4; }
+
+}// namespace
+
+DrawDataRecorder::DrawDataRecorder() = default;
+
+DrawDataRecorder::~DrawDataRecorder() { close(); }
+
+auto DrawDataRecorder::open(const std::filesystem::path& iPath) -> bool {
+	close();
+	if (iPath.has_parent_path())
+		std::filesystem::create_directories(iPath.parent_path());
+	m_stream.open(iPath, std::ios::binary | std::ios::trunc);
+	if (!m_stream.is_open()) {
+		log_error("Unable to open the draw data recording '{}'.", iPath.string());
+		return false;
+	}
+	m_buffer.clear();
+	put(m_buffer, g_magic.data(), g_magic.size());
+	put(m_buffer, static_cast<uint32_t>(sizeof(ImDrawVert)));
+	put(m_buffer, static_cast<uint32_t>(sizeof(ImDrawIdx)));
+	m_stream.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+	m_size = m_buffer.size();
+	m_frameCount = 0;
+	m_textures.clear();
+	m_nextTexture = 1;
+	log_info("Recording draw data into '{}'.", iPath.string());
+	return true;
+}
+
+void DrawDataRecorder::close() {
+	if (!m_stream.is_open())
+		return;
+	m_stream.close();
+	log_info("Draw data recording done: {} frames, {} bytes.", m_frameCount, m_size);
+}
+
+void DrawDataRecorder::record(const ImDrawData& iDrawData) {
+	if (!m_stream.is_open())
+		return;
+	// Textures the renderer uploads this frame, or not seen yet.
+	if (iDrawData.Textures != nullptr) {
+		for (ImTextureData* texture: *iDrawData.Textures) {
+			if (texture->Status == ImTextureStatus_WantDestroy || texture->Status == ImTextureStatus_Destroyed) {
+				m_textures.erase(texture->UniqueID);
+				continue;
+			}
+			const auto known = m_textures.find(texture->UniqueID);
+			if (texture->Pixels == nullptr || (known != m_textures.end() && texture->Status == ImTextureStatus_OK))
+				continue;
+			const uint32_t id = known != m_textures.end() ? known->second : m_nextTexture++;
+			m_textures[texture->UniqueID] = id;
+			m_buffer.clear();
+			put(m_buffer, id);
+			put(m_buffer, static_cast<uint32_t>(texture->Format));
+			put(m_buffer, static_cast<uint32_t>(texture->Width));
+			put(m_buffer, static_cast<uint32_t>(texture->Height));
+			put(m_buffer, texture->Pixels, static_cast<size_t>(texture->GetSizeInBytes()));
+			writeChunk(g_textureChunk, m_buffer);
+		}
+	}
+
+	m_buffer.clear();
+	put(m_buffer, iDrawData.DisplayPos);
+	put(m_buffer, iDrawData.DisplaySize);
+	put(m_buffer, iDrawData.FramebufferScale);
+	put(m_buffer, static_cast<uint32_t>(iDrawData.CmdLists.Size));
+	for (const ImDrawList* list: iDrawData.CmdLists) {
+		uint32_t commandCount = 0;
+		for (const ImDrawCmd& command: list->CmdBuffer)
+			if (command.UserCallback == nullptr)
+				++commandCount;
+		put(m_buffer, static_cast<uint32_t>(list->VtxBuffer.Size));
+		put(m_buffer, static_cast<uint32_t>(list->IdxBuffer.Size));
+		put(m_buffer, commandCount);
+		put(m_buffer, list->VtxBuffer.Data, static_cast<size_t>(list->VtxBuffer.Size) * sizeof(ImDrawVert));
+		put(m_buffer, list->IdxBuffer.Data, static_cast<size_t>(list->IdxBuffer.Size) * sizeof(ImDrawIdx));
+		for (const ImDrawCmd& command: list->CmdBuffer) {
+			if (command.UserCallback != nullptr)
+				continue;
+			put(m_buffer, command.ClipRect);
+			put(m_buffer, reference(command.TexRef));
+			put(m_buffer, command.VtxOffset);
+			put(m_buffer, command.IdxOffset);
+			put(m_buffer, command.ElemCount);
+		}
+	}
+	writeChunk(g_frameChunk, m_buffer);
+	++m_frameCount;
+}
+
+auto DrawDataRecorder::reference(const ImTextureRef& iTexture) -> uint32_t {
+	if (iTexture._TexData == nullptr)
+		return 0;
+	const auto known = m_textures.find(iTexture._TexData->UniqueID);
+	return known != m_textures.end() ? known->second : 0;
+}
+
+void DrawDataRecorder::writeChunk(const uint32_t iTag, const std::vector<uint8_t>& iPayload) {
+	const auto size = static_cast<uint64_t>(iPayload.size());
+	m_stream.write(reinterpret_cast<const char*>(&iTag), sizeof(iTag));
+	m_stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+	m_stream.write(reinterpret_cast<const char*>(iPayload.data()), static_cast<std::streamsize>(iPayload.size()));
+	m_size += sizeof(iTag) + sizeof(size) + size;
+}
+
+auto DrawDataRecorder::load(const std::filesystem::path& iPath, std::vector<RecordedFrame>& oFrames) -> bool {
+	oFrames.clear();
+	std::ifstream stream(iPath, std::ios::binary);
+	if (!stream) {
+		log_error("Unable to open the draw data recording '{}'.", iPath.string());
+		return false;
+	}
+	std::array<char, 8> magic{};
+	uint32_t vertexSize = 0;
+	uint32_t indexSize = 0;
+	stream.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+	stream.read(reinterpret_cast<char*>(&vertexSize), sizeof(vertexSize));
+	stream.read(reinterpret_cast<char*>(&indexSize), sizeof(indexSize));
+	if (!stream || magic != g_magic) {
+		log_error("'{}' is not a draw data recording.", iPath.string());
+		return false;
+	}
+	if (vertexSize != sizeof(ImDrawVert) || indexSize != sizeof(ImDrawIdx)) {
+		log_error("'{}' was recorded with other vertex or index types.", iPath.string());
+		return false;
+	}
+
+	std::vector<RecordedTexture> textures;
+	std::vector<uint8_t> payload;
+	uint32_t tag = 0;
+	uint64_t size = 0;
+	while (stream.read(reinterpret_cast<char*>(&tag), sizeof(tag)) &&
+		   stream.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+		payload.resize(size);
+		if (!stream.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(size))) {
+			log_warning("Truncated draw data recording '{}'.", iPath.string());
+			break;
+		}
+		Cursor cursor(payload);
+		bool valid = true;
+		if (tag == g_textureChunk) {
+			RecordedTexture& texture = textures.emplace_back();
+			uint32_t format = 0;
+			valid = cursor.get(texture.id) && cursor.get(format) && cursor.get(texture.width) &&
+					cursor.get(texture.height);
+			texture.format = static_cast<ImTextureFormat>(format);
+			const size_t pixelCount = size_t{texture.width} * texture.height;
+			valid = valid && cursor.get(texture.pixels, pixelCount * pixelSize(texture.format));
+		} else if (tag == g_frameChunk) {
+			RecordedFrame& frame = oFrames.emplace_back();
+			uint32_t listCount = 0;
+			valid = cursor.get(frame.displayPos) && cursor.get(frame.displaySize) &&
+					cursor.get(frame.framebufferScale) && cursor.get(listCount);
+			for (uint32_t index = 0; valid && index < listCount; ++index) {
+				RecordedList& list = frame.lists.emplace_back();
+				uint32_t vertexCount = 0;
+				uint32_t indexCount = 0;
+				uint32_t commandCount = 0;
+				valid = cursor.get(vertexCount) && cursor.get(indexCount) && cursor.get(commandCount) &&
+						cursor.get(list.vertices, vertexCount) && cursor.get(list.indices, indexCount);
+				for (uint32_t command = 0; valid && command < commandCount; ++command) {
+					RecordedCommand& recorded = list.commands.emplace_back();
+					valid = cursor.get(recorded.clipRect) && cursor.get(recorded.texture) &&
+							cursor.get(recorded.vertexOffset) && cursor.get(recorded.indexOffset) &&
+							cursor.get(recorded.elementCount);
+				}
+			}
+			frame.textures = std::move(textures);
+			textures.clear();
+		}
+		if (!valid) {
+			log_warning("Corrupted chunk in the draw data recording '{}'.", iPath.string());
+			if (tag == g_frameChunk)
+				oFrames.pop_back();
+			break;
+		}
+	}
+	log_info("Loaded {} frames from '{}'.", oFrames.size(), iPath.string());
+	return !oFrames.empty();
+}
+
+}// namespace mvi::core::capture
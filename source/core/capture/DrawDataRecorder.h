@@ -0,0 +1,170 @@
+/**
+ * @file DrawDataRecorder.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <imgui.h>
+#include <unordered_map>
+#include <vector>
+
+namespace mvi::core::capture {
+
+/**
+ * @brief Texture content, as known by the renderer.
+ */
+struct RecordedTexture {
+	/// Texture reference in the commands.
+	uint32_t id = 0;
+	/// Pixel format.
+	ImTextureFormat format = ImTextureFormat_RGBA32;
+	/// Texture width.
+	uint32_t width = 0;
+	/// Texture height.
+	uint32_t height = 0;
+	/// Pixels, rows without padding.
+	std::vector<uint8_t> pixels;
+};
+
+/**
+ * @brief Draw command, without the user callbacks.
+ */
+struct RecordedCommand {
+	/// Clipping rectangle.
+	ImVec4 clipRect;
+	/// Texture reference (0: not recorded, the renderer user textures).
+	uint32_t texture = 0;
+	/// First vertex.
+	uint32_t vertexOffset = 0;
+	/// First index.
+	uint32_t indexOffset = 0;
+	/// Number of indices.
+	uint32_t elementCount = 0;
+};
+
+/**
+ * @brief Draw list.
+ */
+struct RecordedList {
+	/// Vertices.
+	std::vector<ImDrawVert> vertices;
+	/// Indices.
+	std::vector<ImDrawIdx> indices;
+	/// Commands.
+	std::vector<RecordedCommand> commands;
+};
+
+/**
+ * @brief Draw data of one frame, with the textures updated before it.
+ */
+struct RecordedFrame {
+	/// Top left of the display.
+	ImVec2 displayPos;
+	/// Display size.
+	ImVec2 displaySize;
+	/// Framebuffer scale.
+	ImVec2 framebufferScale;
+	/// Draw lists.
+	std::vector<RecordedList> lists;
+	/// Textures created or updated before the frame.
+	std::vector<RecordedTexture> textures;
+};
+
+/**
+ * @brief Serialize the draw data of the frames into a compact binary file.
+ *
+ * The file starts with a header, followed by chunks: textures (full content, each time the renderer
+ * would upload it) and frames (draw lists with their commands, vertices and indices). The managed
+ * textures are recorded the first time they are used and each time they change; the renderer user
+ * textures (render targets, images) are only referenced.
+ */
+class DrawDataRecorder final {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	DrawDataRecorder();
+	/**
+	 * @brief Destructor, close the file.
+	 */
+	~DrawDataRecorder();
+
+	DrawDataRecorder(const DrawDataRecorder&) = delete;
+	DrawDataRecorder(DrawDataRecorder&&) = delete;
+	auto operator=(const DrawDataRecorder&) -> DrawDataRecorder& = delete;
+	auto operator=(DrawDataRecorder&&) -> DrawDataRecorder& = delete;
+
+	/**
+	 * @brief Start a new recording.
+	 * @param[in] iPath The file path.
+	 * @return True if the file is open.
+	 */
+	[[nodiscard]] auto open(const std::filesystem::path& iPath) -> bool;
+	/**
+	 * @brief Stop the recording.
+	 */
+	void close();
+	/**
+	 * @brief Check if recording.
+	 * @return True if a file is open.
+	 */
+	[[nodiscard]] auto isOpen() const -> bool { return m_stream.is_open(); }
+	/**
+	 * @brief Append the draw data of a frame, before it is rendered.
+	 * @param[in] iDrawData The draw data.
+	 */
+	void record(const ImDrawData& iDrawData);
+	/**
+	 * @brief Get the number of recorded frames.
+	 * @return The number of frames.
+	 */
+	[[nodiscard]] auto getFrameCount() const -> uint64_t { return m_frameCount; }
+	/**
+	 * @brief Get the number of written bytes.
+	 * @return The file size.
+	 */
+	[[nodiscard]] auto getSize() const -> uint64_t { return m_size; }
+
+	/**
+	 * @brief Read a recording.
+	 * @param[in] iPath The file path.
+	 * @param[out] oFrames The frames.
+	 * @return True if the file could be read.
+	 */
+	[[nodiscard]] static auto load(const std::filesystem::path& iPath, std::vector<RecordedFrame>& oFrames) -> bool;
+
+private:
+	/**
+	 * @brief Get the reference of a texture.
+	 * @param[in] iTexture The texture.
+	 * @return The reference.
+	 */
+	[[nodiscard]] auto reference(const ImTextureRef& iTexture) -> uint32_t;
+	/**
+	 * @brief Write a chunk.
+	 * @param[in] iTag The chunk type.
+	 * @param[in] iPayload The chunk content.
+	 */
+	void writeChunk(uint32_t iTag, const std::vector<uint8_t>& iPayload);
+
+	/// The output stream.
+	std::ofstream m_stream;
+	/// References of the managed textures, by unique id.
+	std::unordered_map<int, uint32_t> m_textures;
+	/// Next texture reference.
+	uint32_t m_nextTexture = 1;
+	/// Chunk buffer.
+	std::vector<uint8_t> m_buffer;
+	/// Recorded frames.
+	uint64_t m_frameCount = 0;
+	/// Written bytes.
+	uint64_t m_size = 0;
+};
+
+}// namespace mvi::core::capture
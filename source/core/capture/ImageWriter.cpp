@@ -0,0 +1,339 @@
+/**
+ * @file ImageWriter.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ImageWriter.h"
+
+#include "core/Log.h"
+
+#include <cstring>
+
+namespace mvi::core::capture {
+
+namespace {
+
+/// Deflate window size.
+constexpr size_t g_windowSize = 32768;
+/// Shortest deflate match.
+constexpr size_t g_minMatch = 3;
+/// Longest deflate match.
+constexpr size_t g_maxMatch = 258;
+/// Size of the match finder table (log2).
+constexpr uint32_t g_hashBits = 15;
+/// Candidates visited per position.
+constexpr uint32_t g_maxChain = 16;
+
+/// Deflate length codes: base lengths.
+constexpr std::array<uint16_t, 29> g_lengthBase = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+												   31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+/// Deflate length codes: extra bits.
+constexpr std::array<uint8_t, 29> g_lengthExtra = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+												   2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+/// Deflate distance codes: base distances.
+constexpr std::array<uint16_t, 30> g_distanceBase = {1,	2,	  3,	4,	  5,	7,	  9,	13,	   17,	  25,
+													 33,   49,	  65,	97,	  129,	193,  257,	385,   513,	  769,
+													 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+/// Deflate distance codes: extra bits.
+constexpr std::array<uint8_t, 30> g_distanceExtra = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+													 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+/**
+ * @brief LSB first bit stream, as used by deflate.
+ */
+class BitWriter {
+public:
+	explicit BitWriter(std::vector<uint8_t>& ioOutput) : m_output{ioOutput} {}
+	void write(const uint32_t iBits, const uint32_t iCount) {
+		m_buffer |= static_cast<uint64_t>(iBits) << m_count;
+		m_count += iCount;
+		while (m_count >= 8) {
+			m_output.push_back(static_cast<uint8_t>(m_buffer & 0xffu));
+			m_buffer >>= 8u;
+			m_count -= 8;
+		}
+	}
+	/// Huffman codes are stored most significant bit first.
+	void writeCode(const uint32_t iCode, const uint32_t iLength) {
+		uint32_t reversed = 0;
+		for (uint32_t bit = 0; bit < iLength; ++bit) reversed |= ((iCode >> bit) & 1u) << (iLength - 1 - bit);
+		write(reversed, iLength);
+	}
+	void flush() {
+		if (m_count > 0)
+			m_output.push_back(static_cast<uint8_t>(m_buffer & 0xffu));
+		m_buffer = 0;
+		m_count = 0;
+	}
+
+private:
+	std::vector<uint8_t>& m_output;
+	uint64_t m_buffer = 0;
+	uint32_t m_count = 0;
+};
+
+void writeLiteral(BitWriter& ioBits, const uint32_t iSymbol) {
+	if (iSymbol < 144)
+		ioBits.writeCode(0x30 + iSymbol, 8);
+	else if (iSymbol < 256)
+		ioBits.writeCode(0x190 + iSymbol - 144, 9);
+	else if (iSymbol < 280)
+		ioBits.writeCode(iSymbol - 256, 7);
+	else
+		ioBits.writeCode(0xc0 + iSymbol - 280, 8);
+}
+
+void writeMatch(BitWriter& ioBits, const size_t iLength, const size_t iDistance) {
+	size_t code = g_lengthBase.size() - 1;
+	while (g_lengthBase[code] > iLength) --code;
+	writeLiteral(ioBits, static_cast<uint32_t>(257 + code));
+	ioBits.write(static_cast<uint32_t>(iLength - g_lengthBase[code]), g_lengthExtra[code]);
+	code = g_distanceBase.size() - 1;
+	while (g_distanceBase[code] > iDistance) --code;
+	ioBits.writeCode(static_cast<uint32_t>(code), 5);
+	ioBits.write(static_cast<uint32_t>(iDistance - g_distanceBase[code]), g_distanceExtra[code]);
+}
+
+auto hash3(const uint8_t* iPtr) -> uint32_t {
+	const uint32_t value = static_cast<uint32_t>(iPtr[0]) | static_cast<uint32_t>(iPtr[1]) << 8u |
+						   static_cast<uint32_t>(iPtr[2]) << 16u;
+	return (value * 2654435761u) >> (32u - g_hashBits);
+}
+
+auto adler32(const std::span<const uint8_t> iData) -> uint32_t {
+	uint32_t a = 1;
+	uint32_t b = 0;
+	size_t index = 0;
+	while (index < iData.size()) {
+		// Largest block keeping the sums below 2^32.
+		const size_t end = std::min(iData.size(), index + 5552);
+		for (; index < end; ++index) {
+			a += iData[index];
+			b += a;
+		}
+		a %= 65521;
+		b %= 65521;
+	}
+	return b << 16u | a;
+}
+
+/**
+ * @brief Compress to a zlib stream: a single fixed Huffman deflate block.
+ */
+auto zlibCompress(const std::span<const uint8_t> iData) -> std::vector<uint8_t> {
+	std::vector<uint8_t> output;
+	output.reserve(iData.size() / 4 + 64);
+	output.push_back(0x78);
+	output.push_back(0x01);
+	BitWriter bits(output);
+	bits.write(1, 1);// final block
+	bits.write(1, 2);// fixed Huffman codes
+	std::vector<int64_t> head(size_t{1} << g_hashBits, -1);
+	std::vector<int64_t> previous(g_windowSize, -1);
+	const size_t size = iData.size();
+	const auto insert = [&](const size_t iPos) {
+		const uint32_t key = hash3(iData.data() + iPos);
+		previous[iPos % g_windowSize] = head[key];
+		head[key] = static_cast<int64_t>(iPos);
+	};
+	size_t pos = 0;
+	while (pos < size) {
+		size_t bestLength = 0;
+		size_t bestDistance = 0;
+		if (pos + g_minMatch <= size) {
+			const size_t maxLength = std::min(g_maxMatch, size - pos);
+			int64_t candidate = head[hash3(iData.data() + pos)];
+			for (uint32_t chain = 0; chain < g_maxChain && candidate >= 0; ++chain) {
+				const auto from = static_cast<size_t>(candidate);
+				if (pos - from > g_windowSize - 1)
+					break;
+				size_t length = 0;
+				while (length < maxLength && iData[from + length] == iData[pos + length]) ++length;
+				if (length > bestLength) {
+					bestLength = length;
+					bestDistance = pos - from;
+					if (length == maxLength)
+						break;
+				}
+				candidate = previous[from % g_windowSize];
+			}
+		}
+		if (bestLength >= g_minMatch) {
+			writeMatch(bits, bestLength, bestDistance);
+			const size_t end = pos + bestLength;
+			for (; pos < end; ++pos) {
+				if (pos + g_minMatch <= size)
+					insert(pos);
+			}
+		} else {
+			writeLiteral(bits, iData[pos]);
+			if (pos + g_minMatch <= size)
+				insert(pos);
+			++pos;
+		}
+	}
+	writeLiteral(bits, 256);
+	bits.flush();
+	const uint32_t checksum = adler32(iData);
+	for (uint32_t shift = 24;; shift -= 8) {
+		output.push_back(static_cast<uint8_t>(checksum >> shift));
+		if (shift == 0)
+			break;
+	}
+	return output;
+}
+
+auto crc32(const std::span<const uint8_t> iData, uint32_t iCrc = 0) -> uint32_t {
+	static const auto table = [] {
+		std::array<uint32_t, 256> result{};
+		for (uint32_t index = 0; index < 256; ++index) {
+			uint32_t value = index;
+			for (uint32_t bit = 0; bit < 8; ++bit) value = (value & 1u) != 0 ? 0xedb88320u ^ (value >> 1u) : value >> 1u;
+			result[index] = value;
+		}
+		return result;
+	}();
+	iCrc = ~iCrc;
+	for (const uint8_t byte: iData) iCrc = table[(iCrc ^ byte) & 0xffu] ^ (iCrc >> 8u);
+	return ~iCrc;
+}
+
+void appendBigEndian(std::vector<uint8_t>& ioOutput, const uint32_t iValue) {
+	ioOutput.push_back(static_cast<uint8_t>(iValue >> 24u));
+	ioOutput.push_back(static_cast<uint8_t>(iValue >> 16u));
+	ioOutput.push_back(static_cast<uint8_t>(iValue >> 8u));
+	ioOutput.push_back(static_cast<uint8_t>(iValue));
+}
+
+void appendChunk(std::vector<uint8_t>& ioOutput, const std::string_view iType, const std::span<const uint8_t> iData) {
+	appendBigEndian(ioOutput, static_cast<uint32_t>(iData.size()));
+	const size_t start = ioOutput.size();
+	ioOutput.insert(ioOutput.end(), iType.begin(), iType.end());
+	ioOutput.insert(ioOutput.end(), iData.begin(), iData.end());
+	appendBigEndian(ioOutput, crc32({ioOutput.data() + start, ioOutput.size() - start}));
+}
+
+}// namespace
+
+auto writePng(const std::filesystem::path& iPath, const Image& iImage) -> bool {
+	const size_t rowSize = static_cast<size_t>(iImage.width) * 3;
+	if (iImage.width == 0 || iImage.height == 0 ||
+		iImage.pixels.size() < static_cast<size_t>(iImage.width) * iImage.height * 4)
+		return false;
+	const size_t red = iImage.bgra ? 2 : 0;
+	const size_t blue = iImage.bgra ? 0 : 2;
+	// Filtered scan lines: 'Up' filter byte, then RGB deltas to the previous row.
+	std::vector<uint8_t> filtered((rowSize + 1) * iImage.height);
+	std::vector<uint8_t> previous(rowSize, 0);
+	std::vector<uint8_t> current(rowSize);
+	for (uint32_t y = 0; y < iImage.height; ++y) {
+		const uint8_t* source = iImage.pixels.data() + static_cast<size_t>(y) * iImage.width * 4;
+		for (uint32_t x = 0; x < iImage.width; ++x) {
+			current[x * 3 + 0] = source[x * 4 + red];
+			current[x * 3 + 1] = source[x * 4 + 1];
+			current[x * 3 + 2] = source[x * 4 + blue];
+		}
+		uint8_t* line = filtered.data() + y * (rowSize + 1);
+		line[0] = 2;
+		for (size_t index = 0; index < rowSize; ++index)
+			line[index + 1] = static_cast<uint8_t>(current[index] - previous[index]);
+		std::swap(previous, current);
+	}
+
+	std::vector<uint8_t> file = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+	std::vector<uint8_t> header;
+	appendBigEndian(header, iImage.width);
+	appendBigEndian(header, iImage.height);
+	header.insert(header.end(), {8, 2, 0, 0, 0});// 8 bits, RGB, deflate, adaptive filter, no interlace
+	appendChunk(file, "IHDR", header);
+	appendChunk(file, "IDAT", zlibCompress(filtered));
+	appendChunk(file, "IEND", {});
+
+	std::ofstream stream(iPath, std::ios::binary);
+	if (!stream) {
+		log_error("Unable to write image '{}'.", iPath.string());
+		return false;
+	}
+	stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+	return stream.good();
+}
+
+Y4mWriter::Y4mWriter() = default;
+
+Y4mWriter::~Y4mWriter() { close(); }
+
+auto Y4mWriter::open(const std::filesystem::path& iPath, const uint32_t iWidth, const uint32_t iHeight,
+					 const uint32_t iFrameRate) -> bool {
+	close();
+	m_stream.open(iPath, std::ios::binary);
+	if (!m_stream) {
+		log_error("Unable to open video stream '{}'.", iPath.string());
+		return false;
+	}
+	m_width = iWidth;
+	m_height = iHeight;
+	m_frameCount = 0;
+	m_stream << std::format("YUV4MPEG2 W{} H{} F{}:1 Ip A1:1 C420jpeg\n", m_width, m_height, iFrameRate);
+	return m_stream.good();
+}
+
+void Y4mWriter::close() {
+	if (m_stream.is_open())
+		m_stream.close();
+	m_planes.clear();
+	m_planes.shrink_to_fit();
+}
+
+auto Y4mWriter::append(const Image& iImage) -> bool {
+	if (!isOpen() || iImage.width != m_width || iImage.height != m_height ||
+		iImage.pixels.size() < static_cast<size_t>(m_width) * m_height * 4)
+		return false;
+	const size_t chromaWidth = (m_width + 1) / 2;
+	const size_t chromaHeight = (m_height + 1) / 2;
+	const size_t lumaSize = static_cast<size_t>(m_width) * m_height;
+	const size_t chromaSize = chromaWidth * chromaHeight;
+	m_planes.resize(lumaSize + 2 * chromaSize);
+	uint8_t* luma = m_planes.data();
+	uint8_t* cb = luma + lumaSize;
+	uint8_t* cr = cb + chromaSize;
+	const size_t red = iImage.bgra ? 2 : 0;
+	const size_t blue = iImage.bgra ? 0 : 2;
+	const auto pixel = [&](const size_t iX, const size_t iY) -> const uint8_t* {
+		return iImage.pixels.data() + (std::min<size_t>(iY, m_height - 1) * m_width + std::min<size_t>(iX, m_width - 1)) * 4;
+	};
+	// Fixed point full range BT.601 (JFIF).
+	for (size_t y = 0; y < m_height; ++y) {
+		for (size_t x = 0; x < m_width; ++x) {
+			const uint8_t* p = pixel(x, y);
+			luma[y * m_width + x] =
+					static_cast<uint8_t>((19595 * p[red] + 38470 * p[1] + 7471 * p[blue] + 32768) >> 16);
+		}
+	}
+	for (size_t y = 0; y < chromaHeight; ++y) {
+		for (size_t x = 0; x < chromaWidth; ++x) {
+			int32_t r = 0;
+			int32_t g = 0;
+			int32_t b = 0;
+			for (const auto& [dx, dy]: {std::pair{0, 0}, {1, 0}, {0, 1}, {1, 1}}) {
+				const uint8_t* p = pixel(x * 2 + static_cast<size_t>(dx), y * 2 + static_cast<size_t>(dy));
+				r += p[red];
+				g += p[1];
+				b += p[blue];
+			}
+			cb[y * chromaWidth + x] = static_cast<uint8_t>(
+					std::clamp((-11059 * r - 21709 * g + 32768 * b + (128 << 18) + (1 << 17)) >> 18, 0, 255));
+			cr[y * chromaWidth + x] = static_cast<uint8_t>(
+					std::clamp((32768 * r - 27439 * g - 5329 * b + (128 << 18) + (1 << 17)) >> 18, 0, 255));
+		}
+	}
+	m_stream << "FRAME\n";
+	m_stream.write(reinterpret_cast<const char*>(m_planes.data()), static_cast<std::streamsize>(m_planes.size()));
+	++m_frameCount;
+	return m_stream.good();
+}
+
+}// namespace mvi::core::capture
@@ -0,0 +1,117 @@
+/**
+ * @file ImageWriter.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace mvi::core::capture {
+
+/**
+ * @brief Captured image: 4 bytes per pixel, rows tightly packed.
+ */
+struct Image {
+	/// Image width.
+	uint32_t width = 0;
+	/// Image height.
+	uint32_t height = 0;
+	/// If the channels are stored as BGRA instead of RGBA.
+	bool bgra = false;
+	/// The pixels.
+	std::vector<uint8_t> pixels;
+};
+
+/**
+ * @brief Write an image as a PNG file (RGB, alpha dropped).
+ *
+ * Rows use the 'Up' filter and the stream is deflated with the fixed Huffman codes: fast enough for
+ * a background thread and well suited to flat UI content.
+ *
+ * @param[in] iPath The file path.
+ * @param[in] iImage The image.
+ * @return True if the file was written.
+ */
+[[nodiscard]] auto writePng(const std::filesystem::path& iPath, const Image& iImage) -> bool;
+
+/**
+ * @brief Raw YUV4MPEG2 stream writer (4:2:0, full range BT.601).
+ */
+class Y4mWriter final {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	Y4mWriter();
+	/**
+	 * @brief Destructor, close the stream.
+	 */
+	~Y4mWriter();
+
+	Y4mWriter(const Y4mWriter&) = delete;
+	Y4mWriter(Y4mWriter&&) = delete;
+	auto operator=(const Y4mWriter&) -> Y4mWriter& = delete;
+	auto operator=(Y4mWriter&&) -> Y4mWriter& = delete;
+
+	/**
+	 * @brief Start a new stream.
+	 * @param[in] iPath The file path.
+	 * @param[in] iWidth The frame width.
+	 * @param[in] iHeight The frame height.
+	 * @param[in] iFrameRate The nominal frame rate.
+	 * @return True if the stream is open.
+	 */
+	[[nodiscard]] auto open(const std::filesystem::path& iPath, uint32_t iWidth, uint32_t iHeight,
+							uint32_t iFrameRate) -> bool;
+	/**
+	 * @brief Close the stream.
+	 */
+	void close();
+	/**
+	 * @brief Check if a stream is open.
+	 * @return True if open.
+	 */
+	[[nodiscard]] auto isOpen() const -> bool { return m_stream.is_open(); }
+	/**
+	 * @brief Append a frame, which must have the stream dimensions.
+	 * @param[in] iImage The frame.
+	 * @return True if the frame was written.
+	 */
+	[[nodiscard]] auto append(const Image& iImage) -> bool;
+	/**
+	 * @brief Get the frame width.
+	 * @return The frame width.
+	 */
+	[[nodiscard]] auto getWidth() const -> uint32_t { return m_width; }
+	/**
+	 * @brief Get the frame height.
+	 * @return The frame height.
+	 */
+	[[nodiscard]] auto getHeight() const -> uint32_t { return m_height; }
+	/**
+	 * @brief Get the number of written frames.
+	 * @return The number of frames.
+	 */
+	[[nodiscard]] auto getFrameCount() const -> uint64_t { return m_frameCount; }
+
+private:
+	/// The output stream.
+	std::ofstream m_stream;
+	/// Frame width.
+	uint32_t m_width = 0;
+	/// Frame height.
+	uint32_t m_height = 0;
+	/// Written frames.
+	uint64_t m_frameCount = 0;
+	/// Conversion buffer (Y, U then V planes).
+	std::vector<uint8_t> m_planes;
+};
+
+}// namespace mvi::core::capture
@@ -0,0 +1,99 @@
+/**
+ * @file Scheduler.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Scheduler.h"
+
+#include "core/MainThreadDispatcher.h"
+
+#include <fstream>
+
+namespace mvi::core::coro {
+
+Scheduler* Scheduler::m_instance = nullptr;
+
+Scheduler::Scheduler(MainThreadDispatcher& iDispatcher, jobs::JobSystem& iJobs)
+	: m_dispatcher{iDispatcher}, m_jobs{iJobs}, m_mainThread{std::this_thread::get_id()} {
+	m_instance = this;
+}
+
+Scheduler::~Scheduler() {
+	// Nothing resumes the coroutines still waiting: the abandoned ones are destroyed now, the others with their
+	// task, which may outlive the scheduler.
+	for (auto* promise: m_nextFrame) promise->detach();
+	for (const auto& waiting: m_conditions) waiting.promise->detach();
+	m_instance = nullptr;
+}
+
+void Scheduler::resumeFrame() {
+	{
+		std::scoped_lock lock(m_mutex);
+		m_resuming.swap(m_nextFrame);
+		m_checking.swap(m_conditions);
+	}
+	// The coroutines suspending again go to the lists of the next frame.
+	for (auto* promise: m_resuming) promise->resume();
+	m_resumed += m_resuming.size();
+	m_resuming.clear();
+	std::erase_if(m_checking, [this](const Waiting& iWaiting) -> bool {
+		// The condition of an abandoned coroutine may use its destroyed owner.
+		if (!iWaiting.promise->isAbandoned() && !iWaiting.condition())
+			return false;
+		iWaiting.promise->resume();
+		++m_resumed;
+		return true;
+	});
+	std::scoped_lock lock(m_mutex);
+	m_conditions.insert(m_conditions.end(), std::make_move_iterator(m_checking.begin()),
+						std::make_move_iterator(m_checking.end()));
+	m_checking.clear();
+}
+
+void Scheduler::resumeNextFrame(PromiseBase& ioPromise) {
+	std::scoped_lock lock(m_mutex);
+	m_nextFrame.push_back(&ioPromise);
+}
+
+void Scheduler::resumeOnMainThread(PromiseBase& ioPromise) {
+	m_dispatcher.post([promise = &ioPromise]() -> void { promise->resume(); });
+}
+
+void Scheduler::resumeInBackground(PromiseBase& ioPromise, const jobs::Priority iPriority) {
+	std::ignore = m_jobs.submit([promise = &ioPromise]() -> void { promise->resume(); }, iPriority);
+}
+
+void Scheduler::resumeWhen(PromiseBase& ioPromise, std::function<bool()> iCondition) {
+	std::scoped_lock lock(m_mutex);
+	m_conditions.push_back({.promise = &ioPromise, .condition = std::move(iCondition)});
+}
+
+void Scheduler::resumeAfter(PromiseBase& ioPromise, const jobs::JobHandle& iJob) {
+	std::ignore = m_jobs.submit([this, promise = &ioPromise]() -> void { resumeOnMainThread(*promise); },
+								jobs::Priority::Critical, std::span(&iJob, 1));
+}
+
+auto Scheduler::getStats() const -> Stats {
+	std::scoped_lock lock(m_mutex);
+	return {.resumed = m_resumed, .waitingFrame = m_nextFrame.size(), .waitingCondition = m_conditions.size()};
+}
+
+auto readFile(std::filesystem::path iPath) -> Task<std::vector<uint8_t>> {
+	co_await background(jobs::Priority::Io);
+	std::vector<uint8_t> data;
+	if (std::ifstream file(iPath, std::ios::binary | std::ios::ate); file) {
+		data.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+		if (!file)
+			data.clear();
+	}
+	co_await mainThread();
+	co_return data;
+}
+
+}// namespace mvi::core::coro
@@ -0,0 +1,324 @@
+/**
+ * @file Scheduler.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Task.h"
+#include "core/jobs/JobSystem.h"
+#include "core/vulkan/ComputeQueue.h"
+
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mvi::core {
+class MainThreadDispatcher;
+}// namespace mvi::core
+
+namespace mvi::core::coro {
+
+/**
+ * @brief Resume the suspended coroutines, on the main thread, the workers or after a condition.
+ *
+ * The coroutines waiting for the next frame or for a condition are resumed by resumeFrame(), called once per
+ * frame by the application loop before the views update. The ones going back to the main thread are resumed
+ * with the tasks posted to the main thread, dispatched just before.
+ */
+class Scheduler final {
+public:
+	/**
+	 * @brief Scheduler statistics.
+	 */
+	struct Stats {
+		/// Coroutines resumed by the frames since start.
+		uint64_t resumed = 0;
+		/// Coroutines waiting for the next frame.
+		size_t waitingFrame = 0;
+		/// Coroutines waiting for a condition.
+		size_t waitingCondition = 0;
+	};
+
+	/**
+	 * @brief Constructor, on the main thread.
+	 * @param[in] iDispatcher The dispatcher of the main thread.
+	 * @param[in] iJobs The job system.
+	 */
+	Scheduler(MainThreadDispatcher& iDispatcher, jobs::JobSystem& iJobs);
+	/**
+	 * @brief Destructor, destroy the waiting coroutines whose task is gone.
+	 */
+	~Scheduler();
+
+	Scheduler(const Scheduler&) = delete;
+	Scheduler(Scheduler&&) = delete;
+	auto operator=(const Scheduler&) -> Scheduler& = delete;
+	auto operator=(Scheduler&&) -> Scheduler& = delete;
+
+	/**
+	 * @brief Get the scheduler instance.
+	 * @return The scheduler.
+	 */
+	static auto get() -> Scheduler& { return *m_instance; }
+
+	/**
+	 * @brief Resume the coroutines waiting for this frame and the ones whose condition is met (main thread).
+	 */
+	void resumeFrame();
+	/**
+	 * @brief Check if the calling thread is the main one.
+	 * @return True on the main thread.
+	 */
+	[[nodiscard]] auto isMainThread() const -> bool { return std::this_thread::get_id() == m_mainThread; }
+
+	/**
+	 * @brief Resume a coroutine at the next frame.
+	 * @param[in,out] ioPromise The coroutine.
+	 */
+	void resumeNextFrame(PromiseBase& ioPromise);
+	/**
+	 * @brief Resume a coroutine on the main thread.
+	 * @param[in,out] ioPromise The coroutine.
+	 */
+	void resumeOnMainThread(PromiseBase& ioPromise);
+	/**
+	 * @brief Resume a coroutine in a job.
+	 * @param[in,out] ioPromise The coroutine.
+	 * @param[in] iPriority The job priority.
+	 */
+	void resumeInBackground(PromiseBase& ioPromise, jobs::Priority iPriority);
+	/**
+	 * @brief Resume a coroutine on the main thread once a condition is met, checked at each frame.
+	 * @param[in,out] ioPromise The coroutine.
+	 * @param[in] iCondition The condition, checked on the main thread.
+	 */
+	void resumeWhen(PromiseBase& ioPromise, std::function<bool()> iCondition);
+	/**
+	 * @brief Resume a coroutine on the main thread once a job is done.
+	 * @param[in,out] ioPromise The coroutine.
+	 * @param[in] iJob The job.
+	 */
+	void resumeAfter(PromiseBase& ioPromise, const jobs::JobHandle& iJob);
+
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> Stats;
+
+private:
+	/**
+	 * @brief Coroutine waiting for a condition.
+	 */
+	struct Waiting {
+		/// The coroutine.
+		PromiseBase* promise = nullptr;
+		/// The condition.
+		std::function<bool()> condition;
+	};
+
+	/// The scheduler Instance.
+	static Scheduler* m_instance;
+	/// The dispatcher of the main thread.
+	MainThreadDispatcher& m_dispatcher;
+	/// The job system.
+	jobs::JobSystem& m_jobs;
+	/// The main thread.
+	std::thread::id m_mainThread;
+	/// Protect the waiting lists, the coroutines may suspend on any thread.
+	mutable std::mutex m_mutex;
+	/// Coroutines waiting for the next frame.
+	std::vector<PromiseBase*> m_nextFrame;
+	/// Coroutines waiting for a condition.
+	std::vector<Waiting> m_conditions;
+	/// Lists being resumed.
+	std::vector<PromiseBase*> m_resuming;
+	/// Conditions being checked.
+	std::vector<Waiting> m_checking;
+	/// Coroutines resumed by the frames.
+	uint64_t m_resumed = 0;
+};
+
+/**
+ * @brief Awaiter suspending the coroutine until the next frame.
+ */
+struct FrameAwaiter {
+	/**
+	 * @brief Check if the awaiter is ready.
+	 * @return Always false.
+	 */
+	[[nodiscard]] auto await_ready() const -> bool { return false; }
+	/**
+	 * @brief Register the coroutine for the next frame.
+	 * @tparam P The promise type.
+	 * @param[in] iHandle The coroutine.
+	 */
+	template<typename P>
+	void await_suspend(std::coroutine_handle<P> iHandle) const {
+		Scheduler::get().resumeNextFrame(iHandle.promise());
+	}
+	/**
+	 * @brief Nothing to resume.
+	 */
+	void await_resume() const {}
+};
+
+/**
+ * @brief Awaiter moving the coroutine to a job.
+ */
+struct BackgroundAwaiter {
+	/// The job priority.
+	jobs::Priority priority = jobs::Priority::Background;
+
+	/**
+	 * @brief Check if the awaiter is ready.
+	 * @return Always false.
+	 */
+	[[nodiscard]] auto await_ready() const -> bool { return false; }
+	/**
+	 * @brief Submit the job resuming the coroutine.
+	 * @tparam P The promise type.
+	 * @param[in] iHandle The coroutine.
+	 */
+	template<typename P>
+	void await_suspend(std::coroutine_handle<P> iHandle) const {
+		Scheduler::get().resumeInBackground(iHandle.promise(), priority);
+	}
+	/**
+	 * @brief Nothing to resume.
+	 */
+	void await_resume() const {}
+};
+
+/**
+ * @brief Awaiter moving the coroutine to the main thread.
+ */
+struct MainThreadAwaiter {
+	/**
+	 * @brief Check if already on the main thread.
+	 * @return True on the main thread.
+	 */
+	[[nodiscard]] auto await_ready() const -> bool { return Scheduler::get().isMainThread(); }
+	/**
+	 * @brief Post the resumption to the main thread.
+	 * @tparam P The promise type.
+	 * @param[in] iHandle The coroutine.
+	 */
+	template<typename P>
+	void await_suspend(std::coroutine_handle<P> iHandle) const {
+		Scheduler::get().resumeOnMainThread(iHandle.promise());
+	}
+	/**
+	 * @brief Nothing to resume.
+	 */
+	void await_resume() const {}
+};
+
+/**
+ * @brief Awaiter suspending the coroutine until a condition is met.
+ */
+struct ConditionAwaiter {
+	/// The condition, checked on the main thread.
+	std::function<bool()> condition;
+
+	/**
+	 * @brief Check the condition, only on the main thread.
+	 * @return True if met.
+	 */
+	[[nodiscard]] auto await_ready() const -> bool { return Scheduler::get().isMainThread() && condition(); }
+	/**
+	 * @brief Register the condition.
+	 * @tparam P The promise type.
+	 * @param[in] iHandle The coroutine.
+	 */
+	template<typename P>
+	void await_suspend(std::coroutine_handle<P> iHandle) {
+		Scheduler::get().resumeWhen(iHandle.promise(), std::move(condition));
+	}
+	/**
+	 * @brief Nothing to resume.
+	 */
+	void await_resume() const {}
+};
+
+/**
+ * @brief Awaiter suspending the coroutine until a job is done.
+ */
+struct JobAwaiter {
+	/// The job.
+	jobs::JobHandle job;
+
+	/**
+	 * @brief Check if the job is done, only on the main thread.
+	 * @return True if done.
+	 */
+	[[nodiscard]] auto await_ready() const -> bool {
+		return Scheduler::get().isMainThread() && jobs::JobSystem::isDone(job);
+	}
+	/**
+	 * @brief Register the coroutine after the job.
+	 * @tparam P The promise type.
+	 * @param[in] iHandle The coroutine.
+	 */
+	template<typename P>
+	void await_suspend(std::coroutine_handle<P> iHandle) const {
+		Scheduler::get().resumeAfter(iHandle.promise(), job);
+	}
+	/**
+	 * @brief Nothing to resume.
+	 */
+	void await_resume() const {}
+};
+
+/**
+ * @brief Suspend until the next frame, resuming on the main thread.
+ * @return The awaiter.
+ */
+inline auto nextFrame() -> FrameAwaiter { return {}; }
+/**
+ * @brief Continue in a job of the job system.
+ * @param[in] iPriority The job priority, Io for blocking operations.
+ * @return The awaiter.
+ */
+inline auto background(const jobs::Priority iPriority = jobs::Priority::Background) -> BackgroundAwaiter {
+	return {.priority = iPriority};
+}
+/**
+ * @brief Continue on the main thread.
+ * @return The awaiter.
+ */
+inline auto mainThread() -> MainThreadAwaiter { return {}; }
+/**
+ * @brief Suspend until a condition is met, checked once per frame, resuming on the main thread.
+ * @param[in] iCondition The condition.
+ * @return The awaiter.
+ */
+inline auto until(std::function<bool()> iCondition) -> ConditionAwaiter { return {.condition = std::move(iCondition)}; }
+/**
+ * @brief Suspend until a job is done, resuming on the main thread.
+ * @param[in] iJob The job.
+ * @return The awaiter.
+ */
+inline auto job(jobs::JobHandle iJob) -> JobAwaiter { return {.job = std::move(iJob)}; }
+/**
+ * @brief Suspend until a GPU compute job is done, resuming on the main thread.
+ * @param[in] iResult The result of the compute job.
+ * @return The awaiter.
+ */
+inline auto gpu(vulkan::ComputeResult iResult) -> ConditionAwaiter {
+	return {.condition = [result = std::move(iResult)]() -> bool { return !result.isValid() || result.isReady(); }};
+}
+/**
+ * @brief Read a file on a blocking job worker, resuming on the main thread.
+ * @param[in] iPath The file path.
+ * @return The file content, empty if not readable.
+ */
+auto readFile(std::filesystem::path iPath) -> Task<std::vector<uint8_t>>;
+
+}// namespace mvi::core::coro
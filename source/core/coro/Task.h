@@ -0,0 +1,314 @@
+/**
+ * @file Task.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace mvi::core::coro {
+
+/**
+ * @brief Promise part common to all the tasks, resuming and destroying the coroutine.
+ */
+class PromiseBase {
+public:
+	/**
+	 * @brief Coroutine states.
+	 */
+	enum class State : uint8_t {
+		Running,///< Running or suspended, owned by its task.
+		Done,///< Finished, waiting for its task destruction.
+		Abandoned,///< Task destroyed before the end, to destroy at the next resumption.
+		Detached,///< Suspended with nothing left to resume it, destroyed with its task.
+	};
+
+	/**
+	 * @brief Awaiter of the end of the coroutine.
+	 */
+	struct FinalAwaiter {
+		/**
+		 * @brief Check if the awaiter is ready.
+		 * @return Always false.
+		 */
+		[[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+		/**
+		 * @brief Mark the coroutine done and resume the awaiting one.
+		 * @tparam P The promise type.
+		 * @param[in] iHandle The finishing coroutine.
+		 */
+		template<typename P>
+		void await_suspend(std::coroutine_handle<P> iHandle) noexcept {
+			PromiseBase& promise = iHandle.promise();
+			// The completion mark must be set before the task may destroy the promise.
+			PromiseBase* continuation = promise.m_continuation.exchange(&promise, std::memory_order_acq_rel);
+			if (promise.m_state.exchange(State::Done, std::memory_order_acq_rel) == State::Abandoned)
+				iHandle.destroy();
+			if (continuation != nullptr)
+				continuation->resume();
+		}
+		/**
+		 * @brief Nothing to resume.
+		 */
+		void await_resume() const noexcept {}
+	};
+
+	/**
+	 * @brief Start the coroutine at its creation.
+	 * @return The initial awaiter.
+	 */
+	[[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_never { return {}; }
+	/**
+	 * @brief Suspend the coroutine at its end, until its task is destroyed.
+	 * @return The final awaiter.
+	 */
+	[[nodiscard]] auto final_suspend() const noexcept -> FinalAwaiter { return {}; }
+	/**
+	 * @brief Keep the exception for the awaiting coroutine.
+	 */
+	void unhandled_exception() noexcept { m_exception = std::current_exception(); }
+
+	/**
+	 * @brief Resume the coroutine, or destroy it if abandoned.
+	 */
+	void resume() {
+		if (m_state.load(std::memory_order_acquire) == State::Abandoned)
+			m_self.destroy();
+		else
+			m_self.resume();
+	}
+	/**
+	 * @brief Check if the coroutine is finished.
+	 * @return True if done.
+	 */
+	[[nodiscard]] auto isDone() const -> bool { return m_state.load(std::memory_order_acquire) == State::Done; }
+	/**
+	 * @brief Check if the task of the coroutine is destroyed.
+	 * @return True if abandoned.
+	 */
+	[[nodiscard]] auto isAbandoned() const -> bool {
+		return m_state.load(std::memory_order_acquire) == State::Abandoned;
+	}
+	/**
+	 * @brief Release the coroutine from its task: destroy it if done, else at its next resumption.
+	 */
+	void abandon() {
+		if (const State state = m_state.exchange(State::Abandoned, std::memory_order_acq_rel);
+			state == State::Done || state == State::Detached)
+			m_self.destroy();
+	}
+	/**
+	 * @brief Mark the suspended coroutine as never resumed: destroy it if abandoned, else with its task.
+	 */
+	void detach() {
+		if (auto state = State::Running;
+			!m_state.compare_exchange_strong(state, State::Detached, std::memory_order_acq_rel) &&
+			state == State::Abandoned)
+			m_self.destroy();
+	}
+	/**
+	 * @brief Register the coroutine to resume at the end of this one.
+	 * @param[in,out] ioAwaiting The awaiting coroutine.
+	 * @return False if this one is already done, the awaiting one must not suspend.
+	 */
+	auto setContinuation(PromiseBase& ioAwaiting) -> bool {
+		return m_continuation.exchange(&ioAwaiting, std::memory_order_acq_rel) != this;
+	}
+	/**
+	 * @brief Throw the exception escaped from the coroutine, if any.
+	 */
+	void rethrow() const {
+		if (m_exception)
+			std::rethrow_exception(m_exception);
+	}
+
+protected:
+	/// The coroutine.
+	std::coroutine_handle<> m_self;
+
+private:
+	/// Coroutine state.
+	std::atomic<State> m_state = State::Running;
+	/// Coroutine to resume at the end, this promise once done.
+	std::atomic<PromiseBase*> m_continuation = nullptr;
+	/// Exception escaped from the coroutine.
+	std::exception_ptr m_exception;
+};
+
+/**
+ * @brief Storage of the coroutine result.
+ * @tparam T The result type.
+ */
+template<typename T>
+class PromiseResult : public PromiseBase {
+public:
+	/**
+	 * @brief Store the result.
+	 * @param[in] iValue The result.
+	 */
+	void return_value(T iValue) { m_result.emplace(std::move(iValue)); }
+	/**
+	 * @brief Take the result.
+	 * @return The result.
+	 */
+	auto takeResult() -> T {
+		rethrow();
+		return std::move(*m_result);
+	}
+
+private:
+	/// The result.
+	std::optional<T> m_result;
+};
+
+/**
+ * @brief Storage of the coroutine result, without result.
+ */
+template<>
+class PromiseResult<void> : public PromiseBase {
+public:
+	/**
+	 * @brief End of the coroutine.
+	 */
+	void return_void() const {}
+	/**
+	 * @brief Check the end of the coroutine.
+	 */
+	void takeResult() const { rethrow(); }
+};
+
+/**
+ * @brief Coroutine started at its call, owning its frame.
+ *
+ * The coroutine runs until its first suspension before returning the task. Destroying the task before the end
+ * cancels the coroutine at its next resumption: the frame is destroyed instead of resumed. Awaiting a task
+ * suspends the caller until the end of the task, and resumes it in the thread where the task ends.
+ * @tparam T The result type.
+ */
+template<typename T = void>
+class Task final {
+public:
+	/**
+	 * @brief Promise of the task coroutine.
+	 */
+	class promise_type final : public PromiseResult<T> {
+	public:
+		/**
+		 * @brief Create the task.
+		 * @return The task.
+		 */
+		auto get_return_object() -> Task {
+			const auto handle = std::coroutine_handle<promise_type>::from_promise(*this);
+			this->m_self = handle;
+			return Task{handle};
+		}
+	};
+
+	/**
+	 * @brief Awaiter of the end of the task.
+	 */
+	struct Awaiter {
+		/// The awaited coroutine.
+		std::coroutine_handle<promise_type> handle;
+
+		/**
+		 * @brief Check if the task is done.
+		 * @return True if done.
+		 */
+		[[nodiscard]] auto await_ready() const -> bool { return handle.promise().isDone(); }
+		/**
+		 * @brief Register the awaiting coroutine.
+		 * @tparam P The awaiting promise type.
+		 * @param[in] iAwaiting The awaiting coroutine.
+		 * @return False if the task ended meanwhile.
+		 */
+		template<typename P>
+		auto await_suspend(std::coroutine_handle<P> iAwaiting) -> bool {
+			return handle.promise().setContinuation(iAwaiting.promise());
+		}
+		/**
+		 * @brief Get the task result.
+		 * @return The result.
+		 */
+		auto await_resume() -> T { return handle.promise().takeResult(); }
+	};
+
+	/**
+	 * @brief Default constructor, without coroutine.
+	 */
+	Task() = default;
+	/**
+	 * @brief Destructor, release the coroutine.
+	 */
+	~Task() { reset(); }
+
+	Task(const Task&) = delete;
+	/**
+	 * @brief Move constructor.
+	 * @param[in,out] ioOther The moved task.
+	 */
+	Task(Task&& ioOther) noexcept : m_handle{std::exchange(ioOther.m_handle, {})} {}
+	auto operator=(const Task&) -> Task& = delete;
+	/**
+	 * @brief Move assignment, releasing the current coroutine.
+	 * @param[in,out] ioOther The moved task.
+	 * @return This task.
+	 */
+	auto operator=(Task&& ioOther) noexcept -> Task& {
+		if (this != &ioOther) {
+			reset();
+			m_handle = std::exchange(ioOther.m_handle, {});
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Check if the task has a coroutine.
+	 * @return True if valid.
+	 */
+	[[nodiscard]] auto isValid() const -> bool { return static_cast<bool>(m_handle); }
+	/**
+	 * @brief Check if the coroutine is finished.
+	 * @return True if done.
+	 */
+	[[nodiscard]] auto isDone() const -> bool { return m_handle && m_handle.promise().isDone(); }
+	/**
+	 * @brief Get the result of a finished task, throw the escaped exception if any.
+	 * @return The result.
+	 */
+	auto getResult() -> T { return m_handle.promise().takeResult(); }
+	/**
+	 * @brief Release the coroutine, cancelled if not done.
+	 */
+	void reset() {
+		if (m_handle)
+			m_handle.promise().abandon();
+		m_handle = {};
+	}
+
+	/**
+	 * @brief Await the end of the task.
+	 * @return The awaiter.
+	 */
+	auto operator co_await() const& -> Awaiter { return {m_handle}; }
+
+private:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iHandle The coroutine.
+	 */
+	explicit Task(std::coroutine_handle<promise_type> iHandle) : m_handle{iHandle} {}
+
+	/// The coroutine.
+	std::coroutine_handle<promise_type> m_handle;
+};
+
+}// namespace mvi::core::coro
@@ -119,6 +119,88 @@ public:
 	[[nodiscard]] auto getCategoryFlags() const -> uint8_t override;
 };
 
+/**
+ * @brief Window focus Event
+ */
+class WindowFocusEvent final : public Event {
+public:
+	/**
+	 * @brief Constructor.
+	 */
+	WindowFocusEvent() = default;
+
+	/**
+	 * @brief Get the event as string.
+	 * @return String of the event.
+	 */
+	[[nodiscard]] auto toString() const -> std::string override { return std::format("WindowFocusEvent"); }
+
+	/**
+	 * @brief Get the event's name.
+	 * @return Event's name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return std::format("WindowFocusEvent"); }
+
+	/**
+	 * @brief Get the event's static type.
+	 * @return Event's static type.
+	 */
+	[[nodiscard]] static auto getStaticType() -> Type { return Type::WindowFocus; }
+
+	/**
+	 * @brief Get the event's type.
+	 * @return Event's type.
+	 */
+	[[nodiscard]] auto getType() const -> Type override { return getStaticType(); }
+
+	/**
+	 * @brief Get the event's category flags.
+	 * @return Event's category flags.
+	 */
+	[[nodiscard]] auto getCategoryFlags() const -> uint8_t override;
+};
+
+/**
+ * @brief Window lost focus Event
+ */
+class WindowLostFocusEvent final : public Event {
+public:
+	/**
+	 * @brief Constructor.
+	 */
+	WindowLostFocusEvent() = default;
+
+	/**
+	 * @brief Get the event as string.
+	 * @return String of the event.
+	 */
+	[[nodiscard]] auto toString() const -> std::string override { return std::format("WindowLostFocusEvent"); }
+
+	/**
+	 * @brief Get the event's name.
+	 * @return Event's name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return std::format("WindowLostFocusEvent"); }
+
+	/**
+	 * @brief Get the event's static type.
+	 * @return Event's static type.
+	 */
+	[[nodiscard]] static auto getStaticType() -> Type { return Type::WindowLostFocus; }
+
+	/**
+	 * @brief Get the event's type.
+	 * @return Event's type.
+	 */
+	[[nodiscard]] auto getType() const -> Type override { return getStaticType(); }
+
+	/**
+	 * @brief Get the event's category flags.
+	 * @return Event's category flags.
+	 */
+	[[nodiscard]] auto getCategoryFlags() const -> uint8_t override;
+};
+
 /**
  * @brief Application Tick Event
  */
@@ -126,14 +208,30 @@ class AppTickEvent final : public Event {
 public:
 	/**
 	 * @brief Constructor.
+	 * @param[in] iStep Tick duration in seconds.
+	 * @param[in] iTick Tick index.
+	 */
+	AppTickEvent(const double iStep, const uint64_t iTick) : m_step{iStep}, m_tick{iTick} {}
+
+	/**
+	 * @brief Get the tick duration.
+	 * @return The duration in seconds.
 	 */
-	AppTickEvent() = default;
+	[[nodiscard]] auto getStep() const -> double { return m_step; }
+
+	/**
+	 * @brief Get the tick index.
+	 * @return The tick index.
+	 */
+	[[nodiscard]] auto getTick() const -> uint64_t { return m_tick; }
 
 	/**
 	 * @brief Get the event as string.
 	 * @return String of the event.
 	 */
-	[[nodiscard]] auto toString() const -> std::string override { return std::format("AppTickEvent"); }
+	[[nodiscard]] auto toString() const -> std::string override {
+		return std::format("AppTickEvent: {}, {}", m_tick, m_step);
+	}
 
 	/**
 	 * @brief Get the event's name.
@@ -158,6 +256,12 @@ public:
 	 * @return Event's category flags.
 	 */
 	[[nodiscard]] auto getCategoryFlags() const -> uint8_t override;
+
+private:
+	/// Tick duration in seconds.
+	double m_step;
+	/// Tick index.
+	uint64_t m_tick;
 };
 
 /**
@@ -167,14 +271,21 @@ class AppUpdateEvent final : public Event {
 public:
 	/**
 	 * @brief Constructor.
+	 * @param[in] iDelta Time elapsed since the previous frame, in seconds.
+	 */
+	explicit AppUpdateEvent(const double iDelta) : m_delta{iDelta} {}
+
+	/**
+	 * @brief Get the time elapsed since the previous frame.
+	 * @return The duration in seconds.
 	 */
-	AppUpdateEvent() = default;
+	[[nodiscard]] auto getDelta() const -> double { return m_delta; }
 
 	/**
 	 * @brief Get the event as string.
 	 * @return String of the event.
 	 */
-	[[nodiscard]] auto toString() const -> std::string override { return std::format("AppUpdateEvent"); }
+	[[nodiscard]] auto toString() const -> std::string override { return std::format("AppUpdateEvent: {}", m_delta); }
 
 	/**
 	 * @brief Get the event's name.
@@ -199,6 +310,10 @@ public:
 	 * @return Event's category flags.
 	 */
 	[[nodiscard]] auto getCategoryFlags() const -> uint8_t override;
+
+private:
+	/// Time elapsed since the previous frame, in seconds.
+	double m_delta;
 };
 
 /**
@@ -208,14 +323,21 @@ class AppRenderEvent final : public Event {
 public:
 	/**
 	 * @brief Constructor.
+	 * @param[in] iAlpha Interpolation factor between the last two ticks.
 	 */
-	AppRenderEvent() = default;
+	explicit AppRenderEvent(const double iAlpha) : m_alpha{iAlpha} {}
+
+	/**
+	 * @brief Get the interpolation factor between the last two ticks.
+	 * @return The factor in [0, 1[.
+	 */
+	[[nodiscard]] auto getAlpha() const -> double { return m_alpha; }
 
 	/**
 	 * @brief Get the event as string.
 	 * @return String of the event.
 	 */
-	[[nodiscard]] auto toString() const -> std::string override { return std::format("AppRenderEvent"); }
+	[[nodiscard]] auto toString() const -> std::string override { return std::format("AppRenderEvent: {}", m_alpha); }
 
 	/**
 	 * @brief Get the event's name.
@@ -240,5 +362,9 @@ public:
 	 * @return Event's category flags.
 	 */
 	[[nodiscard]] auto getCategoryFlags() const -> uint8_t override;
+
+private:
+	/// Interpolation factor between the last two ticks.
+	double m_alpha;
 };
 }// namespace mvi::core::event
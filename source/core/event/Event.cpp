@@ -21,6 +21,8 @@ Event::~Event() = default;
 
 auto WindowResizeEvent::getCategoryFlags() const -> uint8_t { return Application; }
 auto WindowCloseEvent::getCategoryFlags() const -> uint8_t { return Application; }
+auto WindowFocusEvent::getCategoryFlags() const -> uint8_t { return Application; }
+auto WindowLostFocusEvent::getCategoryFlags() const -> uint8_t { return Application; }
 auto AppTickEvent::getCategoryFlags() const -> uint8_t { return Application; }
 auto AppUpdateEvent::getCategoryFlags() const -> uint8_t { return Application; }
 auto AppRenderEvent::getCategoryFlags() const -> uint8_t { return Application; }
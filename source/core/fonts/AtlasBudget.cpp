@@ -0,0 +1,107 @@
+/**
+ * @file AtlasBudget.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "AtlasBudget.h"
+
+#include "core/Log.h"
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+namespace mvi::core::fonts {
+
+namespace {
+
+/**
+ * @brief A live baked size and its footprint.
+ */
+struct BakedUsage {
+	/// The baked size.
+	ImFontBaked* baked = nullptr;
+	/// Texels used by its glyphs.
+	uint64_t texels = 0;
+};
+
+}// namespace
+
+AtlasBudget::AtlasBudget(const Config& iConfig) : m_config{iConfig} {}
+
+AtlasBudget::~AtlasBudget() = default;
+
+void AtlasBudget::update(ImFontAtlas* ioAtlas) {
+	if (++m_framesSinceCheck < m_config.checkInterval)
+		return;
+	m_framesSinceCheck = 0;
+	ImFontAtlasBuilder* builder = ioAtlas->Builder;
+	if (builder == nullptr)
+		return;
+
+	// Measure the live baked sizes.
+	std::vector<BakedUsage> usages;
+	Stats stats{.evictions = m_stats.evictions, .compactions = m_stats.compactions};
+	for (int index = 0; index < builder->BakedPool.Size; ++index) {
+		ImFontBaked* baked = &builder->BakedPool[index];
+		if (baked->WantDestroy)
+			continue;
+		BakedUsage usage{.baked = baked};
+		for (const ImFontGlyph& glyph: baked->Glyphs) {
+			if (glyph.Visible == 0 || glyph.PackId == ImFontAtlasRectId_Invalid)
+				continue;
+			const ImTextureRect* rect = ImFontAtlasPackGetRect(ioAtlas, glyph.PackId);
+			usage.texels += static_cast<uint64_t>(rect->w) * rect->h;
+		}
+		++stats.bakedSizes;
+		stats.glyphs += static_cast<uint32_t>(baked->Glyphs.Size);
+		stats.usedTexels += usage.texels;
+		usages.push_back(usage);
+	}
+	for (const ImTextureData* texture: ioAtlas->TexList)
+		stats.textureBytes += static_cast<uint64_t>(texture->GetSizeInBytes());
+
+	const auto budget = static_cast<uint64_t>(static_cast<float>(m_config.pageSize) *
+											  static_cast<float>(m_config.pageSize) * m_config.fillRatio);
+	if (stats.usedTexels > budget) {
+		// Least recently used first.
+		std::ranges::sort(usages, [](const BakedUsage& iA, const BakedUsage& iB) -> bool {
+			return iA.baked->LastUsedFrame < iB.baked->LastUsedFrame;
+		});
+		const int unusedLimit = builder->FrameCount - m_config.unusedFrames;
+		for (const auto& [baked, texels]: usages) {
+			if (stats.usedTexels <= budget)
+				break;
+			const bool inUse = baked->LastUsedFrame > unusedLimit;
+			// Sizes of the current frame would be baked again at the next one.
+			if ((inUse && !m_config.evictInUse) || baked->LastUsedFrame >= builder->FrameCount - 1)
+				break;
+			if (inUse)
+				log_warn("Font atlas: over budget, evicting the {:.1f}px size still in use.", baked->Size);
+			else
+				log_trace("Font atlas: evicting {:.1f}px size ({} glyphs, last used at frame {}).", baked->Size,
+						  baked->Glyphs.Size, baked->LastUsedFrame);
+			stats.usedTexels -= texels;
+			stats.glyphs -= static_cast<uint32_t>(baked->Glyphs.Size);
+			--stats.bakedSizes;
+			++stats.evictions;
+			ImFontAtlasBakedDiscard(ioAtlas, baked->ContainerFont, baked);
+		}
+		if (stats.usedTexels > budget)
+			log_trace("Font atlas: {} texels over budget, every size is in use.", stats.usedTexels - budget);
+	}
+	// The texture grown for the sizes in use goes back to the page once they fit in it.
+	const ImTextureData* texture = ioAtlas->TexData;
+	if (texture != nullptr && stats.usedTexels <= budget &&
+		(texture->Width > m_config.pageSize || texture->Height > m_config.pageSize)) {
+		log_trace("Font atlas: compacting the {}x{} texture into the page.", texture->Width, texture->Height);
+		ioAtlas->CompactCache();
+		++stats.compactions;
+	}
+	m_stats = stats;
+}
+
+}// namespace mvi::core::fonts
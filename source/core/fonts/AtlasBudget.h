@@ -0,0 +1,104 @@
+/**
+ * @file AtlasBudget.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+struct ImFontAtlas;
+
+namespace mvi::core::fonts {
+
+/**
+ * @brief Keep the dynamic font atlas around a texture page size.
+ *
+ * Glyphs are rasterized by the atlas the first time they are drawn. When the packed glyphs exceed the allowed
+ * fill ratio of the page, the budget evicts baked font sizes in least recently used order. Evicted glyphs are
+ * baked again on their next use (from the font cache when installed). Sizes used in the last frames are kept,
+ * unless evictInUse is set; sizes drawn in the current frame are never evicted, as they would be baked again at
+ * the next frame.
+ *
+ * The page is not a hard limit: the glyphs of the sizes in use always get a place, the atlas texture growing
+ * past the page when they need it (a large script at one size). Once they fit again, the texture is compacted
+ * back to the page.
+ */
+class AtlasBudget final {
+public:
+	/**
+	 * @brief Budget configuration.
+	 */
+	struct Config {
+		/// Width and height of the atlas texture page.
+		int pageSize = 2048;
+		/// Allowed fill ratio of the page before evicting.
+		float fillRatio = 0.75f;
+		/// Number of frames a baked size must be unused before being evicted.
+		int unusedFrames = 120;
+		/// Number of frames between two budget checks.
+		int checkInterval = 30;
+		/// Allow evicting sizes still in use when unused ones are not enough, as a last resort.
+		bool evictInUse = false;
+	};
+
+	/**
+	 * @brief Budget statistics.
+	 */
+	struct Stats {
+		/// Live baked sizes.
+		uint32_t bakedSizes = 0;
+		/// Loaded glyphs.
+		uint32_t glyphs = 0;
+		/// Texels used by packed glyphs.
+		uint64_t usedTexels = 0;
+		/// Bytes of the atlas textures.
+		uint64_t textureBytes = 0;
+		/// Evicted baked sizes since start.
+		uint32_t evictions = 0;
+		/// Compactions of the texture back to the page since start.
+		uint32_t compactions = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iConfig The budget configuration.
+	 */
+	explicit AtlasBudget(const Config& iConfig);
+	/**
+	 * @brief Default destructor.
+	 */
+	~AtlasBudget();
+
+	AtlasBudget(const AtlasBudget&) = delete;
+	AtlasBudget(AtlasBudget&&) = delete;
+	auto operator=(const AtlasBudget&) -> AtlasBudget& = delete;
+	auto operator=(AtlasBudget&&) -> AtlasBudget& = delete;
+
+	/**
+	 * @brief Check the budget and evict if needed.
+	 * @param[in,out] ioAtlas The font atlas.
+	 *
+	 * @note Must be called outside of an ImGui frame.
+	 */
+	void update(ImFontAtlas* ioAtlas);
+
+	/**
+	 * @brief Get the budget statistics.
+	 * @return The statistics of the last check.
+	 */
+	[[nodiscard]] auto getStats() const -> const Stats& { return m_stats; }
+
+private:
+	/// Configuration.
+	Config m_config;
+	/// Statistics.
+	Stats m_stats;
+	/// Frames since last check.
+	int m_framesSinceCheck = 0;
+};
+
+}// namespace mvi::core::fonts
@@ -0,0 +1,331 @@
+/**
+ * @file AtlasBuilder.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "AtlasBuilder.h"
+
+#include "core/Log.h"
+
+#include <bit>
+#include <fstream>
+#include <imgui.h>
+#include <imgui_internal.h>
+
+namespace mvi::core::fonts {
+
+namespace {
+
+/**
+ * @brief Get the builder owning the prepared fonts of an atlas.
+ * @param[in] iAtlas The atlas.
+ * @return The builder.
+ */
+auto getBuilder(const ImFontAtlas* iAtlas) -> AtlasBuilder* { return static_cast<AtlasBuilder*>(iAtlas->UserData); }
+
+auto fontSrcInit(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc) -> bool {
+	AtlasBuilder* builder = getBuilder(ioAtlas);
+	const ImFontLoader* inner = builder->getInnerLoader();
+	if (inner->FontSrcInit != nullptr && !inner->FontSrcInit(ioAtlas, ioSrc))
+		return false;
+	builder->registerSource(ioSrc);
+	return true;
+}
+
+void fontSrcDestroy(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc) {
+	AtlasBuilder* builder = getBuilder(ioAtlas);
+	builder->unregisterSource(ioSrc);
+	const ImFontLoader* inner = builder->getInnerLoader();
+	if (inner->FontSrcDestroy != nullptr)
+		inner->FontSrcDestroy(ioAtlas, ioSrc);
+}
+
+auto fontSrcContainsGlyph(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, const ImWchar iCodepoint) -> bool {
+	const ImFontLoader* inner = getBuilder(ioAtlas)->getInnerLoader();
+	return inner->FontSrcContainsGlyph != nullptr && inner->FontSrcContainsGlyph(ioAtlas, ioSrc, iCodepoint);
+}
+
+auto fontBakedInit(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData) -> bool {
+	const ImFontLoader* inner = getBuilder(ioAtlas)->getInnerLoader();
+	return inner->FontBakedInit == nullptr || inner->FontBakedInit(ioAtlas, ioSrc, ioBaked, ioLoaderData);
+}
+
+void fontBakedDestroy(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData) {
+	const ImFontLoader* inner = getBuilder(ioAtlas)->getInnerLoader();
+	if (inner->FontBakedDestroy != nullptr)
+		inner->FontBakedDestroy(ioAtlas, ioSrc, ioBaked, ioLoaderData);
+}
+
+auto fontBakedLoadGlyph(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData,
+						const ImWchar iCodepoint, ImFontGlyph* oGlyph, float* oAdvanceX) -> bool {
+	return getBuilder(ioAtlas)->loadGlyph(ioAtlas, ioSrc, ioBaked, ioLoaderData, iCodepoint, oGlyph, oAdvanceX);
+}
+
+}// namespace
+
+AtlasBuilder::AtlasBuilder(const ImFontLoader* iLoader) : m_inner{iLoader}, m_loader{std::make_unique<ImFontLoader>()} {
+	// Per source loader: the atlas loader (and the disk cache) keeps serving the other fonts.
+	m_loader->Name = "mvi_prepared_glyphs";
+	m_loader->FontSrcInit = fontSrcInit;
+	m_loader->FontSrcDestroy = fontSrcDestroy;
+	m_loader->FontSrcContainsGlyph = fontSrcContainsGlyph;
+	m_loader->FontBakedInit = fontBakedInit;
+	m_loader->FontBakedDestroy = fontBakedDestroy;
+	m_loader->FontBakedLoadGlyph = fontBakedLoadGlyph;
+	m_loader->FontBakedSrcLoaderDataSize = m_inner->FontBakedSrcLoaderDataSize;
+}
+
+AtlasBuilder::~AtlasBuilder() {
+	++m_generation;
+	if (m_worker != nullptr)
+		m_retired.push_back(std::move(m_worker));
+	joinRetired(true);
+}
+
+void AtlasBuilder::request(Request iRequest) {
+	const uint64_t generation = ++m_generation;
+	// The previous build sees the new request number and stops at its next step; it is joined once returned,
+	// without blocking the UI thread meanwhile.
+	if (m_worker != nullptr)
+		m_retired.push_back(std::move(m_worker));
+	joinRetired(false);
+	if (iRequest.sources.empty() || iRequest.sizes.empty()) {
+		m_building = false;
+		return;
+	}
+	m_building = true;
+	m_worker = std::make_unique<Worker>();
+	m_worker->thread =
+			std::thread([this, worker = m_worker.get(), request = std::move(iRequest), generation]() -> void {
+				build(request, generation);
+				worker->done = true;
+			});
+}
+
+void AtlasBuilder::joinRetired(const bool iWait) {
+	std::erase_if(m_retired, [iWait](const std::unique_ptr<Worker>& iWorker) -> bool {
+		if (!iWait && !iWorker->done)
+			return false;
+		iWorker->thread.join();
+		return true;
+	});
+}
+
+auto AtlasBuilder::isBuilding() const -> bool { return m_building; }
+
+auto AtlasBuilder::apply(ImFontAtlas* ioAtlas, ImFont** ioDefault) -> bool {
+	joinRetired(false);
+	std::unique_ptr<Prepared> prepared;
+	{
+		std::lock_guard lock(m_mutex);
+		prepared = std::move(m_ready);
+	}
+	if (prepared == nullptr)
+		return false;
+
+	// The loader of the prepared fonts finds this builder through the atlas.
+	ioAtlas->UserData = this;
+	// The previous fonts stay alive until removed from the atlas.
+	auto previous = std::move(m_applied);
+	ImFont* previousFont = m_font;
+	m_applied = std::move(prepared);
+	m_font = nullptr;
+	// NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+	for (const auto& source: m_applied->sources) {
+		ImFontConfig config;
+		config.FontDataOwnedByAtlas = false;
+		config.MergeMode = m_font != nullptr;
+		config.DstFont = m_font;
+		config.FontLoader = m_loader.get();
+		m_adding = &source;
+		ImFont* font = ioAtlas->AddFontFromMemoryTTF(const_cast<uint8_t*>(source.data.data()),
+													 static_cast<int>(source.data.size()), m_applied->sizes.front(),
+													 &config);
+		if (m_font == nullptr)
+			m_font = font;
+	}
+	// NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+	m_adding = nullptr;
+	if (m_font == nullptr) {
+		log_error("Prepared fonts could not be added to the atlas.");
+		m_applied = std::move(previous);
+		m_font = previousFont;
+		return false;
+	}
+	if (ioDefault != nullptr)
+		*ioDefault = m_font;
+	if (previousFont != nullptr)
+		ioAtlas->RemoveFont(previousFont);
+	log_info("Prepared fonts applied ({} px).", m_applied->sizes.front());
+	return true;
+}
+
+auto AtlasBuilder::getSize() const -> float { return m_applied != nullptr ? m_applied->sizes.front() : 0.f; }
+
+auto AtlasBuilder::getStats() const -> Stats {
+	std::lock_guard lock(m_mutex);
+	return m_stats;
+}
+
+void AtlasBuilder::registerSource(const ImFontConfig* iSrc) {
+	if (m_adding != nullptr)
+		m_sources[iSrc] = m_adding;
+}
+
+void AtlasBuilder::unregisterSource(const ImFontConfig* iSrc) { m_sources.erase(iSrc); }
+
+auto AtlasBuilder::glyphKey(const float iSize, const uint32_t iCodepoint) -> uint64_t {
+	return (static_cast<uint64_t>(std::bit_cast<uint32_t>(iSize)) << 32u) | iCodepoint;
+}
+
+auto AtlasBuilder::loadGlyph(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData,
+							 const uint32_t iCodepoint, ImFontGlyph* oGlyph, float* oAdvanceX) -> bool {
+	const Glyph* glyph = nullptr;
+	const PreparedSource* source = nullptr;
+	// Prepared glyphs are only valid at the density they were rasterized with.
+	if (const auto itSource = m_sources.find(ioSrc);
+		itSource != m_sources.end() && m_applied != nullptr &&
+		std::bit_cast<uint32_t>(ioBaked->RasterizerDensity) == std::bit_cast<uint32_t>(m_applied->density)) {
+		source = itSource->second;
+		if (const auto itGlyph = source->glyphs.find(glyphKey(ioBaked->Size, iCodepoint));
+			itGlyph != source->glyphs.end())
+			glyph = &itGlyph->second;
+	}
+	if (glyph == nullptr)
+		return m_inner->FontBakedLoadGlyph(ioAtlas, ioSrc, ioBaked, ioLoaderData, static_cast<ImWchar>(iCodepoint),
+										   oGlyph, oAdvanceX);
+
+	if (oAdvanceX != nullptr) {
+		*oAdvanceX = glyph->advanceX;
+		return true;
+	}
+	oGlyph->Codepoint = iCodepoint;
+	oGlyph->AdvanceX = glyph->advanceX;
+	if (glyph->width == 0)
+		return true;
+	const ImFontAtlasRectId packId = ImFontAtlasPackAddRect(ioAtlas, glyph->width, glyph->height);
+	if (packId == ImFontAtlasRectId_Invalid) {
+		log_error("Prepared fonts: out of atlas space for glyph {:#x}.", iCodepoint);
+		return false;
+	}
+	ImTextureRect* rect = ImFontAtlasPackGetRect(ioAtlas, packId);
+	oGlyph->X0 = glyph->x0;
+	oGlyph->Y0 = glyph->y0;
+	oGlyph->X1 = glyph->x1;
+	oGlyph->Y1 = glyph->y1;
+	oGlyph->Visible = 1;
+	oGlyph->PackId = packId;
+	ImFontAtlasBakedSetFontGlyphBitmap(ioAtlas, ioBaked, ioSrc, oGlyph, rect, source->pixels.data() + glyph->pixelOffset,
+									   ImTextureFormat_Alpha8, glyph->width);
+	{
+		std::lock_guard lock(m_mutex);
+		++m_stats.served;
+	}
+	return true;
+}
+
+void AtlasBuilder::build(const Request& iRequest, const uint64_t iGeneration) {
+	const auto start = std::chrono::steady_clock::now();
+	const auto canceled = [this, iGeneration]() -> bool { return m_generation != iGeneration; };
+	auto prepared = std::make_unique<Prepared>();
+	prepared->sizes = iRequest.sizes;
+
+	// Private atlas: the one in use is owned by the UI thread.
+	ImFontAtlas atlas;
+	atlas.SetFontLoader(m_inner);
+	ImFont* font = nullptr;
+	// NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+	for (const auto& [path, data]: iRequest.sources) {
+		PreparedSource source;
+		source.data = data;
+		if (source.data.empty()) {
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			if (!file) {
+				log_warn("Font '{}' not found.", path.string());
+				continue;
+			}
+			source.fileData.resize(static_cast<size_t>(file.tellg()));
+			file.seekg(0);
+			file.read(reinterpret_cast<char*>(source.fileData.data()), static_cast<std::streamsize>(source.fileData.size()));
+			source.data = source.fileData;
+		}
+		ImFontConfig config;
+		config.FontDataOwnedByAtlas = false;
+		config.MergeMode = font != nullptr;
+		config.DstFont = font;
+		ImFont* added = atlas.AddFontFromMemoryTTF(const_cast<uint8_t*>(source.data.data()),
+												   static_cast<int>(source.data.size()), iRequest.sizes.front(), &config);
+		if (added == nullptr) {
+			log_warn("Font '{}' could not be loaded.", path.string());
+			continue;
+		}
+		if (font == nullptr)
+			font = added;
+		// Moving the vector keeps its buffer, the atlas data stays valid.
+		prepared->sources.push_back(std::move(source));
+	}
+	// NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+
+	uint32_t glyphCount = 0;
+	for (const float size: iRequest.sizes) {
+		if (font == nullptr || canceled())
+			break;
+		ImFontBaked* baked = font->GetFontBaked(size);
+		prepared->density = baked->RasterizerDensity;
+		for (const ImWchar* range = atlas.GetGlyphRangesDefault(); range[0] != 0 && !canceled(); range += 2) {
+			for (uint32_t codepoint = range[0]; codepoint <= range[1]; ++codepoint)
+				baked->FindGlyphNoFallback(static_cast<ImWchar>(codepoint));
+		}
+		// Read the bitmaps back from the private atlas, in Alpha8.
+		ImTextureData* texture = atlas.TexData;
+		for (const ImFontGlyph& glyph: baked->Glyphs) {
+			if (glyph.SourceIdx >= prepared->sources.size())
+				continue;
+			PreparedSource& source = prepared->sources[glyph.SourceIdx];
+			Glyph record{.advanceX = glyph.AdvanceX,
+						 .x0 = glyph.X0,
+						 .y0 = glyph.Y0,
+						 .x1 = glyph.X1,
+						 .y1 = glyph.Y1,
+						 .width = 0,
+						 .height = 0,
+						 .pixelOffset = static_cast<uint32_t>(source.pixels.size())};
+			if (glyph.Visible != 0 && glyph.PackId != ImFontAtlasRectId_Invalid) {
+				const ImTextureRect* rect = ImFontAtlasPackGetRect(&atlas, glyph.PackId);
+				record.width = rect->w;
+				record.height = rect->h;
+				source.pixels.resize(source.pixels.size() + static_cast<size_t>(rect->w) * rect->h);
+				uint8_t* destination = source.pixels.data() + record.pixelOffset;
+				for (int row = 0; row < rect->h; ++row) {
+					const auto* pixels = static_cast<const uint8_t*>(texture->GetPixelsAt(rect->x, rect->y + row));
+					for (int column = 0; column < rect->w; ++column)
+						*destination++ = texture->BytesPerPixel == 1 ? pixels[column] : pixels[column * 4 + 3];
+				}
+			}
+			source.glyphs[glyphKey(size, glyph.Codepoint)] = record;
+			++glyphCount;
+		}
+	}
+
+	const float buildMs =
+			std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	std::lock_guard lock(m_mutex);
+	if (canceled())
+		return;
+	m_building = false;
+	if (font == nullptr) {
+		log_error("No font could be prepared.");
+		return;
+	}
+	++m_stats.builds;
+	m_stats.glyphs = glyphCount;
+	m_stats.buildMs = buildMs;
+	m_ready = std::move(prepared);
+	log_debug("Fonts prepared in {:.1f} ms ({} glyphs).", static_cast<double>(buildMs), glyphCount);
+}
+
+}// namespace mvi::core::fonts
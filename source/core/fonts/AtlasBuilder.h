@@ -0,0 +1,257 @@
+/**
+ * @file AtlasBuilder.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct ImFont;
+struct ImFontAtlas;
+struct ImFontConfig;
+struct ImFontBaked;
+struct ImFontGlyph;
+struct ImFontLoader;
+
+namespace mvi::core::fonts {
+
+/**
+ * @brief Prepare fonts on a worker thread, then swap them into the atlas in use.
+ *
+ * The worker reads the font files and rasterizes the glyphs of the requested sizes into a private atlas.
+ * Once done, the fonts are added to the atlas in use with a loader serving the prepared bitmaps: glyphs
+ * are only copied into the atlas as the frames need them, and the texture uploader sends their rectangles
+ * alone. Until then, the current fonts stay in use. The loader of the prepared fonts finds its builder through
+ * the user data of the atlas, set by apply().
+ */
+class AtlasBuilder final {
+public:
+	/**
+	 * @brief Font source.
+	 */
+	struct Source {
+		/// Font file, read by the worker when there is no data.
+		std::filesystem::path path;
+		/// Font data, must outlive the builder.
+		std::span<const uint8_t> data;
+	};
+	/**
+	 * @brief Fonts to prepare.
+	 */
+	struct Request {
+		/// Sources, the next ones are merged into the first one.
+		std::vector<Source> sources;
+		/// Sizes to rasterize, the first one is the default size.
+		std::vector<float> sizes;
+	};
+	/**
+	 * @brief Build statistics.
+	 */
+	struct Stats {
+		/// Completed builds.
+		uint32_t builds = 0;
+		/// Glyphs prepared by the last build.
+		uint32_t glyphs = 0;
+		/// Duration of the last build in milliseconds.
+		float buildMs = 0.f;
+		/// Prepared glyphs copied into the atlas.
+		uint32_t served = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iLoader The font loader rasterizing the glyphs.
+	 */
+	explicit AtlasBuilder(const ImFontLoader* iLoader);
+	/**
+	 * @brief Destructor, cancel the build in progress.
+	 */
+	~AtlasBuilder();
+
+	AtlasBuilder(const AtlasBuilder&) = delete;
+	AtlasBuilder(AtlasBuilder&&) = delete;
+	auto operator=(const AtlasBuilder&) -> AtlasBuilder& = delete;
+	auto operator=(AtlasBuilder&&) -> AtlasBuilder& = delete;
+
+	/**
+	 * @brief Start preparing fonts, replacing the build in progress if any.
+	 * @param[in] iRequest The fonts.
+	 */
+	void request(Request iRequest);
+	/**
+	 * @brief Check if a build is in progress.
+	 * @return True if building.
+	 */
+	[[nodiscard]] auto isBuilding() const -> bool;
+	/**
+	 * @brief Add the prepared fonts to the atlas, if ready, and remove the previously applied ones.
+	 * @param[in,out] ioAtlas The atlas in use.
+	 * @param[in,out] ioDefault The default font, replaced by the new one.
+	 * @return True if the fonts changed.
+	 *
+	 * @note To call between frames, the atlas cannot change during a frame.
+	 */
+	auto apply(ImFontAtlas* ioAtlas, ImFont** ioDefault) -> bool;
+	/**
+	 * @brief Get the default size of the applied fonts.
+	 * @return The size, 0 if none applied.
+	 */
+	[[nodiscard]] auto getSize() const -> float;
+
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> Stats;
+
+	/**
+	 * @brief Get the loader serving the prepared glyphs.
+	 * @return The loader.
+	 */
+	[[nodiscard]] auto getLoader() const -> const ImFontLoader* { return m_loader.get(); }
+	/**
+	 * @brief Get the rasterizing loader.
+	 * @return The loader.
+	 */
+	[[nodiscard]] auto getInnerLoader() const -> const ImFontLoader* { return m_inner; }
+	/**
+	 * @brief Load a glyph, from the prepared bitmaps when available.
+	 * @param[in,out] ioAtlas The atlas.
+	 * @param[in,out] ioSrc The font source.
+	 * @param[in,out] ioBaked The baked size.
+	 * @param[in,out] ioLoaderData The loader data.
+	 * @param[in] iCodepoint The code point.
+	 * @param[out] oGlyph The glyph.
+	 * @param[out] oAdvanceX The advance only, when not null.
+	 * @return True if the source has the glyph.
+	 */
+	auto loadGlyph(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData,
+				   uint32_t iCodepoint, ImFontGlyph* oGlyph, float* oAdvanceX) -> bool;
+	/**
+	 * @brief Bind a source added to the atlas to its prepared glyphs.
+	 * @param[in] iSrc The font source.
+	 */
+	void registerSource(const ImFontConfig* iSrc);
+	/**
+	 * @brief Forget a source removed from the atlas.
+	 * @param[in] iSrc The font source.
+	 */
+	void unregisterSource(const ImFontConfig* iSrc);
+
+private:
+	/**
+	 * @brief Rasterized glyph.
+	 */
+	struct Glyph {
+		/// Horizontal advance.
+		float advanceX = 0.f;
+		/// Glyph quad left.
+		float x0 = 0.f;
+		/// Glyph quad top.
+		float y0 = 0.f;
+		/// Glyph quad right.
+		float x1 = 0.f;
+		/// Glyph quad bottom.
+		float y1 = 0.f;
+		/// Bitmap width (0: no bitmap).
+		uint16_t width = 0;
+		/// Bitmap height.
+		uint16_t height = 0;
+		/// Offset of the Alpha8 pixels.
+		uint32_t pixelOffset = 0;
+	};
+	/**
+	 * @brief Glyphs prepared for one source.
+	 */
+	struct PreparedSource {
+		/// Font file content, when read by the worker.
+		std::vector<uint8_t> fileData;
+		/// Font data.
+		std::span<const uint8_t> data;
+		/// Glyphs, by size and code point.
+		std::unordered_map<uint64_t, Glyph> glyphs;
+		/// Alpha8 pixels.
+		std::vector<uint8_t> pixels;
+	};
+	/**
+	 * @brief Output of a build.
+	 */
+	struct Prepared {
+		/// The sources.
+		std::vector<PreparedSource> sources;
+		/// The sizes.
+		std::vector<float> sizes;
+		/// Rasterizer density of the glyphs.
+		float density = 1.f;
+	};
+
+	/**
+	 * @brief Worker thread of a build.
+	 */
+	struct Worker {
+		/// The thread.
+		std::thread thread;
+		/// The build returned, the thread can be joined without waiting.
+		std::atomic<bool> done = false;
+	};
+
+	/**
+	 * @brief Join the workers of the canceled builds that returned.
+	 * @param[in] iWait Also wait for the running ones.
+	 */
+	void joinRetired(bool iWait);
+	/**
+	 * @brief Build the fonts (worker thread).
+	 * @param[in] iRequest The fonts.
+	 * @param[in] iGeneration The request number, to detect cancellation.
+	 */
+	void build(const Request& iRequest, uint64_t iGeneration);
+	/**
+	 * @brief Compute the key of a glyph.
+	 * @param[in] iSize The baked size.
+	 * @param[in] iCodepoint The code point.
+	 * @return The key.
+	 */
+	[[nodiscard]] static auto glyphKey(float iSize, uint32_t iCodepoint) -> uint64_t;
+
+	/// Rasterizing loader.
+	const ImFontLoader* m_inner = nullptr;
+	/// Loader serving the prepared glyphs.
+	std::unique_ptr<ImFontLoader> m_loader;
+	/// Worker of the current build.
+	std::unique_ptr<Worker> m_worker;
+	/// Workers of the canceled builds, joined once returned.
+	std::vector<std::unique_ptr<Worker>> m_retired;
+	/// Last request number.
+	std::atomic<uint64_t> m_generation = 0;
+	/// Build in progress flag.
+	std::atomic<bool> m_building = false;
+	/// Protect the ready fonts and the statistics.
+	mutable std::mutex m_mutex;
+	/// Fonts ready to apply.
+	std::unique_ptr<Prepared> m_ready;
+	/// Fonts in the atlas.
+	std::unique_ptr<Prepared> m_applied;
+	/// Font added by the last apply.
+	ImFont* m_font = nullptr;
+	/// Source being added to the atlas.
+	const PreparedSource* m_adding = nullptr;
+	/// Prepared glyphs by atlas source.
+	std::unordered_map<const ImFontConfig*, const PreparedSource*> m_sources;
+	/// The statistics.
+	Stats m_stats;
+};
+
+}// namespace mvi::core::fonts
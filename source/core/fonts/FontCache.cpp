@@ -0,0 +1,364 @@
+/**
+ * @file FontCache.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "FontCache.h"
+
+#include "core/Hash.h"
+#include "core/Log.h"
+
+#include <cstring>
+#include <imgui.h>
+#include <imgui_internal.h>
+
+namespace mvi::core::fonts {
+
+namespace {
+
+/// Cache file magic number ("MVFC").
+constexpr uint32_t g_fileMagic = 0x4346564d;
+/// Cache file format version.
+constexpr uint32_t g_fileVersion = 1;
+
+/**
+ * @brief Header of a cache file.
+ */
+struct FileHeader {
+	/// Magic number.
+	uint32_t magic = g_fileMagic;
+	/// Format version.
+	uint32_t version = g_fileVersion;
+	/// Cache key.
+	uint64_t key = 0;
+	/// Number of glyph records.
+	uint32_t glyphCount = 0;
+	/// Size of the pixel block.
+	uint32_t pixelBytes = 0;
+};
+
+/// The cache receiving the loader calls.
+FontCache* g_activeCache = nullptr;
+/// The wrapped loader (outlives the cache, the atlas may be destroyed later).
+const ImFontLoader* g_innerLoader = nullptr;
+/// The caching loader.
+ImFontLoader g_cachingLoader;
+
+auto loaderInit(ImFontAtlas* ioAtlas) -> bool {
+	return g_innerLoader->LoaderInit == nullptr || g_innerLoader->LoaderInit(ioAtlas);
+}
+
+void loaderShutdown(ImFontAtlas* ioAtlas) {
+	if (g_innerLoader->LoaderShutdown != nullptr)
+		g_innerLoader->LoaderShutdown(ioAtlas);
+}
+
+auto fontSrcInit(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc) -> bool {
+	if (g_innerLoader->FontSrcInit != nullptr && !g_innerLoader->FontSrcInit(ioAtlas, ioSrc))
+		return false;
+	if (g_activeCache != nullptr)
+		g_activeCache->registerSource(ioSrc);
+	return true;
+}
+
+void fontSrcDestroy(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc) {
+	if (g_activeCache != nullptr)
+		g_activeCache->unregisterSource(ioSrc);
+	if (g_innerLoader->FontSrcDestroy != nullptr)
+		g_innerLoader->FontSrcDestroy(ioAtlas, ioSrc);
+}
+
+auto fontSrcContainsGlyph(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, const ImWchar iCodepoint) -> bool {
+	return g_innerLoader->FontSrcContainsGlyph != nullptr &&
+		   g_innerLoader->FontSrcContainsGlyph(ioAtlas, ioSrc, iCodepoint);
+}
+
+auto fontBakedInit(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData) -> bool {
+	return g_innerLoader->FontBakedInit == nullptr ||
+		   g_innerLoader->FontBakedInit(ioAtlas, ioSrc, ioBaked, ioLoaderData);
+}
+
+void fontBakedDestroy(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData) {
+	if (g_innerLoader->FontBakedDestroy != nullptr)
+		g_innerLoader->FontBakedDestroy(ioAtlas, ioSrc, ioBaked, ioLoaderData);
+}
+
+auto fontBakedLoadGlyph(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData,
+						const ImWchar iCodepoint, ImFontGlyph* oGlyph, float* oAdvanceX) -> bool {
+	if (g_activeCache == nullptr)
+		return g_innerLoader->FontBakedLoadGlyph(ioAtlas, ioSrc, ioBaked, ioLoaderData, iCodepoint, oGlyph,
+												 oAdvanceX);
+	return g_activeCache->loadGlyph(ioAtlas, ioSrc, ioBaked, ioLoaderData, iCodepoint, oGlyph, oAdvanceX);
+}
+
+}// namespace
+
+FontCache::FontCache(std::filesystem::path iDirectory) : m_directory{std::move(iDirectory)} {}
+
+FontCache::~FontCache() {
+	if (g_activeCache == this)
+		g_activeCache = nullptr;
+}
+
+auto FontCache::getLoader() -> const ImFontLoader* { return &g_cachingLoader; }
+
+void FontCache::install(ImFontAtlas* ioAtlas) {
+	m_inner = ioAtlas->FontLoader;
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+	if (m_inner == nullptr)
+		m_inner = ImFontAtlasGetFontLoaderForStbTruetype();
+#endif
+	if (m_inner == nullptr || m_inner == &g_cachingLoader) {
+		log_warn("Font cache: no font loader to wrap, cache disabled.");
+		return;
+	}
+	g_innerLoader = m_inner;
+	g_activeCache = this;
+	g_cachingLoader.Name = "mvi_font_cache";
+	g_cachingLoader.LoaderInit = loaderInit;
+	g_cachingLoader.LoaderShutdown = loaderShutdown;
+	g_cachingLoader.FontSrcInit = fontSrcInit;
+	g_cachingLoader.FontSrcDestroy = fontSrcDestroy;
+	g_cachingLoader.FontSrcContainsGlyph = fontSrcContainsGlyph;
+	g_cachingLoader.FontBakedInit = fontBakedInit;
+	g_cachingLoader.FontBakedDestroy = fontBakedDestroy;
+	g_cachingLoader.FontBakedLoadGlyph = fontBakedLoadGlyph;
+	g_cachingLoader.FontBakedSrcLoaderDataSize = m_inner->FontBakedSrcLoaderDataSize;
+	ioAtlas->SetFontLoader(&g_cachingLoader);
+	log_debug("Font cache installed over '{}' in '{}'.", m_inner->Name != nullptr ? m_inner->Name : "unknown",
+			  m_directory.string());
+}
+
+void FontCache::registerSource(const ImFontConfig* iSrc) {
+	if (iSrc->FontData == nullptr || iSrc->FontDataSize <= 0)
+		return;
+	m_sourceHashes[iSrc] = hashBytes(
+			{static_cast<const uint8_t*>(iSrc->FontData), static_cast<size_t>(iSrc->FontDataSize)});
+}
+
+void FontCache::unregisterSource(const ImFontConfig* iSrc) { m_sourceHashes.erase(iSrc); }
+
+auto FontCache::computeKey(const ImFontConfig* iSrc, const ImFontBaked* iBaked) const -> uint64_t {
+	// Post-processed bitmaps cannot be fed back to the atlas without processing them twice.
+	if (iSrc->RasterizerMultiply != 1.0f || iSrc->FontLoader != nullptr)
+		return 0;
+	const auto itHash = m_sourceHashes.find(iSrc);
+	if (itHash == m_sourceHashes.end())
+		return 0;
+	uint64_t key = itHash->second;
+	key = hashValue(iBaked->Size, key);
+	key = hashValue(iBaked->RasterizerDensity, key);
+	key = hashValue(iBaked->Ascent, key);
+	key = hashValue(iSrc->SizePixels, key);
+	key = hashValue(iSrc->RasterizerDensity, key);
+	key = hashValue(iSrc->OversampleH, key);
+	key = hashValue(iSrc->OversampleV, key);
+	key = hashValue(iSrc->PixelSnapH, key);
+	key = hashValue(iSrc->GlyphOffset.x, key);
+	key = hashValue(iSrc->GlyphOffset.y, key);
+	key = hashValue(iSrc->FontNo, key);
+	if (iSrc->GlyphRanges != nullptr) {
+		for (const ImWchar* range = iSrc->GlyphRanges; *range != 0; ++range) key = hashValue(*range, key);
+	}
+	return key == 0 ? 1 : key;
+}
+
+auto FontCache::pagePath(const uint64_t iKey) const -> std::filesystem::path {
+	return m_directory / std::format("{:016x}.glyphs", iKey);
+}
+
+auto FontCache::getPage(const uint64_t iKey) -> Page& {
+	const auto [itPage, inserted] = m_pages.try_emplace(iKey);
+	Page& page = itPage->second;
+	if (inserted)
+		mapPage(page, iKey);
+	return page;
+}
+
+void FontCache::mapPage(Page& ioPage, const uint64_t iKey) {
+	ioPage.mapped.clear();
+	ioPage.mappedPixels = nullptr;
+	if (!ioPage.file.open(pagePath(iKey)))
+		return;
+	const auto bytes = ioPage.file.data();
+	FileHeader header;
+	if (bytes.size() < sizeof(FileHeader)) {
+		ioPage.file.close();
+		return;
+	}
+	std::memcpy(&header, bytes.data(), sizeof(FileHeader));
+	const size_t recordBytes = static_cast<size_t>(header.glyphCount) * sizeof(GlyphRecord);
+	if (header.magic != g_fileMagic || header.version != g_fileVersion || header.key != iKey ||
+		bytes.size() < sizeof(FileHeader) + recordBytes + header.pixelBytes) {
+		log_warn("Font cache: discarding invalid file '{}'.", pagePath(iKey).string());
+		ioPage.file.close();
+		return;
+	}
+	// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+	const std::span records{reinterpret_cast<const GlyphRecord*>(bytes.data() + sizeof(FileHeader)),
+							header.glyphCount};
+	for (const auto& record: records) {
+		if (static_cast<size_t>(record.pixelOffset) + static_cast<size_t>(record.width) * record.height >
+			header.pixelBytes) {
+			log_warn("Font cache: discarding corrupted file '{}'.", pagePath(iKey).string());
+			ioPage.mapped.clear();
+			ioPage.file.close();
+			return;
+		}
+		ioPage.mapped.emplace(record.codepoint, &record);
+	}
+	ioPage.mappedPixels = bytes.data() + sizeof(FileHeader) + recordBytes;
+	++m_stats.mappedPages;
+}
+
+auto FontCache::loadGlyph(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData,
+						  const uint32_t iCodepoint, ImFontGlyph* oGlyph, float* oAdvanceX) -> bool {
+	const uint64_t key = computeKey(ioSrc, ioBaked);
+	if (key == 0) {
+		++m_stats.bypassed;
+		return m_inner->FontBakedLoadGlyph(ioAtlas, ioSrc, ioBaked, ioLoaderData, static_cast<ImWchar>(iCodepoint),
+										   oGlyph, oAdvanceX);
+	}
+	Page& page = getPage(key);
+	const GlyphRecord* record = nullptr;
+	const uint8_t* pixels = nullptr;
+	if (const auto itMapped = page.mapped.find(iCodepoint); itMapped != page.mapped.end()) {
+		record = itMapped->second;
+		pixels = page.mappedPixels + record->pixelOffset;
+	} else if (const auto itPending = page.pendingIndex.find(iCodepoint); itPending != page.pendingIndex.end()) {
+		record = &page.pending[itPending->second];
+		pixels = page.pendingPixels.data() + record->pixelOffset;
+	}
+
+	if (record != nullptr) {
+		++m_stats.hits;
+		if (oAdvanceX != nullptr) {
+			*oAdvanceX = record->advanceX;
+			return true;
+		}
+		oGlyph->Codepoint = iCodepoint;
+		oGlyph->AdvanceX = record->advanceX;
+		if ((record->flags & g_glyphVisible) == 0)
+			return true;
+		const ImFontAtlasRectId packId = ImFontAtlasPackAddRect(ioAtlas, record->width, record->height);
+		if (packId == ImFontAtlasRectId_Invalid) {
+			log_error("Font cache: out of atlas space for glyph {:#x}.", iCodepoint);
+			return false;
+		}
+		ImTextureRect* rect = ImFontAtlasPackGetRect(ioAtlas, packId);
+		oGlyph->X0 = record->x0;
+		oGlyph->Y0 = record->y0;
+		oGlyph->X1 = record->x1;
+		oGlyph->Y1 = record->y1;
+		oGlyph->Visible = 1;
+		oGlyph->PackId = packId;
+		ImFontAtlasBakedSetFontGlyphBitmap(ioAtlas, ioBaked, ioSrc, oGlyph, rect, pixels, ImTextureFormat_Alpha8,
+										   record->width);
+		return true;
+	}
+
+	// Cache miss: let the wrapped loader rasterize, then read the bitmap back from the atlas.
+	if (!m_inner->FontBakedLoadGlyph(ioAtlas, ioSrc, ioBaked, ioLoaderData, static_cast<ImWchar>(iCodepoint), oGlyph,
+									 oAdvanceX))
+		return false;
+	if (oAdvanceX != nullptr)
+		return true;
+	++m_stats.misses;
+	GlyphRecord newRecord{.codepoint = iCodepoint,
+						  .flags = oGlyph->Visible != 0 ? g_glyphVisible : 0u,
+						  .advanceX = oGlyph->AdvanceX,
+						  .x0 = oGlyph->X0,
+						  .y0 = oGlyph->Y0,
+						  .x1 = oGlyph->X1,
+						  .y1 = oGlyph->Y1,
+						  .width = 0,
+						  .height = 0,
+						  .pixelOffset = static_cast<uint32_t>(page.pendingPixels.size())};
+	if (oGlyph->Visible != 0) {
+		const ImTextureRect* rect = ImFontAtlasPackGetRect(ioAtlas, oGlyph->PackId);
+		ImTextureData* texture = ioAtlas->TexData;
+		newRecord.width = rect->w;
+		newRecord.height = rect->h;
+		page.pendingPixels.resize(page.pendingPixels.size() + static_cast<size_t>(rect->w) * rect->h);
+		uint8_t* destination = page.pendingPixels.data() + newRecord.pixelOffset;
+		for (int row = 0; row < rect->h; ++row) {
+			const auto* source = static_cast<const uint8_t*>(texture->GetPixelsAt(rect->x, rect->y + row));
+			for (int column = 0; column < rect->w; ++column) {
+				// RGBA32 atlases store the glyph coverage in the alpha channel.
+				*destination++ = texture->BytesPerPixel == 1 ? source[column] : source[column * 4 + 3];
+			}
+		}
+	}
+	page.pendingIndex.emplace(iCodepoint, page.pending.size());
+	page.pending.push_back(newRecord);
+	return true;
+}
+
+void FontCache::flush() {
+	if (std::ranges::all_of(m_pages, [](const auto& iPage) -> bool { return iPage.second.pending.empty(); }))
+		return;
+	std::error_code errorCode;
+	std::filesystem::create_directories(m_directory, errorCode);
+	if (errorCode) {
+		log_warn("Font cache: unable to create '{}': {}", m_directory.string(), errorCode.message());
+		return;
+	}
+	uint32_t written = 0;
+	for (auto& [key, page]: m_pages) {
+		if (page.pending.empty())
+			continue;
+		std::vector<GlyphRecord> records;
+		std::vector<uint8_t> pixels;
+		records.reserve(page.mapped.size() + page.pending.size());
+		const auto append = [&records, &pixels](const GlyphRecord& iRecord, const uint8_t* iPixels) -> void {
+			GlyphRecord copy = iRecord;
+			copy.pixelOffset = static_cast<uint32_t>(pixels.size());
+			pixels.insert(pixels.end(), iPixels, iPixels + static_cast<size_t>(iRecord.width) * iRecord.height);
+			records.push_back(copy);
+		};
+		for (const auto& record: page.mapped | std::views::values)
+			append(*record, page.mappedPixels + record->pixelOffset);
+		for (const auto& record: page.pending) append(record, page.pendingPixels.data() + record.pixelOffset);
+
+		// The mapping must be released before replacing the file.
+		page.mapped.clear();
+		page.mappedPixels = nullptr;
+		page.file.close();
+
+		const FileHeader header{.magic = g_fileMagic,
+								.version = g_fileVersion,
+								.key = key,
+								.glyphCount = static_cast<uint32_t>(records.size()),
+								.pixelBytes = static_cast<uint32_t>(pixels.size())};
+		const auto path = pagePath(key);
+		auto temporary = path;
+		temporary += ".tmp";
+		{
+			std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+			// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+			file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+			file.write(reinterpret_cast<const char*>(records.data()),
+					   static_cast<std::streamsize>(records.size() * sizeof(GlyphRecord)));
+			file.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+			// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+			if (!file.good())
+				log_warn("Font cache: failed to write '{}'.", temporary.string());
+		}
+		std::filesystem::rename(temporary, path, errorCode);
+		if (errorCode)
+			log_warn("Font cache: unable to replace '{}': {}", path.string(), errorCode.message());
+		page.pending.clear();
+		page.pendingIndex.clear();
+		page.pendingPixels.clear();
+		mapPage(page, key);
+		++written;
+	}
+	log_debug("Font cache: {} file(s) written ({} hits, {} misses, {} bypassed).", written, m_stats.hits,
+			  m_stats.misses, m_stats.bypassed);
+}
+
+}// namespace mvi::core::fonts
@@ -0,0 +1,206 @@
+/**
+ * @file FontCache.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/MappedFile.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+struct ImFontAtlas;
+struct ImFontConfig;
+struct ImFontBaked;
+struct ImFontGlyph;
+struct ImFontLoader;
+
+namespace mvi::core::fonts {
+
+/**
+ * @brief On-disk cache of rasterized glyphs.
+ *
+ * The cache wraps the atlas font loader: glyph bitmaps and metrics are stored in one file per
+ * (font data hash, size, rasterizer density, source configuration, glyph ranges) key. Cache files are
+ * memory-mapped when first needed, so a warm start only blits the cached pixels into the atlas.
+ */
+class FontCache final {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iDirectory The directory holding the cache files.
+	 */
+	explicit FontCache(std::filesystem::path iDirectory);
+	/**
+	 * @brief Destructor.
+	 */
+	~FontCache();
+
+	FontCache(const FontCache&) = delete;
+	FontCache(FontCache&&) = delete;
+	auto operator=(const FontCache&) -> FontCache& = delete;
+	auto operator=(FontCache&&) -> FontCache& = delete;
+
+	/**
+	 * @brief Install the caching loader on top of the atlas current font loader.
+	 * @param[in,out] ioAtlas The font atlas.
+	 *
+	 * @note Must be called before fonts are added to the atlas.
+	 */
+	void install(ImFontAtlas* ioAtlas);
+
+	/**
+	 * @brief Write the newly rasterized glyphs to disk.
+	 */
+	void flush();
+
+	/**
+	 * @brief Cache statistics.
+	 */
+	struct Stats {
+		/// Glyphs served from the cache.
+		uint32_t hits = 0;
+		/// Glyphs rasterized then stored in the cache.
+		uint32_t misses = 0;
+		/// Glyphs not cacheable (unsupported source configuration).
+		uint32_t bypassed = 0;
+		/// Number of mapped cache files.
+		uint32_t mappedPages = 0;
+	};
+
+	/**
+	 * @brief Get the cache statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> const Stats& { return m_stats; }
+
+	/**
+	 * @brief Get the loader wrapping the original one.
+	 * @return The caching loader.
+	 */
+	[[nodiscard]] static auto getLoader() -> const ImFontLoader*;
+
+	/**
+	 * @brief Get the loader wrapped by the cache.
+	 * @return The original loader.
+	 */
+	[[nodiscard]] auto getInnerLoader() const -> const ImFontLoader* { return m_inner; }
+
+	/**
+	 * @brief Load a glyph through the cache.
+	 * @param[in,out] ioAtlas The atlas.
+	 * @param[in,out] ioSrc The font source.
+	 * @param[in,out] ioBaked The baked font.
+	 * @param[in,out] ioLoaderData The inner loader per-baked data.
+	 * @param[in] iCodepoint The code point to load.
+	 * @param[out] oGlyph The glyph.
+	 * @param[out] oAdvanceX Advance only output.
+	 * @return True if the glyph exists.
+	 */
+	auto loadGlyph(ImFontAtlas* ioAtlas, ImFontConfig* ioSrc, ImFontBaked* ioBaked, void* ioLoaderData,
+				   uint32_t iCodepoint, ImFontGlyph* oGlyph, float* oAdvanceX) -> bool;
+
+	/**
+	 * @brief Register a font source.
+	 * @param[in] iSrc The font source.
+	 */
+	void registerSource(const ImFontConfig* iSrc);
+
+	/**
+	 * @brief Forget a font source.
+	 * @param[in] iSrc The font source.
+	 */
+	void unregisterSource(const ImFontConfig* iSrc);
+
+private:
+	/**
+	 * @brief Glyph entry as stored on disk.
+	 */
+	struct GlyphRecord {
+		/// Unicode code point.
+		uint32_t codepoint = 0;
+		/// Glyph flags.
+		uint32_t flags = 0;
+		/// Horizontal advance.
+		float advanceX = 0.f;
+		/// Glyph quad left.
+		float x0 = 0.f;
+		/// Glyph quad top.
+		float y0 = 0.f;
+		/// Glyph quad right.
+		float x1 = 0.f;
+		/// Glyph quad bottom.
+		float y1 = 0.f;
+		/// Bitmap width.
+		uint16_t width = 0;
+		/// Bitmap height.
+		uint16_t height = 0;
+		/// Offset of the Alpha8 pixels in the pixel block.
+		uint32_t pixelOffset = 0;
+	};
+	/// Flag: the glyph has a bitmap.
+	static constexpr uint32_t g_glyphVisible = 1u;
+
+	/**
+	 * @brief Glyphs of one cache key.
+	 */
+	struct Page {
+		/// Mapped file.
+		MappedFile file;
+		/// Mapped glyph index.
+		std::unordered_map<uint32_t, const GlyphRecord*> mapped;
+		/// Mapped pixel block.
+		const uint8_t* mappedPixels = nullptr;
+		/// Glyphs rasterized this session.
+		std::vector<GlyphRecord> pending;
+		/// Pending glyph index.
+		std::unordered_map<uint32_t, size_t> pendingIndex;
+		/// Pending pixel block.
+		std::vector<uint8_t> pendingPixels;
+	};
+
+	/**
+	 * @brief Get or map the page of a key.
+	 * @param[in] iKey The cache key.
+	 * @return The page.
+	 */
+	auto getPage(uint64_t iKey) -> Page&;
+	/**
+	 * @brief Map the cache file of a page and index its glyphs.
+	 * @param[in,out] ioPage The page.
+	 * @param[in] iKey The cache key.
+	 */
+	void mapPage(Page& ioPage, uint64_t iKey);
+	/**
+	 * @brief Compute the cache key of a baked font source.
+	 * @param[in] iSrc The font source.
+	 * @param[in] iBaked The baked font.
+	 * @return The key, or 0 if not cacheable.
+	 */
+	[[nodiscard]] auto computeKey(const ImFontConfig* iSrc, const ImFontBaked* iBaked) const -> uint64_t;
+	/**
+	 * @brief Get the file of a key.
+	 * @param[in] iKey The cache key.
+	 * @return The file path.
+	 */
+	[[nodiscard]] auto pagePath(uint64_t iKey) const -> std::filesystem::path;
+
+	/// Loader wrapped by the cache.
+	const ImFontLoader* m_inner = nullptr;
+	/// Cache directory.
+	std::filesystem::path m_directory;
+	/// Font data hash per source.
+	std::unordered_map<const ImFontConfig*, uint64_t> m_sourceHashes;
+	/// Pages by key.
+	std::unordered_map<uint64_t, Page> m_pages;
+	/// Statistics.
+	Stats m_stats;
+};
+
+}// namespace mvi::core::fonts
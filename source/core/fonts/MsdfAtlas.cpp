@@ -0,0 +1,448 @@
+/**
+ * @file MsdfAtlas.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "MsdfAtlas.h"
+
+#include "core/Log.h"
+#include "core/defines.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+MVI_DIAG_PUSH
+MVI_DIAG_DISABLE_CLANG("-Weverything")
+// Private instance of the rasterizer shipped with Dear ImGui, only used for outlines.
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imstb_truetype.h>
+MVI_DIAG_POP
+
+namespace mvi::core::fonts {
+
+namespace {
+
+/// Edge color channels.
+enum Channel : uint8_t {
+	Black = 0,
+	Red = 1,
+	Green = 2,
+	Yellow = 3,
+	Blue = 4,
+	Magenta = 5,
+	Cyan = 6,
+	White = 7,
+};
+
+/// Corner detection threshold: sine of the minimal angle between two edges (3 rad, as msdfgen).
+constexpr float g_cornerThreshold = 0.14112f;
+/// Segments used to flatten a quadratic curve.
+constexpr int g_quadSegments = 6;
+/// Segments used to flatten a cubic curve.
+constexpr int g_cubicSegments = 8;
+
+/**
+ * @brief Simple 2D point.
+ */
+struct Point {
+	/// Abscissa.
+	float x = 0.f;
+	/// Ordinate.
+	float y = 0.f;
+};
+
+auto operator-(const Point& iA, const Point& iB) -> Point { return {.x = iA.x - iB.x, .y = iA.y - iB.y}; }
+auto dot(const Point& iA, const Point& iB) -> float { return iA.x * iB.x + iA.y * iB.y; }
+auto cross(const Point& iA, const Point& iB) -> float { return iA.x * iB.y - iA.y * iB.x; }
+auto normalize(const Point& iA) -> Point {
+	const float length = std::sqrt(dot(iA, iA));
+	return length > 0.f ? Point{.x = iA.x / length, .y = iA.y / length} : Point{};
+}
+
+/**
+ * @brief Outline edge, flattened as a polyline.
+ */
+struct Edge {
+	/// Polyline points (at least 2).
+	std::vector<Point> points;
+	/// Channels of the edge.
+	uint8_t color = White;
+	/// Unit direction at the edge start.
+	[[nodiscard]] auto startDirection() const -> Point { return normalize(points[1] - points[0]); }
+	/// Unit direction at the edge end.
+	[[nodiscard]] auto endDirection() const -> Point {
+		return normalize(points[points.size() - 1] - points[points.size() - 2]);
+	}
+};
+
+using Contour = std::vector<Edge>;
+
+/**
+ * @brief Rotate to the next color, avoiding a banned one (msdfgen simple edge coloring).
+ * @param[in,out] ioColor The color.
+ * @param[in] iBanned The banned color.
+ */
+void switchColor(uint8_t& ioColor, const uint8_t iBanned = Black) {
+	if (const auto combined = static_cast<uint8_t>(ioColor & iBanned);
+		combined == Red || combined == Green || combined == Blue) {
+		ioColor = static_cast<uint8_t>(combined ^ White);
+		return;
+	}
+	if (ioColor == Black || ioColor == White) {
+		ioColor = Cyan;
+		return;
+	}
+	const auto shifted = static_cast<uint32_t>(ioColor) << 1u;
+	ioColor = static_cast<uint8_t>((shifted | shifted >> 3u) & White);
+}
+
+/**
+ * @brief Color the edges so that both sides of each corner are in different channels.
+ * @param[in,out] ioContour The contour.
+ */
+void colorEdges(Contour& ioContour) {
+	std::vector<size_t> corners;
+	for (size_t index = 0; index < ioContour.size(); ++index) {
+		const Point previous = ioContour[(index + ioContour.size() - 1) % ioContour.size()].endDirection();
+		const Point current = ioContour[index].startDirection();
+		if (dot(previous, current) <= 0.f || std::abs(cross(previous, current)) > g_cornerThreshold)
+			corners.push_back(index);
+	}
+	// Smooth contour: a single distance is enough.
+	if (corners.empty() || ioContour.size() < 3) {
+		for (auto& edge: ioContour) edge.color = White;
+		return;
+	}
+	uint8_t color = White;
+	switchColor(color);
+	if (corners.size() == 1) {
+		// Teardrop: split the contour in three colors around the corner.
+		const std::array<uint8_t, 3> colors = {color, White, [&color] {
+												   switchColor(color);
+												   return color;
+											   }()};
+		const size_t count = ioContour.size();
+		for (size_t index = 0; index < count; ++index) {
+			const auto position = static_cast<float>(index) / static_cast<float>(count - 1);
+			const auto third = static_cast<size_t>(std::clamp(static_cast<int>(position * 2.875f + 0.0625f), 0, 2));
+			ioContour[(corners.front() + index) % count].color = colors[third];
+		}
+		return;
+	}
+	const uint8_t initial = color;
+	size_t spline = 0;
+	const size_t start = corners.front();
+	for (size_t index = 0; index < ioContour.size(); ++index) {
+		const size_t edgeIndex = (start + index) % ioContour.size();
+		if (spline + 1 < corners.size() && corners[spline + 1] == edgeIndex) {
+			++spline;
+			switchColor(color, spline + 1 == corners.size() ? initial : static_cast<uint8_t>(Black));
+		}
+		ioContour[edgeIndex].color = color;
+	}
+}
+
+/**
+ * @brief Extract the contours of a glyph.
+ * @param[in] iInfo The font.
+ * @param[in] iGlyphIndex The glyph.
+ * @return The contours in font units.
+ */
+auto extractContours(const stbtt_fontinfo& iInfo, const int iGlyphIndex) -> std::vector<Contour> {
+	stbtt_vertex* vertices = nullptr;
+	const int count = stbtt_GetGlyphShape(&iInfo, iGlyphIndex, &vertices);
+	std::vector<Contour> contours;
+	Point pen;
+	for (int index = 0; index < count; ++index) {
+		const stbtt_vertex& vertex = vertices[index];
+		const Point to{.x = static_cast<float>(vertex.x), .y = static_cast<float>(vertex.y)};
+		if (vertex.type == STBTT_vmove) {
+			contours.emplace_back();
+			pen = to;
+			continue;
+		}
+		if (contours.empty())
+			contours.emplace_back();
+		Edge edge{.points = {pen}};
+		if (vertex.type == STBTT_vcurve) {
+			const Point control{.x = static_cast<float>(vertex.cx), .y = static_cast<float>(vertex.cy)};
+			for (int step = 1; step <= g_quadSegments; ++step) {
+				const float t = static_cast<float>(step) / g_quadSegments;
+				const float u = 1.f - t;
+				edge.points.push_back({.x = u * u * pen.x + 2.f * u * t * control.x + t * t * to.x,
+									   .y = u * u * pen.y + 2.f * u * t * control.y + t * t * to.y});
+			}
+		} else if (vertex.type == STBTT_vcubic) {
+			const Point control0{.x = static_cast<float>(vertex.cx), .y = static_cast<float>(vertex.cy)};
+			const Point control1{.x = static_cast<float>(vertex.cx1), .y = static_cast<float>(vertex.cy1)};
+			for (int step = 1; step <= g_cubicSegments; ++step) {
+				const float t = static_cast<float>(step) / g_cubicSegments;
+				const float u = 1.f - t;
+				edge.points.push_back(
+						{.x = u * u * u * pen.x + 3.f * u * u * t * control0.x + 3.f * u * t * t * control1.x +
+							  t * t * t * to.x,
+						 .y = u * u * u * pen.y + 3.f * u * u * t * control0.y + 3.f * u * t * t * control1.y +
+							  t * t * t * to.y});
+			}
+		} else
+			edge.points.push_back(to);
+		pen = to;
+		// Degenerated edges break the corner detection.
+		if (dot(edge.points.back() - edge.points.front(), edge.points.back() - edge.points.front()) > 0.f)
+			contours.back().push_back(std::move(edge));
+	}
+	stbtt_FreeShape(&iInfo, vertices);
+	std::erase_if(contours, [](const Contour& iContour) -> bool { return iContour.empty(); });
+	for (auto& contour: contours) colorEdges(contour);
+	return contours;
+}
+
+/**
+ * @brief Distance candidate of one channel.
+ */
+struct Candidate {
+	/// Unsigned distance to the nearest segment.
+	float distance = std::numeric_limits<float>::max();
+	/// Signed (pseudo-)distance, positive inside.
+	float signedDistance = 0.f;
+};
+
+/**
+ * @brief Evaluate the distance from a point to an edge and update the candidates.
+ * @param[in] iPoint The point.
+ * @param[in] iEdge The edge.
+ * @param[in] iOrientation Sign of the inside for the font contour direction.
+ * @param[in,out] ioChannels The per channel candidates.
+ * @param[in,out] ioTrue The true distance candidate.
+ */
+void evaluate(const Point& iPoint, const Edge& iEdge, const float iOrientation, std::array<Candidate, 3>& ioChannels,
+			  Candidate& ioTrue) {
+	const size_t last = iEdge.points.size() - 2;
+	for (size_t segment = 0; segment <= last; ++segment) {
+		const Point& start = iEdge.points[segment];
+		const Point direction = iEdge.points[segment + 1] - start;
+		const Point toPoint = iPoint - start;
+		const float length2 = dot(direction, direction);
+		if (length2 <= 0.f)
+			continue;
+		const float rawT = dot(toPoint, direction) / length2;
+		const float t = std::clamp(rawT, 0.f, 1.f);
+		const Point delta{.x = toPoint.x - direction.x * t, .y = toPoint.y - direction.y * t};
+		const float distance = std::sqrt(dot(delta, delta));
+		const float side = cross(direction, toPoint) * iOrientation;
+		float signedDistance = side >= 0.f ? distance : -distance;
+		// Beyond the edge ends, use the distance to the extended edge (pseudo-distance).
+		if ((segment == 0 && rawT < 0.f) || (segment == last && rawT > 1.f))
+			signedDistance = side / std::sqrt(length2);
+		if (distance < ioTrue.distance)
+			ioTrue = {.distance = distance, .signedDistance = side >= 0.f ? distance : -distance};
+		for (uint32_t channel = 0; channel < 3; ++channel) {
+			if ((iEdge.color & (1u << channel)) != 0 && distance < ioChannels[channel].distance)
+				ioChannels[channel] = {.distance = distance, .signedDistance = signedDistance};
+		}
+	}
+}
+
+/**
+ * @brief Compute the non-zero winding number of a point.
+ * @param[in] iPoint The point.
+ * @param[in] iContours The contours.
+ * @return The winding number.
+ */
+auto winding(const Point& iPoint, const std::vector<Contour>& iContours) -> int {
+	int result = 0;
+	for (const auto& contour: iContours) {
+		for (const auto& edge: contour) {
+			for (size_t segment = 0; segment + 1 < edge.points.size(); ++segment) {
+				const Point& start = edge.points[segment];
+				const Point& end = edge.points[segment + 1];
+				if (start.y <= iPoint.y) {
+					if (end.y > iPoint.y && cross(end - start, iPoint - start) > 0.f)
+						++result;
+				} else if (end.y <= iPoint.y && cross(end - start, iPoint - start) < 0.f)
+					--result;
+			}
+		}
+	}
+	return result;
+}
+
+/**
+ * @brief Signed area of the contours, to find the font contour direction.
+ * @param[in] iContours The contours.
+ * @return The signed area.
+ */
+auto signedArea(const std::vector<Contour>& iContours) -> float {
+	float area = 0.f;
+	for (const auto& contour: iContours)
+		for (const auto& edge: contour)
+			for (size_t segment = 0; segment + 1 < edge.points.size(); ++segment)
+				area += cross(edge.points[segment], edge.points[segment + 1]);
+	return area * 0.5f;
+}
+
+auto toByte(const float iValue) -> uint8_t {
+	return static_cast<uint8_t>(std::clamp(iValue * 255.f + 0.5f, 0.f, 255.f));
+}
+
+}// namespace
+
+MsdfAtlas::MsdfAtlas(Config iConfig) : m_config{std::move(iConfig)} {}
+
+MsdfAtlas::~MsdfAtlas() = default;
+
+auto MsdfAtlas::build(const std::span<const uint8_t> iFontData) -> bool {
+	const auto start = std::chrono::steady_clock::now();
+	stbtt_fontinfo info{};
+	if (stbtt_InitFont(&info, iFontData.data(), stbtt_GetFontOffsetForIndex(iFontData.data(), 0)) == 0) {
+		log_error("MSDF atlas: unable to read the font.");
+		return false;
+	}
+	// Font size units, as Dear ImGui: the size is the ascent to descent height.
+	const float unitScale = stbtt_ScaleForPixelHeight(&info, 1.f);
+	const float scale = unitScale * m_config.glyphSize;
+	const auto padding = static_cast<int>(std::ceil(m_config.pixelRange));
+	int ascent = 0;
+	int descent = 0;
+	int lineGap = 0;
+	stbtt_GetFontVMetrics(&info, &ascent, &descent, &lineGap);
+	m_ascent = static_cast<float>(ascent) * unitScale;
+	m_lineHeight = static_cast<float>(ascent - descent + lineGap) * unitScale;
+
+	/**
+	 * @brief Rendered glyph waiting to be packed.
+	 */
+	struct Bitmap {
+		/// Code point.
+		uint32_t codepoint = 0;
+		/// Width in pixels.
+		int width = 0;
+		/// Height in pixels.
+		int height = 0;
+		/// RGBA8 pixels.
+		std::vector<uint8_t> pixels;
+	};
+	std::vector<Bitmap> bitmaps;
+	m_glyphs.clear();
+	for (const auto& [first, last]: m_config.ranges) {
+		for (uint32_t codepoint = first; codepoint <= last; ++codepoint) {
+			const int glyphIndex = stbtt_FindGlyphIndex(&info, static_cast<int>(codepoint));
+			if (glyphIndex == 0)
+				continue;
+			int advance = 0;
+			int bearing = 0;
+			stbtt_GetGlyphHMetrics(&info, glyphIndex, &advance, &bearing);
+			Glyph& glyph = m_glyphs[codepoint];
+			glyph.advance = static_cast<float>(advance) * unitScale;
+			int boxX0 = 0;
+			int boxY0 = 0;
+			int boxX1 = 0;
+			int boxY1 = 0;
+			if (stbtt_IsGlyphEmpty(&info, glyphIndex) != 0 ||
+				stbtt_GetGlyphBox(&info, glyphIndex, &boxX0, &boxY0, &boxX1, &boxY1) == 0)
+				continue;
+			const auto contours = extractContours(info, glyphIndex);
+			if (contours.empty())
+				continue;
+			// TrueType outer contours are clockwise, CFF ones counter-clockwise.
+			const float orientation = signedArea(contours) < 0.f ? -1.f : 1.f;
+			Bitmap bitmap{.codepoint = codepoint,
+						  .width = static_cast<int>(std::ceil(static_cast<float>(boxX1 - boxX0) * scale)) + 2 * padding,
+						  .height = static_cast<int>(std::ceil(static_cast<float>(boxY1 - boxY0) * scale)) + 2 * padding,
+						  .pixels = {}};
+			bitmap.pixels.resize(static_cast<size_t>(bitmap.width) * static_cast<size_t>(bitmap.height) * 4);
+			const float rangeUnits = m_config.pixelRange / scale;
+			for (int row = 0; row < bitmap.height; ++row) {
+				for (int column = 0; column < bitmap.width; ++column) {
+					const Point point{
+							.x = static_cast<float>(boxX0) + (static_cast<float>(column - padding) + 0.5f) / scale,
+							.y = static_cast<float>(boxY1) - (static_cast<float>(row - padding) + 0.5f) / scale};
+					std::array<Candidate, 3> channels{};
+					Candidate trueDistance;
+					for (const auto& contour: contours)
+						for (const auto& edge: contour) evaluate(point, edge, orientation, channels, trueDistance);
+					std::array<float, 3> values{};
+					for (size_t channel = 0; channel < 3; ++channel)
+						values[channel] = channels[channel].signedDistance / rangeUnits + 0.5f;
+					// Correct the texels where the channel median disagrees with the true inside test.
+					const bool inside = winding(point, contours) != 0;
+					const float median = std::max(std::min(values[0], values[1]),
+												  std::min(std::max(values[0], values[1]), values[2]));
+					if (inside != (median > 0.5f)) {
+						const float trueValue =
+								(inside ? trueDistance.distance : -trueDistance.distance) / rangeUnits + 0.5f;
+						values.fill(trueValue);
+					}
+					uint8_t* texel = bitmap.pixels.data() +
+									 (static_cast<size_t>(row) * static_cast<size_t>(bitmap.width) +
+									  static_cast<size_t>(column)) *
+											 4;
+					texel[0] = toByte(values[0]);
+					texel[1] = toByte(values[1]);
+					texel[2] = toByte(values[2]);
+					texel[3] = 255;
+				}
+			}
+			glyph.x0 = (static_cast<float>(boxX0) * scale - static_cast<float>(padding)) / m_config.glyphSize;
+			glyph.y0 = -(static_cast<float>(boxY1) * scale + static_cast<float>(padding)) / m_config.glyphSize;
+			glyph.x1 = glyph.x0 + static_cast<float>(bitmap.width) / m_config.glyphSize;
+			glyph.y1 = glyph.y0 + static_cast<float>(bitmap.height) / m_config.glyphSize;
+			glyph.visible = true;
+			bitmaps.push_back(std::move(bitmap));
+		}
+	}
+
+	// Shelf packing, tallest glyphs first.
+	std::ranges::sort(bitmaps, std::greater{}, &Bitmap::height);
+	std::vector<std::pair<int, int>> positions(bitmaps.size());
+	const auto width = static_cast<int>(m_config.width);
+	int penX = 0;
+	int penY = 0;
+	int shelfHeight = 0;
+	for (size_t index = 0; index < bitmaps.size(); ++index) {
+		if (penX + bitmaps[index].width > width) {
+			penX = 0;
+			penY += shelfHeight;
+			shelfHeight = 0;
+		}
+		positions[index] = {penX, penY};
+		penX += bitmaps[index].width;
+		shelfHeight = std::max(shelfHeight, bitmaps[index].height);
+	}
+	m_height = static_cast<uint32_t>(penY + shelfHeight);
+	m_pixels.assign(static_cast<size_t>(m_config.width) * m_height * 4, 0);
+	for (size_t index = 0; index < bitmaps.size(); ++index) {
+		const auto& bitmap = bitmaps[index];
+		const auto [x, y] = positions[index];
+		for (int row = 0; row < bitmap.height; ++row)
+			std::memcpy(m_pixels.data() + (static_cast<size_t>(y + row) * m_config.width + static_cast<size_t>(x)) * 4,
+						bitmap.pixels.data() + static_cast<size_t>(row) * static_cast<size_t>(bitmap.width) * 4,
+						static_cast<size_t>(bitmap.width) * 4);
+		Glyph& glyph = m_glyphs[bitmap.codepoint];
+		glyph.u0 = static_cast<float>(x) / static_cast<float>(m_config.width);
+		glyph.v0 = static_cast<float>(y) / static_cast<float>(m_height);
+		glyph.u1 = static_cast<float>(x + bitmap.width) / static_cast<float>(m_config.width);
+		glyph.v1 = static_cast<float>(y + bitmap.height) / static_cast<float>(m_height);
+	}
+
+	m_stats = {.buildMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count(),
+			   .glyphs = static_cast<uint32_t>(m_glyphs.size()),
+			   .textureBytes = m_pixels.size()};
+	log_debug("MSDF atlas built: {} glyphs, {}x{} in {:.1f} ms.", m_stats.glyphs, m_config.width, m_height,
+			  m_stats.buildMs);
+	return true;
+}
+
+auto MsdfAtlas::findGlyph(const uint32_t iCodepoint) const -> const Glyph* {
+	if (const auto it = m_glyphs.find(iCodepoint); it != m_glyphs.end())
+		return &it->second;
+	return nullptr;
+}
+
+}// namespace mvi::core::fonts
@@ -0,0 +1,164 @@
+/**
+ * @file MsdfAtlas.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mvi::core::fonts {
+
+/**
+ * @brief Multi-channel signed distance field glyph atlas.
+ *
+ * Glyph outlines are converted to distance fields once, at a single reference size. The median of the
+ * three channels is the signed distance to the outline, sharp corners being kept by coloring the edges
+ * on each side of a corner in different channels. The same atlas is sampled at any display size.
+ */
+class MsdfAtlas final {
+public:
+	/**
+	 * @brief Atlas configuration.
+	 */
+	struct Config {
+		/// Reference glyph size in pixels.
+		float glyphSize = 32.f;
+		/// Distance range in atlas pixels.
+		float pixelRange = 4.f;
+		/// Atlas width.
+		uint32_t width = 512;
+		/// Code point ranges (inclusive).
+		std::vector<std::pair<uint32_t, uint32_t>> ranges = {{0x20, 0x7e}, {0xa0, 0xff}};
+	};
+
+	/**
+	 * @brief Glyph placement.
+	 *
+	 * Plane bounds are relative to the pen position on the baseline, in font size units.
+	 */
+	struct Glyph {
+		/// Horizontal advance.
+		float advance = 0.f;
+		/// Quad left.
+		float x0 = 0.f;
+		/// Quad top.
+		float y0 = 0.f;
+		/// Quad right.
+		float x1 = 0.f;
+		/// Quad bottom.
+		float y1 = 0.f;
+		/// Texture left.
+		float u0 = 0.f;
+		/// Texture top.
+		float v0 = 0.f;
+		/// Texture right.
+		float u1 = 0.f;
+		/// Texture bottom.
+		float v1 = 0.f;
+		/// If the glyph has a quad.
+		bool visible = false;
+	};
+
+	/**
+	 * @brief Build statistics.
+	 */
+	struct Stats {
+		/// Build duration in milliseconds.
+		float buildMs = 0.f;
+		/// Number of glyphs.
+		uint32_t glyphs = 0;
+		/// Bytes of the atlas pixels.
+		uint64_t textureBytes = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iConfig The atlas configuration.
+	 */
+	explicit MsdfAtlas(Config iConfig);
+	/**
+	 * @brief Default destructor.
+	 */
+	~MsdfAtlas();
+
+	MsdfAtlas(const MsdfAtlas&) = delete;
+	MsdfAtlas(MsdfAtlas&&) = delete;
+	auto operator=(const MsdfAtlas&) -> MsdfAtlas& = delete;
+	auto operator=(MsdfAtlas&&) -> MsdfAtlas& = delete;
+
+	/**
+	 * @brief Build the atlas from a TrueType font.
+	 * @param[in] iFontData The font file bytes.
+	 * @return True if the atlas is built.
+	 */
+	auto build(std::span<const uint8_t> iFontData) -> bool;
+
+	/**
+	 * @brief Find a glyph.
+	 * @param[in] iCodepoint The code point.
+	 * @return The glyph or nullptr if not in the atlas.
+	 */
+	[[nodiscard]] auto findGlyph(uint32_t iCodepoint) const -> const Glyph*;
+
+	/**
+	 * @brief Get the atlas pixels (RGBA8).
+	 * @return The pixels.
+	 */
+	[[nodiscard]] auto getPixels() const -> std::span<const uint8_t> { return m_pixels; }
+	/**
+	 * @brief Get the atlas width.
+	 * @return The width in pixels.
+	 */
+	[[nodiscard]] auto getWidth() const -> uint32_t { return m_config.width; }
+	/**
+	 * @brief Get the atlas height.
+	 * @return The height in pixels.
+	 */
+	[[nodiscard]] auto getHeight() const -> uint32_t { return m_height; }
+	/**
+	 * @brief Get the distance range.
+	 * @return The range in atlas pixels.
+	 */
+	[[nodiscard]] auto getPixelRange() const -> float { return m_config.pixelRange; }
+	/**
+	 * @brief Get the distance between two baselines.
+	 * @return The line height in font size units.
+	 */
+	[[nodiscard]] auto getLineHeight() const -> float { return m_lineHeight; }
+	/**
+	 * @brief Get the ascent.
+	 * @return The ascent in font size units.
+	 */
+	[[nodiscard]] auto getAscent() const -> float { return m_ascent; }
+	/**
+	 * @brief Get the build statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> const Stats& { return m_stats; }
+
+private:
+	/// Configuration.
+	Config m_config;
+	/// Glyphs by code point.
+	std::unordered_map<uint32_t, Glyph> m_glyphs;
+	/// Atlas pixels.
+	std::vector<uint8_t> m_pixels;
+	/// Atlas height.
+	uint32_t m_height = 0;
+	/// Line height.
+	float m_lineHeight = 1.f;
+	/// Ascent.
+	float m_ascent = 0.f;
+	/// Statistics.
+	Stats m_stats;
+};
+
+}// namespace mvi::core::fonts
@@ -0,0 +1,397 @@
+/**
+ * @file JobSystem.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "JobSystem.h"
+
+#include "core/Log.h"
+
+#ifdef MVI_ENGINE_USE_TBB
+#include <oneapi/tbb/task_arena.h>
+#endif
+
+namespace mvi::core::jobs {
+
+/**
+ * @brief Submitted job.
+ */
+struct Job {
+	/// The function to run.
+	std::function<void()> task;
+	/// The priority.
+	Priority priority = Priority::Background;
+	/// Dependencies not done, plus one until the submission ends.
+	std::atomic<uint32_t> pending = 1;
+	/// Completion flag.
+	std::atomic<bool> done = false;
+	/// Protect the dependents.
+	std::mutex mutex;
+	/// Completion flag, under the mutex.
+	bool finished = false;
+	/// Jobs waiting for this one.
+	std::vector<JobHandle> dependents;
+#ifdef MVI_ENGINE_USE_TBB
+	/// Set by the thread running the job, the arena task or a waiting thread.
+	std::atomic<bool> claimed = false;
+	/// Dependencies not done at the submission, under the mutex, released once run.
+	std::vector<JobHandle> dependencies;
+#endif
+};
+
+namespace {
+
+/**
+ * @brief Job system context of a thread.
+ */
+struct ThreadContext {
+	/// The job system of the thread.
+	const JobSystem* system = nullptr;
+	/// Statistics slot.
+	uint32_t slot = 0;
+	/// Computation worker index, ~0 if not a native computation worker.
+	uint32_t worker = ~0u;
+};
+
+thread_local ThreadContext g_threadContext;
+
+}// namespace
+
+struct JobSystem::Backend {
+#ifdef MVI_ENGINE_USE_TBB
+	/// Arenas by priority, with a slot reserved to the submitting thread.
+	std::array<tbb::task_arena, g_computePriorities> arenas;
+	/// Tasks enqueued and not yet returned, the arenas do not wait for them.
+	std::atomic<uint32_t> running = 0;
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iWorkers The number of workers.
+	 */
+	explicit Backend(const int iWorkers)
+		: arenas{tbb::task_arena(iWorkers + 1, 1, tbb::task_arena::priority::high),
+				 tbb::task_arena(iWorkers + 1, 1, tbb::task_arena::priority::low)} {
+		for (auto& arena: arenas) arena.initialize();
+	}
+#endif
+};
+
+void JobSystem::Queue::push(JobHandle iJob) {
+	const std::scoped_lock lock(mutex);
+	jobs.push_back(std::move(iJob));
+}
+
+auto JobSystem::Queue::popBack() -> JobHandle {
+	const std::scoped_lock lock(mutex);
+	if (jobs.empty())
+		return nullptr;
+	auto job = std::move(jobs.back());
+	jobs.pop_back();
+	return job;
+}
+
+auto JobSystem::Queue::popFront() -> JobHandle {
+	const std::scoped_lock lock(mutex);
+	if (jobs.empty())
+		return nullptr;
+	auto job = std::move(jobs.front());
+	jobs.pop_front();
+	return job;
+}
+
+JobSystem::JobSystem(const Config& iConfig) {
+	m_workerCount = iConfig.workers != 0 ? iConfig.workers : std::max(std::thread::hardware_concurrency(), 2u) - 1;
+	const uint32_t ioCount = std::max(iConfig.ioWorkers, 1u);
+	m_counters = std::vector<Counters>(m_workerCount + ioCount + 1);
+#ifdef MVI_ENGINE_USE_TBB
+	m_backend = std::make_unique<Backend>(static_cast<int>(m_workerCount));
+#else
+	m_workerQueues = std::vector<WorkerQueues>(m_workerCount);
+	m_workers.reserve(m_workerCount);
+	for (uint32_t i = 0; i < m_workerCount; ++i) m_workers.emplace_back([this, i]() -> void { workerLoop(i); });
+#endif
+	m_ioWorkers.reserve(ioCount);
+	for (uint32_t i = 0; i < ioCount; ++i)
+		m_ioWorkers.emplace_back([this, slot = m_workerCount + i]() -> void { ioLoop(slot); });
+	log_info("Job system started with {} workers and {} I/O workers{}.", m_workerCount, ioCount,
+			 usesTbb() ? " (TBB)" : "");
+}
+
+JobSystem::~JobSystem() {
+	// Let the submitted jobs complete, their dependents included.
+	while (m_outstanding.load(std::memory_order_acquire) != 0) {
+		const auto epoch = m_epoch.load(std::memory_order_acquire);
+		if (m_outstanding.load(std::memory_order_acquire) == 0)
+			break;
+		m_epoch.wait(epoch, std::memory_order_acquire);
+	}
+	m_stop.store(true, std::memory_order_release);
+	signal();
+	for (auto& worker: m_workers) {
+		if (worker.joinable())
+			worker.join();
+	}
+	for (auto& worker: m_ioWorkers) {
+		if (worker.joinable())
+			worker.join();
+	}
+#ifdef MVI_ENGINE_USE_TBB
+	while (m_backend->running.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+#endif
+	m_backend.reset();
+}
+
+auto JobSystem::submit(std::function<void()> iTask, const Priority iPriority,
+					   const std::span<const JobHandle> iDependencies) -> JobHandle {
+	auto job = std::make_shared<Job>();
+	job->task = std::move(iTask);
+	job->priority = iPriority;
+	m_outstanding.fetch_add(1, std::memory_order_relaxed);
+	for (const auto& dependency: iDependencies) {
+		if (dependency == nullptr)
+			continue;
+		const std::scoped_lock lock(dependency->mutex);
+		if (dependency->finished)
+			continue;
+		job->pending.fetch_add(1, std::memory_order_relaxed);
+		dependency->dependents.push_back(job);
+#ifdef MVI_ENGINE_USE_TBB
+		job->dependencies.push_back(dependency);
+#endif
+	}
+	if (job->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		schedule(job);
+	return job;
+}
+
+void JobSystem::waitFor(const JobHandle& iJob) {
+	if (iJob == nullptr)
+		return;
+	const uint32_t slot = currentSlot();
+#ifdef MVI_ENGINE_USE_TBB
+	// An arena thread blocked here would be lost for the other jobs, and nested waits could hold them all:
+	// the awaited job and its dependencies are run by the waiting thread when no arena thread took them yet.
+	while (!iJob->done.load(std::memory_order_acquire)) {
+		const auto epoch = m_epoch.load(std::memory_order_acquire);
+		if (iJob->done.load(std::memory_order_acquire))
+			break;
+		if (iJob->pending.load(std::memory_order_acquire) == 0) {
+			if (!iJob->claimed.exchange(true, std::memory_order_acq_rel)) {
+				execute(iJob, slot);
+				break;
+			}
+		} else {
+			std::vector<JobHandle> dependencies;
+			{
+				const std::scoped_lock lock(iJob->mutex);
+				dependencies = iJob->dependencies;
+			}
+			bool helped = false;
+			for (const auto& dependency: dependencies) {
+				helped = helped || !isDone(dependency);
+				waitFor(dependency);
+			}
+			if (helped)
+				continue;
+		}
+		m_epoch.wait(epoch, std::memory_order_acquire);
+	}
+#else
+	const bool ioWorker = slot >= m_workerCount && slot < m_workerCount + m_ioWorkers.size();
+	const uint32_t worker = g_threadContext.system == this ? g_threadContext.worker : ~0u;
+	while (!iJob->done.load(std::memory_order_acquire)) {
+		const auto epoch = m_epoch.load(std::memory_order_acquire);
+		if (iJob->done.load(std::memory_order_acquire))
+			break;
+		// Run other jobs instead of blocking, the awaited one may be behind them. Only the jobs of the same
+		// priority or above, a frame waiting on a critical job must not run the background ones.
+		JobHandle next;
+		bool stolen = false;
+		if (ioWorker)
+			next = m_ioQueue.popFront();
+		else
+			next = findJob(std::min(worker, m_workerCount), iJob->priority, stolen);
+		if (next != nullptr) {
+			if (stolen)
+				m_counters[slot].steals.fetch_add(1, std::memory_order_relaxed);
+			execute(next, slot);
+			continue;
+		}
+		m_epoch.wait(epoch, std::memory_order_acquire);
+	}
+#endif
+}
+
+auto JobSystem::isDone(const JobHandle& iJob) -> bool {
+	return iJob == nullptr || iJob->done.load(std::memory_order_acquire);
+}
+
+auto JobSystem::usesTbb() -> bool {
+#ifdef MVI_ENGINE_USE_TBB
+	return true;
+#else
+	return false;
+#endif
+}
+
+auto JobSystem::sampleStats() -> std::vector<WorkerStats> {
+	const auto now = std::chrono::steady_clock::now();
+	const double elapsed = std::chrono::duration<double>(now - m_sampleTime).count();
+	m_sampleTime = now;
+	std::vector<WorkerStats> stats;
+	stats.reserve(m_counters.size());
+	for (size_t i = 0; i < m_counters.size(); ++i) {
+		auto& counters = m_counters[i];
+		const uint64_t busy = counters.busyNs.load(std::memory_order_relaxed);
+		auto kind = ThreadKind::External;
+		if (i < m_workerCount)
+			kind = ThreadKind::Worker;
+		else if (i < m_workerCount + m_ioWorkers.size())
+			kind = ThreadKind::Io;
+		const double recent = static_cast<double>(busy - counters.sampledNs) * 1e-9;
+		stats.push_back({.kind = kind,
+						 .jobs = counters.jobs.load(std::memory_order_relaxed),
+						 .steals = counters.steals.load(std::memory_order_relaxed),
+						 .busySeconds = static_cast<double>(busy) * 1e-9,
+						 .utilization = elapsed > 0.0 ? recent / elapsed : 0.0});
+		counters.sampledNs = busy;
+	}
+	return stats;
+}
+
+void JobSystem::workerLoop(const uint32_t iIndex) {
+	g_threadContext = {.system = this, .slot = iIndex, .worker = iIndex};
+	while (true) {
+		const auto epoch = m_epoch.load(std::memory_order_acquire);
+		bool stolen = false;
+		if (const auto job = findJob(iIndex, Priority::Background, stolen); job != nullptr) {
+			if (stolen)
+				m_counters[iIndex].steals.fetch_add(1, std::memory_order_relaxed);
+			execute(job, iIndex);
+			continue;
+		}
+		if (m_stop.load(std::memory_order_acquire))
+			break;
+		m_epoch.wait(epoch, std::memory_order_acquire);
+	}
+}
+
+void JobSystem::ioLoop(const uint32_t iSlot) {
+	g_threadContext = {.system = this, .slot = iSlot, .worker = ~0u};
+	while (true) {
+		const auto epoch = m_epoch.load(std::memory_order_acquire);
+		if (const auto job = m_ioQueue.popFront(); job != nullptr) {
+			execute(job, iSlot);
+			continue;
+		}
+		if (m_stop.load(std::memory_order_acquire))
+			break;
+		m_epoch.wait(epoch, std::memory_order_acquire);
+	}
+}
+
+void JobSystem::schedule(JobHandle iJob) {
+	if (iJob->priority == Priority::Io) {
+		m_ioQueue.push(std::move(iJob));
+	} else {
+		const auto priority = static_cast<size_t>(iJob->priority);
+#ifdef MVI_ENGINE_USE_TBB
+		m_backend->running.fetch_add(1, std::memory_order_relaxed);
+		m_backend->arenas[priority].enqueue([this, job = std::move(iJob)]() -> void {
+			// A waiting thread may have run it already.
+			if (!job->claimed.exchange(true, std::memory_order_acq_rel))
+				execute(job, currentSlot());
+			m_backend->running.fetch_sub(1, std::memory_order_release);
+		});
+#else
+		// A worker keeps the jobs it submits, the other threads share theirs.
+		if (g_threadContext.system == this && g_threadContext.worker < m_workerCount)
+			m_workerQueues[g_threadContext.worker].queues[priority].push(std::move(iJob));
+		else
+			m_shared.queues[priority].push(std::move(iJob));
+#endif
+	}
+	signal();
+}
+
+auto JobSystem::findJob(const uint32_t iWorker, const Priority iLowest, bool& oStolen) -> JobHandle {
+	oStolen = false;
+	const size_t lowest = std::min(static_cast<size_t>(iLowest), g_computePriorities - 1);
+	for (size_t priority = 0; priority <= lowest; ++priority) {
+		if (iWorker < m_workerCount) {
+			if (auto job = m_workerQueues[iWorker].queues[priority].popBack(); job != nullptr)
+				return job;
+		}
+		if (auto job = m_shared.queues[priority].popFront(); job != nullptr)
+			return job;
+		for (uint32_t i = 1; i <= m_workerCount; ++i) {
+			const uint32_t victim = (iWorker + i) % m_workerCount;
+			if (victim == iWorker)
+				continue;
+			if (auto job = m_workerQueues[victim].queues[priority].popFront(); job != nullptr) {
+				oStolen = true;
+				return job;
+			}
+		}
+	}
+	return nullptr;
+}
+
+void JobSystem::execute(const JobHandle& iJob, const uint32_t iSlot) {
+	const auto start = std::chrono::steady_clock::now();
+	try {
+		iJob->task();
+	} catch (const std::exception& e) {
+		log_error("Job failed: {}", e.what());
+	} catch (...) {
+		log_error("Job failed with an unknown exception.");
+	}
+	const auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+	auto& counters = m_counters[iSlot];
+	counters.jobs.fetch_add(1, std::memory_order_relaxed);
+	counters.busyNs.fetch_add(static_cast<uint64_t>(busy.count()), std::memory_order_relaxed);
+	// Release the captures before the dependents run.
+	iJob->task = nullptr;
+
+	std::vector<JobHandle> dependents;
+	{
+		const std::scoped_lock lock(iJob->mutex);
+		iJob->finished = true;
+		dependents.swap(iJob->dependents);
+#ifdef MVI_ENGINE_USE_TBB
+		iJob->dependencies.clear();
+#endif
+	}
+	iJob->done.store(true, std::memory_order_release);
+	for (auto& dependent: dependents) {
+		if (dependent->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			schedule(std::move(dependent));
+	}
+	m_outstanding.fetch_sub(1, std::memory_order_acq_rel);
+	signal();
+}
+
+auto JobSystem::currentSlot() -> uint32_t {
+	if (g_threadContext.system == this)
+		return g_threadContext.slot;
+#ifdef MVI_ENGINE_USE_TBB
+	// Threads of the TBB arenas share the computation worker slots.
+	if (tbb::this_task_arena::current_thread_index() != tbb::task_arena::not_initialized) {
+		const uint32_t slot = std::min(m_nextSlot.fetch_add(1, std::memory_order_relaxed), m_workerCount - 1);
+		g_threadContext = {.system = this, .slot = slot, .worker = ~0u};
+		return slot;
+	}
+#endif
+	return static_cast<uint32_t>(m_counters.size() - 1);
+}
+
+void JobSystem::signal() {
+	m_epoch.fetch_add(1, std::memory_order_release);
+	m_epoch.notify_all();
+}
+
+}// namespace mvi::core::jobs
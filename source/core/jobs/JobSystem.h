@@ -0,0 +1,263 @@
+/**
+ * @file JobSystem.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace mvi::core::jobs {
+
+/**
+ * @brief Job priorities.
+ */
+enum class Priority : uint8_t {
+	Critical,///< Needed by the current frame, run first.
+	Background,///< Computation without deadline.
+	Io,///< Blocking operation (files, network), run on dedicated threads.
+};
+
+struct Job;
+/// Handle on a submitted job.
+using JobHandle = std::shared_ptr<Job>;
+
+/**
+ * @brief Pool of worker threads running jobs, with dependencies and priorities.
+ *
+ * Each worker owns a queue by priority, where the jobs it submits are pushed and popped last in first out;
+ * idle workers steal the oldest jobs of the others. Jobs submitted by other threads go to shared queues.
+ * A job runs once all its dependencies are done. Blocking jobs (Io priority) run on their own threads, so
+ * they never hold a computation worker.
+ *
+ * With TBB (MVI_ENGINE_USE_TBB), the computation jobs are enqueued into task arenas of matching priorities
+ * instead, TBB doing the work stealing.
+ */
+class JobSystem final {
+public:
+	/**
+	 * @brief Job system configuration.
+	 */
+	struct Config {
+		/// Computation workers, 0 for one per hardware thread except the main one.
+		uint32_t workers = 0;
+		/// Workers of the blocking jobs.
+		uint32_t ioWorkers = 1;
+	};
+
+	/**
+	 * @brief Kinds of threads running jobs.
+	 */
+	enum class ThreadKind : uint8_t {
+		Worker,///< Computation worker.
+		Io,///< Worker of the blocking jobs.
+		External,///< Other threads, helping while waiting.
+	};
+
+	/**
+	 * @brief Statistics of a thread running jobs.
+	 */
+	struct WorkerStats {
+		/// Kind of thread.
+		ThreadKind kind = ThreadKind::Worker;
+		/// Jobs run since start.
+		uint64_t jobs = 0;
+		/// Jobs stolen from other workers since start.
+		uint64_t steals = 0;
+		/// Time spent running jobs since start, in seconds.
+		double busySeconds = 0.0;
+		/// Part of the time spent running jobs since the previous sampling.
+		double utilization = 0.0;
+	};
+
+	/**
+	 * @brief Constructor, start the workers.
+	 * @param[in] iConfig The configuration.
+	 */
+	explicit JobSystem(const Config& iConfig);
+	/**
+	 * @brief Destructor, wait for all the submitted jobs then stop the workers.
+	 */
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem(JobSystem&&) = delete;
+	auto operator=(const JobSystem&) -> JobSystem& = delete;
+	auto operator=(JobSystem&&) -> JobSystem& = delete;
+
+	/**
+	 * @brief Submit a job.
+	 * @param[in] iTask The function to run.
+	 * @param[in] iPriority The priority.
+	 * @param[in] iDependencies The jobs to complete before this one.
+	 * @return The job handle.
+	 */
+	auto submit(std::function<void()> iTask, Priority iPriority = Priority::Background,
+				std::span<const JobHandle> iDependencies = {}) -> JobHandle;
+	/**
+	 * @brief Wait for a job to complete, running other jobs meanwhile.
+	 *
+	 * Only the jobs of the awaited priority or above are run. With TBB, the waiting thread runs the awaited job
+	 * and its dependencies if no arena thread took them yet, so it may be called from a job.
+	 * @param[in] iJob The job.
+	 */
+	void waitFor(const JobHandle& iJob);
+	/**
+	 * @brief Check if a job is complete.
+	 * @param[in] iJob The job.
+	 * @return True if done.
+	 */
+	[[nodiscard]] static auto isDone(const JobHandle& iJob) -> bool;
+
+	/**
+	 * @brief Get the number of computation workers.
+	 * @return The number of workers.
+	 */
+	[[nodiscard]] auto getWorkerCount() const -> uint32_t { return m_workerCount; }
+	/**
+	 * @brief Get the number of jobs submitted and not yet done.
+	 * @return The number of jobs.
+	 */
+	[[nodiscard]] auto getPendingJobs() const -> uint64_t { return m_outstanding.load(std::memory_order_relaxed); }
+	/**
+	 * @brief Check if the jobs run on TBB.
+	 * @return True if using TBB.
+	 */
+	[[nodiscard]] static auto usesTbb() -> bool;
+	/**
+	 * @brief Get the statistics of the threads, the utilization being measured since the previous call.
+	 * @return The statistics, computation workers first, then the blocking job workers and the external threads.
+	 */
+	auto sampleStats() -> std::vector<WorkerStats>;
+
+private:
+	/**
+	 * @brief Queue of ready jobs.
+	 */
+	struct Queue {
+		/// Protect the jobs.
+		std::mutex mutex;
+		/// The jobs.
+		std::deque<JobHandle> jobs;
+
+		/**
+		 * @brief Add a job at the back.
+		 * @param[in] iJob The job.
+		 */
+		void push(JobHandle iJob);
+		/**
+		 * @brief Take the newest job.
+		 * @return The job, null if empty.
+		 */
+		auto popBack() -> JobHandle;
+		/**
+		 * @brief Take the oldest job.
+		 * @return The job, null if empty.
+		 */
+		auto popFront() -> JobHandle;
+	};
+	/// Number of priorities run by the computation workers.
+	static constexpr size_t g_computePriorities = 2;
+	/**
+	 * @brief Queues of a computation worker.
+	 */
+	struct WorkerQueues {
+		/// Queues by priority.
+		std::array<Queue, g_computePriorities> queues;
+	};
+	/**
+	 * @brief Counters of a thread running jobs.
+	 */
+	struct Counters {
+		/// Jobs run.
+		std::atomic<uint64_t> jobs = 0;
+		/// Jobs stolen.
+		std::atomic<uint64_t> steals = 0;
+		/// Time spent running jobs, in nanoseconds.
+		std::atomic<uint64_t> busyNs = 0;
+		/// Busy time at the previous sampling, in nanoseconds.
+		uint64_t sampledNs = 0;
+	};
+
+	/**
+	 * @brief Computation worker loop.
+	 * @param[in] iIndex The worker index.
+	 */
+	void workerLoop(uint32_t iIndex);
+	/**
+	 * @brief Blocking job worker loop.
+	 * @param[in] iSlot The statistics slot.
+	 */
+	void ioLoop(uint32_t iSlot);
+	/**
+	 * @brief Queue a job whose dependencies are done.
+	 * @param[in] iJob The job.
+	 */
+	void schedule(JobHandle iJob);
+	/**
+	 * @brief Find a computation job to run.
+	 * @param[in] iWorker The worker index, or the worker count for an external thread.
+	 * @param[in] iLowest The lowest priority to look for.
+	 * @param[out] oStolen Set if the job is taken from another worker.
+	 * @return The job, null if none.
+	 */
+	auto findJob(uint32_t iWorker, Priority iLowest, bool& oStolen) -> JobHandle;
+	/**
+	 * @brief Run a job and release its dependents.
+	 * @param[in] iJob The job.
+	 * @param[in] iSlot The statistics slot of the thread.
+	 */
+	void execute(const JobHandle& iJob, uint32_t iSlot);
+	/**
+	 * @brief Get the statistics slot of the calling thread.
+	 * @return The slot.
+	 */
+	auto currentSlot() -> uint32_t;
+	/**
+	 * @brief Signal a change to the waiting threads (new job or completion).
+	 */
+	void signal();
+
+	/// Computation workers.
+	uint32_t m_workerCount = 0;
+	/// Stop request.
+	std::atomic<bool> m_stop = false;
+	/// Changes counter, waited on by the idle threads.
+	std::atomic<uint64_t> m_epoch = 0;
+	/// Jobs submitted and not yet done.
+	std::atomic<uint64_t> m_outstanding = 0;
+	/// Queues of the computation workers.
+	std::vector<WorkerQueues> m_workerQueues;
+	/// Queues of the jobs submitted by other threads.
+	WorkerQueues m_shared;
+	/// Queue of the blocking jobs.
+	Queue m_ioQueue;
+	/// Computation worker threads.
+	std::vector<std::thread> m_workers;
+	/// Blocking job worker threads.
+	std::vector<std::thread> m_ioWorkers;
+	/// Counters by thread: computation workers, blocking job workers, then the external threads.
+	std::vector<Counters> m_counters;
+	/// Next slot for the threads created by TBB.
+	std::atomic<uint32_t> m_nextSlot = 0;
+	/// Time of the previous sampling.
+	std::chrono::steady_clock::time_point m_sampleTime = std::chrono::steady_clock::now();
+	/// Backend specific data (TBB arenas).
+	struct Backend;
+	/// Backend specific data.
+	std::unique_ptr<Backend> m_backend;
+};
+
+}// namespace mvi::core::jobs
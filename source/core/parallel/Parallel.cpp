@@ -0,0 +1,80 @@
+/**
+ * @file Parallel.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Parallel.h"
+
+#include "core/jobs/JobSystem.h"
+
+#ifdef MVI_ENGINE_USE_TBB
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/partitioner.h>
+#include <oneapi/tbb/task_arena.h>
+#endif
+
+namespace mvi::core::parallel {
+
+namespace {
+
+/// Job system of the native backend.
+jobs::JobSystem* g_jobs = nullptr;
+/// Automatic chunks by thread, to balance the uneven chunks.
+constexpr size_t g_chunksPerThread = 8;
+
+}// namespace
+
+void setJobSystem(jobs::JobSystem* iJobs) { g_jobs = iJobs; }
+
+auto getConcurrency() -> size_t {
+#ifdef MVI_ENGINE_USE_TBB
+	return static_cast<size_t>(tbb::this_task_arena::max_concurrency());
+#else
+	return g_jobs != nullptr ? g_jobs->getWorkerCount() + 1 : 1;
+#endif
+}
+
+auto resolveGrain(const size_t iCount, const size_t iGrain) -> size_t {
+	if (iGrain != 0)
+		return iGrain;
+	return std::max<size_t>(iCount / (getConcurrency() * g_chunksPerThread), 1);
+}
+
+void forChunks(const size_t iCount, const size_t iGrain, const std::function<void(size_t, size_t)>& iBody) {
+	if (iCount == 0)
+		return;
+	const size_t grain = std::max<size_t>(iGrain, 1);
+#ifdef MVI_ENGINE_USE_TBB
+	tbb::parallel_for(
+			tbb::blocked_range<size_t>(0, iCount, grain),
+			[&iBody](const tbb::blocked_range<size_t>& iRange) -> void { iBody(iRange.begin(), iRange.end()); },
+			tbb::simple_partitioner());
+#else
+	const size_t chunks = (iCount + grain - 1) / grain;
+	const size_t threads = std::min(chunks, getConcurrency());
+	if (threads <= 1) {
+		// The chunks keep their size, a body may rely on it.
+		for (size_t begin = 0; begin < iCount; begin += grain) iBody(begin, std::min(begin + grain, iCount));
+		return;
+	}
+	// One job by helping thread, all taking the next chunk until none is left.
+	std::atomic<size_t> next = 0;
+	const auto run = [&next, &iBody, chunks, grain, iCount]() -> void {
+		for (size_t chunk = next.fetch_add(1, std::memory_order_relaxed); chunk < chunks;
+			 chunk = next.fetch_add(1, std::memory_order_relaxed))
+			iBody(chunk * grain, std::min((chunk + 1) * grain, iCount));
+	};
+	std::vector<jobs::JobHandle> helpers;
+	helpers.reserve(threads - 1);
+	for (size_t i = 1; i < threads; ++i) helpers.push_back(g_jobs->submit(run, jobs::Priority::Critical));
+	run();
+	for (const auto& helper: helpers) g_jobs->waitFor(helper);
+#endif
+}
+
+}// namespace mvi::core::parallel
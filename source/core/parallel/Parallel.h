@@ -0,0 +1,249 @@
+/**
+ * @file Parallel.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+namespace mvi::core::jobs {
+class JobSystem;
+}// namespace mvi::core::jobs
+
+/**
+ * @brief Data-parallel algorithms over index ranges and random access ranges.
+ *
+ * The work is cut into chunks of at most a grain of elements, run by the TBB scheduler when MVI_ENGINE_USE_TBB
+ * is defined, else by the job system given to setJobSystem(), the calling thread taking its share. Without job
+ * system, the chunks run in order on the calling thread. A grain of 0 selects about eight chunks by thread.
+ *
+ * The reductions and scans combine the chunk results in order, so their results only depend on the grain, not
+ * on the scheduling. The bodies must not throw.
+ */
+namespace mvi::core::parallel {
+
+/**
+ * @brief Set the job system running the chunks of the native backend.
+ * @param[in] iJobs The job system, null to run on the calling thread.
+ * @note To set while no parallel algorithm runs.
+ */
+void setJobSystem(jobs::JobSystem* iJobs);
+/**
+ * @brief Get the number of threads running the chunks.
+ * @return The number of threads, the calling one included.
+ */
+[[nodiscard]] auto getConcurrency() -> size_t;
+/**
+ * @brief Get the chunk size for a number of elements.
+ * @param[in] iCount The number of elements.
+ * @param[in] iGrain The requested grain, 0 for automatic.
+ * @return The chunk size, at least 1.
+ */
+[[nodiscard]] auto resolveGrain(size_t iCount, size_t iGrain) -> size_t;
+/**
+ * @brief Run a body over the chunks of an index range, in parallel.
+ * @param[in] iCount The number of indices.
+ * @param[in] iGrain The chunk size, at least 1.
+ * @param[in] iBody The body, called with the begin and end indices of a chunk.
+ */
+void forChunks(size_t iCount, size_t iGrain, const std::function<void(size_t, size_t)>& iBody);
+
+/**
+ * @brief Run a body over an index range, in parallel.
+ * @tparam Body The body type, callable with the begin and end indices of a chunk.
+ * @param[in] iBegin The first index.
+ * @param[in] iEnd The index after the last one.
+ * @param[in] iBody The body.
+ * @param[in] iGrain The maximal chunk size, 0 for automatic.
+ */
+template<typename Body>
+	requires std::invocable<Body&, size_t, size_t>
+void parallelFor(const size_t iBegin, const size_t iEnd, Body&& iBody, const size_t iGrain = 0) {
+	if (iEnd <= iBegin)
+		return;
+	const size_t count = iEnd - iBegin;
+	forChunks(count, resolveGrain(count, iGrain), [&iBody, iBegin](const size_t iFirst, const size_t iLast) -> void {
+		iBody(iBegin + iFirst, iBegin + iLast);
+	});
+}
+
+/**
+ * @brief Run a function on each element of a range, in parallel.
+ * @tparam Range The range type.
+ * @tparam Function The function type, callable with an element.
+ * @param[in,out] ioRange The range.
+ * @param[in] iFunction The function.
+ * @param[in] iGrain The maximal chunk size, 0 for automatic.
+ */
+template<std::ranges::random_access_range Range, typename Function>
+	requires std::invocable<Function&, std::ranges::range_reference_t<Range>>
+void parallelFor(Range&& ioRange, Function&& iFunction, const size_t iGrain = 0) {
+	const auto first = std::ranges::begin(ioRange);
+	parallelFor(
+			0, static_cast<size_t>(std::ranges::distance(ioRange)),
+			[&iFunction, first](const size_t iBegin, const size_t iEnd) -> void {
+				for (size_t i = iBegin; i < iEnd; ++i) iFunction(first[static_cast<std::ptrdiff_t>(i)]);
+			},
+			iGrain);
+}
+
+/**
+ * @brief Reduce an index range, in parallel.
+ * @tparam T The result type.
+ * @tparam Body The body type, reducing a chunk into an accumulator: T(size_t begin, size_t end, T accumulator).
+ * @tparam Join The join type, combining two results: T(T, T).
+ * @param[in] iBegin The first index.
+ * @param[in] iEnd The index after the last one.
+ * @param[in] iIdentity The identity of the join.
+ * @param[in] iBody The body.
+ * @param[in] iJoin The join, associative.
+ * @param[in] iGrain The maximal chunk size, 0 for automatic.
+ * @return The reduction.
+ */
+template<typename T, typename Body, typename Join>
+auto parallelReduce(const size_t iBegin, const size_t iEnd, const T& iIdentity, Body&& iBody, Join&& iJoin,
+					const size_t iGrain = 0) -> T {
+	if (iEnd <= iBegin)
+		return iIdentity;
+	const size_t count = iEnd - iBegin;
+	const size_t grain = resolveGrain(count, iGrain);
+	std::vector<T> partials((count + grain - 1) / grain, iIdentity);
+	forChunks(partials.size(), 1, [&](const size_t iFirst, const size_t iLast) -> void {
+		for (size_t chunk = iFirst; chunk < iLast; ++chunk) {
+			const size_t begin = iBegin + chunk * grain;
+			partials[chunk] = iBody(begin, std::min(begin + grain, iEnd), iIdentity);
+		}
+	});
+	T result = iIdentity;
+	for (auto& partial: partials) result = iJoin(std::move(result), std::move(partial));
+	return result;
+}
+
+/**
+ * @brief Reduce the elements of a range, in parallel.
+ * @tparam Range The range type.
+ * @tparam T The result type.
+ * @tparam Operation The operation type: T(T, element), also combining two results: T(T, T).
+ * @param[in] iRange The range.
+ * @param[in] iIdentity The identity of the operation.
+ * @param[in] iOperation The operation, associative.
+ * @param[in] iGrain The maximal chunk size, 0 for automatic.
+ * @return The reduction.
+ */
+template<std::ranges::random_access_range Range, typename T, typename Operation = std::plus<>>
+auto parallelReduce(const Range& iRange, const T& iIdentity, Operation iOperation = {}, const size_t iGrain = 0)
+		-> T {
+	const auto first = std::ranges::begin(iRange);
+	return parallelReduce(
+			0, static_cast<size_t>(std::ranges::distance(iRange)), iIdentity,
+			[&iOperation, first](const size_t iBegin, const size_t iEnd, T iAccumulator) -> T {
+				for (size_t i = iBegin; i < iEnd; ++i)
+					iAccumulator = iOperation(std::move(iAccumulator), first[static_cast<std::ptrdiff_t>(i)]);
+				return iAccumulator;
+			},
+			iOperation, iGrain);
+}
+
+/**
+ * @brief Sort a range, in parallel.
+ *
+ * The chunks are sorted in parallel, then merged by pairs, each round of merges running in parallel.
+ * @tparam Range The range type.
+ * @tparam Compare The comparison type.
+ * @param[in,out] ioRange The range.
+ * @param[in] iCompare The comparison.
+ * @param[in] iGrain The maximal size of the chunks sorted alone, 0 for automatic.
+ */
+template<std::ranges::random_access_range Range, typename Compare = std::ranges::less>
+	requires std::sortable<std::ranges::iterator_t<Range>, Compare>
+void parallelSort(Range&& ioRange, Compare iCompare = {}, const size_t iGrain = 0) {
+	const auto first = std::ranges::begin(ioRange);
+	const auto count = static_cast<size_t>(std::ranges::distance(ioRange));
+	const auto at = [first](const size_t iIndex) -> auto { return first + static_cast<std::ptrdiff_t>(iIndex); };
+	const size_t grain = resolveGrain(count, iGrain);
+	if (count <= grain) {
+		std::sort(at(0), at(count), iCompare);
+		return;
+	}
+	// The merges expect chunks aligned on the grain.
+	forChunks((count + grain - 1) / grain, 1, [&](const size_t iFirst, const size_t iLast) -> void {
+		for (size_t chunk = iFirst; chunk < iLast; ++chunk)
+			std::sort(at(chunk * grain), at(std::min((chunk + 1) * grain, count)), iCompare);
+	});
+	for (size_t width = grain; width < count; width *= 2) {
+		const size_t pairs = (count + 2 * width - 1) / (2 * width);
+		forChunks(pairs, 1, [&](const size_t iFirst, const size_t iLast) -> void {
+			for (size_t pair = iFirst; pair < iLast; ++pair) {
+				const size_t begin = pair * 2 * width;
+				if (const size_t middle = begin + width; middle < count)
+					std::inplace_merge(at(begin), at(middle), at(std::min(middle + width, count)), iCompare);
+			}
+		});
+	}
+}
+
+/**
+ * @brief Inclusive scan of a range, in parallel.
+ *
+ * The chunk totals are computed in parallel, scanned in order, then the chunks are scanned in parallel from
+ * their offset: the operation is applied about twice per element.
+ * @tparam Range The input range type.
+ * @tparam Output The output iterator type, random access.
+ * @tparam T The result type.
+ * @tparam Operation The operation type: T(T, element), also combining two results: T(T, T).
+ * @param[in] iRange The input range.
+ * @param[out] oFirst The beginning of the output, the same size as the input, may be the input.
+ * @param[in] iInit The value before the first element.
+ * @param[in] iOperation The operation, associative.
+ * @param[in] iGrain The maximal chunk size, 0 for automatic.
+ * @return The total, the last scanned value.
+ */
+template<std::ranges::random_access_range Range, std::random_access_iterator Output, typename T,
+		 typename Operation = std::plus<>>
+auto parallelScan(const Range& iRange, Output oFirst, const T& iInit, Operation iOperation = {},
+				  const size_t iGrain = 0) -> T {
+	const auto first = std::ranges::begin(iRange);
+	const auto count = static_cast<size_t>(std::ranges::distance(iRange));
+	if (count == 0)
+		return iInit;
+	const size_t grain = resolveGrain(count, iGrain);
+	const size_t chunks = (count + grain - 1) / grain;
+	const auto element = [first](const size_t iIndex) -> decltype(auto) {
+		return first[static_cast<std::ptrdiff_t>(iIndex)];
+	};
+	std::vector<T> offsets(chunks, iInit);
+	forChunks(chunks - 1, 1, [&](const size_t iFirst, const size_t iLast) -> void {
+		for (size_t chunk = iFirst; chunk < iLast; ++chunk) {
+			const size_t begin = chunk * grain;
+			T total = static_cast<T>(element(begin));
+			for (size_t i = begin + 1; i < begin + grain; ++i) total = iOperation(std::move(total), element(i));
+			offsets[chunk + 1] = std::move(total);
+		}
+	});
+	for (size_t chunk = 1; chunk < chunks; ++chunk)
+		offsets[chunk] = iOperation(offsets[chunk - 1], std::move(offsets[chunk]));
+	T result = iInit;
+	forChunks(chunks, 1, [&](const size_t iFirst, const size_t iLast) -> void {
+		for (size_t chunk = iFirst; chunk < iLast; ++chunk) {
+			const size_t end = std::min((chunk + 1) * grain, count);
+			T value = offsets[chunk];
+			for (size_t i = chunk * grain; i < end; ++i) {
+				value = iOperation(std::move(value), element(i));
+				oFirst[static_cast<std::ptrdiff_t>(i)] = value;
+			}
+			if (end == count)
+				result = std::move(value);
+		}
+	});
+	return result;
+}
+
+}// namespace mvi::core::parallel
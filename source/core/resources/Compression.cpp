@@ -0,0 +1,133 @@
+/**
+ * @file Compression.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Compression.h"
+
+#include <cstring>
+
+namespace mvi::core::resources {
+
+namespace {
+
+/// Shortest back-reference.
+constexpr size_t g_minMatch = 4;
+/// Largest back-reference distance.
+constexpr size_t g_maxOffset = 65535;
+/// Bytes at the end of the block always stored as literals.
+constexpr size_t g_lastLiterals = 5;
+/// Size of the match finder table (log2).
+constexpr uint32_t g_hashBits = 14;
+/// Length nibble meaning 'more length bytes follow'.
+constexpr size_t g_lengthEscape = 15;
+
+auto read32(const uint8_t* iPtr) -> uint32_t {
+	uint32_t value = 0;
+	std::memcpy(&value, iPtr, sizeof(value));
+	return value;
+}
+
+auto hash(const uint32_t iValue) -> uint32_t { return (iValue * 2654435761u) >> (32u - g_hashBits); }
+
+void writeLength(std::vector<uint8_t>& ioOutput, size_t iLength) {
+	while (iLength >= 255) {
+		ioOutput.push_back(255);
+		iLength -= 255;
+	}
+	ioOutput.push_back(static_cast<uint8_t>(iLength));
+}
+
+void writeSequence(std::vector<uint8_t>& ioOutput, const std::span<const uint8_t> iLiterals, const size_t iOffset,
+				   const size_t iMatchLength) {
+	const size_t literalToken = std::min(iLiterals.size(), g_lengthEscape);
+	const size_t matchToken = iMatchLength == 0 ? 0 : std::min(iMatchLength - g_minMatch, g_lengthEscape);
+	ioOutput.push_back(static_cast<uint8_t>(literalToken << 4u | matchToken));
+	if (literalToken == g_lengthEscape)
+		writeLength(ioOutput, iLiterals.size() - g_lengthEscape);
+	ioOutput.insert(ioOutput.end(), iLiterals.begin(), iLiterals.end());
+	// The last sequence has no match.
+	if (iMatchLength == 0)
+		return;
+	ioOutput.push_back(static_cast<uint8_t>(iOffset & 0xffu));
+	ioOutput.push_back(static_cast<uint8_t>(iOffset >> 8u));
+	if (matchToken == g_lengthEscape)
+		writeLength(ioOutput, iMatchLength - g_minMatch - g_lengthEscape);
+}
+
+auto readLength(const std::span<const uint8_t> iData, size_t& ioPosition, size_t& ioLength) -> bool {
+	uint8_t byte = 0;
+	do {
+		if (ioPosition >= iData.size())
+			return false;
+		byte = iData[ioPosition++];
+		ioLength += byte;
+	} while (byte == 255);
+	return true;
+}
+
+}// namespace
+
+auto compress(const std::span<const uint8_t> iData) -> std::vector<uint8_t> {
+	std::vector<uint8_t> output;
+	output.reserve(iData.size() / 2 + 16);
+	std::vector<uint32_t> table(size_t{1} << g_hashBits, 0);
+	size_t anchor = 0;
+	size_t position = 0;
+	while (position + g_minMatch + g_lastLiterals <= iData.size()) {
+		const uint32_t sequence = read32(iData.data() + position);
+		uint32_t& slot = table[hash(sequence)];
+		const size_t candidate = slot;
+		slot = static_cast<uint32_t>(position);
+		if (candidate >= position || position - candidate > g_maxOffset ||
+			read32(iData.data() + candidate) != sequence) {
+			++position;
+			continue;
+		}
+		size_t length = g_minMatch;
+		const size_t maxLength = iData.size() - g_lastLiterals - position;
+		while (length < maxLength && iData[candidate + length] == iData[position + length]) ++length;
+		writeSequence(output, iData.subspan(anchor, position - anchor), position - candidate, length);
+		position += length;
+		anchor = position;
+	}
+	writeSequence(output, iData.subspan(anchor), 0, 0);
+	return output;
+}
+
+auto decompress(const std::span<const uint8_t> iData, const std::span<uint8_t> oOutput) -> bool {
+	size_t input = 0;
+	size_t output = 0;
+	while (input < iData.size()) {
+		const uint8_t token = iData[input++];
+		size_t literals = token >> 4u;
+		if (literals == g_lengthEscape && !readLength(iData, input, literals))
+			return false;
+		if (literals > iData.size() - input || literals > oOutput.size() - output)
+			return false;
+		std::memcpy(oOutput.data() + output, iData.data() + input, literals);
+		input += literals;
+		output += literals;
+		if (input == iData.size())
+			break;
+		if (iData.size() - input < 2)
+			return false;
+		const size_t offset = static_cast<size_t>(iData[input]) | static_cast<size_t>(iData[input + 1]) << 8u;
+		input += 2;
+		size_t length = token & 0xfu;
+		if (length == g_lengthEscape && !readLength(iData, input, length))
+			return false;
+		length += g_minMatch;
+		if (offset == 0 || offset > output || length > oOutput.size() - output)
+			return false;
+		// Back-references may overlap the bytes being written.
+		for (size_t index = 0; index < length; ++index, ++output) oOutput[output] = oOutput[output - offset];
+	}
+	return output == oOutput.size();
+}
+
+}// namespace mvi::core::resources
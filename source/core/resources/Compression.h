@@ -0,0 +1,36 @@
+/**
+ * @file Compression.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace mvi::core::resources {
+
+/**
+ * @brief Compress a block of bytes.
+ *
+ * The block format is a byte-oriented LZ77 (LZ4 like): each sequence holds a literal run followed by a
+ * back-reference in a 64 KiB window. Decompression is a single pass without allocation.
+ *
+ * @param[in] iData The bytes to compress.
+ * @return The compressed block.
+ */
+[[nodiscard]] auto compress(std::span<const uint8_t> iData) -> std::vector<uint8_t>;
+
+/**
+ * @brief Decompress a block of bytes.
+ * @param[in] iData The compressed block.
+ * @param[out] oOutput The output buffer, sized to the uncompressed size.
+ * @return True if the block is valid and fills exactly the output.
+ */
+[[nodiscard]] auto decompress(std::span<const uint8_t> iData, std::span<uint8_t> oOutput) -> bool;
+
+}// namespace mvi::core::resources
@@ -0,0 +1,184 @@
+/**
+ * @file ResourcePack.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ResourcePack.h"
+
+#include "Compression.h"
+#include "core/Hash.h"
+#include "core/Log.h"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+
+namespace mvi::core::resources {
+
+namespace {
+
+/// Pack file magic ('MVRP').
+constexpr uint32_t g_packMagic = 0x5052564du;
+/// Pack format version.
+constexpr uint32_t g_packVersion = 1;
+
+}// namespace
+
+ResourcePack::ResourcePack(const std::filesystem::path& iPath) { open(iPath); }
+
+auto ResourcePack::open(const std::filesystem::path& iPath) -> bool {
+	close();
+	if (!m_file.open(iPath))
+		return false;
+	const auto bytes = m_file.data();
+	Header header;
+	if (bytes.size() < sizeof(Header)) {
+		log_error("Resource pack '{}' is truncated.", iPath.string());
+		close();
+		return false;
+	}
+	std::memcpy(&header, bytes.data(), sizeof(Header));
+	if (header.magic != g_packMagic || header.version != g_packVersion) {
+		log_error("Resource pack '{}' has an unsupported format.", iPath.string());
+		close();
+		return false;
+	}
+	const uint64_t indexBytes = uint64_t{header.entryCount} * sizeof(Entry);
+	if (header.indexOffset % alignof(Entry) != 0 || header.indexOffset + indexBytes > bytes.size() ||
+		header.namesOffset > bytes.size()) {
+		log_error("Resource pack '{}' has a corrupted index.", iPath.string());
+		close();
+		return false;
+	}
+	m_entries = {reinterpret_cast<const Entry*>(bytes.data() + header.indexOffset), header.entryCount};
+	m_names = {reinterpret_cast<const char*>(bytes.data() + header.namesOffset), bytes.size() - header.namesOffset};
+	for (const auto& entry: m_entries) {
+		if (entry.dataOffset + entry.storedSize > bytes.size() ||
+			uint64_t{entry.nameOffset} + entry.nameLength > m_names.size()) {
+			log_error("Resource pack '{}' has a corrupted entry.", iPath.string());
+			close();
+			return false;
+		}
+	}
+	log_debug("Resource pack '{}' mapped: {} entries.", iPath.string(), m_entries.size());
+	return true;
+}
+
+void ResourcePack::close() {
+	const std::lock_guard lock(m_mutex);
+	m_expanded.clear();
+	m_expandedBytes = 0;
+	m_entries = {};
+	m_names = {};
+	m_file.close();
+}
+
+auto ResourcePack::contains(const std::string_view iName) const -> bool { return find(iName) != nullptr; }
+
+auto ResourcePack::get(const std::string_view iName) -> std::span<const uint8_t> {
+	const Entry* entry = find(iName);
+	if (entry == nullptr)
+		return {};
+	const auto stored = m_file.data().subspan(entry->dataOffset, entry->storedSize);
+	if (entry->codec == Codec::Stored)
+		return stored;
+	const std::lock_guard lock(m_mutex);
+	if (const auto it = m_expanded.find(entry); it != m_expanded.end())
+		return it->second;
+	std::vector<uint8_t> expanded(entry->rawSize);
+	if (!decompress(stored, expanded)) {
+		log_error("Resource '{}' is corrupted.", iName);
+		return {};
+	}
+	m_expandedBytes += expanded.size();
+	return m_expanded.emplace(entry, std::move(expanded)).first->second;
+}
+
+auto ResourcePack::getNames() const -> std::vector<std::string_view> {
+	std::vector<std::string_view> names;
+	names.reserve(m_entries.size());
+	for (const auto& entry: m_entries) names.push_back(getName(entry));
+	return names;
+}
+
+auto ResourcePack::getStats() const -> Stats {
+	const std::lock_guard lock(m_mutex);
+	return {.entries = static_cast<uint32_t>(m_entries.size()),
+			.expanded = static_cast<uint32_t>(m_expanded.size()),
+			.packBytes = m_file.size(),
+			.expandedBytes = m_expandedBytes};
+}
+
+auto ResourcePack::find(const std::string_view iName) const -> const Entry* {
+	const uint64_t nameHash = hashString(iName);
+	for (auto it = std::ranges::lower_bound(m_entries, nameHash, {}, &Entry::nameHash);
+		 it != m_entries.end() && it->nameHash == nameHash; ++it) {
+		if (getName(*it) == iName)
+			return &*it;
+	}
+	return nullptr;
+}
+
+auto ResourcePack::getName(const Entry& iEntry) const -> std::string_view {
+	return m_names.substr(iEntry.nameOffset, iEntry.nameLength);
+}
+
+auto ResourcePack::write(const std::filesystem::path& iPath, const std::span<const Input> iInputs,
+						 const bool iCompress) -> bool {
+	std::ofstream file(iPath, std::ios::binary | std::ios::trunc);
+	if (!file) {
+		log_error("Unable to create resource pack '{}'.", iPath.string());
+		return false;
+	}
+	const auto writeBytes = [&file](const void* iData, const size_t iSize) {
+		file.write(static_cast<const char*>(iData), static_cast<std::streamsize>(iSize));
+	};
+	std::vector<Entry> entries;
+	std::string names;
+	uint64_t offset = sizeof(Header);
+	file.seekp(static_cast<std::streamoff>(offset));
+	for (const auto& [name, data]: iInputs) {
+		Entry entry{.nameHash = hashString(name),
+					.dataOffset = offset,
+					.storedSize = data.size(),
+					.rawSize = data.size(),
+					.nameOffset = static_cast<uint32_t>(names.size()),
+					.nameLength = static_cast<uint16_t>(name.size()),
+					.codec = Codec::Stored};
+		names += name;
+		std::vector<uint8_t> packed;
+		if (iCompress)
+			packed = compress(data);
+		if (iCompress && packed.size() < data.size()) {
+			entry.storedSize = packed.size();
+			entry.codec = Codec::Compressed;
+			writeBytes(packed.data(), packed.size());
+		} else
+			writeBytes(data.data(), data.size());
+		offset += entry.storedSize;
+		log_info("  {} : {} -> {} bytes", name, entry.rawSize, entry.storedSize);
+		entries.push_back(entry);
+	}
+	std::ranges::sort(entries, {}, &Entry::nameHash);
+	// Align the index so it can be read in place.
+	const uint64_t padding = (alignof(Entry) - offset % alignof(Entry)) % alignof(Entry);
+	constexpr std::array<uint8_t, alignof(Entry)> zeros{};
+	writeBytes(zeros.data(), padding);
+	const Header header{.magic = g_packMagic,
+						.version = g_packVersion,
+						.entryCount = static_cast<uint32_t>(entries.size()),
+						.reserved = 0,
+						.indexOffset = offset + padding,
+						.namesOffset = offset + padding + entries.size() * sizeof(Entry)};
+	writeBytes(entries.data(), entries.size() * sizeof(Entry));
+	writeBytes(names.data(), names.size());
+	file.seekp(0);
+	writeBytes(&header, sizeof(Header));
+	return file.good();
+}
+
+}// namespace mvi::core::resources
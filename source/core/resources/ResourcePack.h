@@ -0,0 +1,206 @@
+/**
+ * @file ResourcePack.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/MappedFile.h"
+
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace mvi::core::resources {
+
+/**
+ * @brief Indexed archive of resources.
+ *
+ * The pack is memory-mapped when opened; only its index is read. Compressed entries are expanded on
+ * first access and kept for the lifetime of the pack, stored entries are served from the mapping.
+ */
+class ResourcePack final {
+public:
+	/**
+	 * @brief Entry storage.
+	 */
+	enum struct Codec : uint16_t {
+		/// Raw bytes.
+		Stored,
+		/// Compressed block (see compress()).
+		Compressed,
+	};
+
+	/**
+	 * @brief Resource to write in a pack.
+	 */
+	struct Input {
+		/// Resource name.
+		std::string name;
+		/// Resource bytes.
+		std::vector<uint8_t> data;
+	};
+
+	/**
+	 * @brief Pack statistics.
+	 */
+	struct Stats {
+		/// Number of entries.
+		uint32_t entries = 0;
+		/// Number of expanded entries.
+		uint32_t expanded = 0;
+		/// Bytes of the mapped pack.
+		uint64_t packBytes = 0;
+		/// Bytes allocated for expanded entries.
+		uint64_t expandedBytes = 0;
+	};
+
+	/**
+	 * @brief Default constructor.
+	 */
+	ResourcePack() = default;
+	/**
+	 * @brief Constructor opening a pack.
+	 * @param[in] iPath The pack file.
+	 */
+	explicit ResourcePack(const std::filesystem::path& iPath);
+	/**
+	 * @brief Default destructor.
+	 */
+	~ResourcePack() = default;
+
+	ResourcePack(const ResourcePack&) = delete;
+	ResourcePack(ResourcePack&&) = delete;
+	auto operator=(const ResourcePack&) -> ResourcePack& = delete;
+	auto operator=(ResourcePack&&) -> ResourcePack& = delete;
+
+	/**
+	 * @brief Open a pack file.
+	 * @param[in] iPath The pack file.
+	 * @return True if the pack is valid.
+	 */
+	auto open(const std::filesystem::path& iPath) -> bool;
+
+	/**
+	 * @brief Close the pack and release the expanded entries.
+	 */
+	void close();
+
+	/**
+	 * @brief Check if a pack is open.
+	 * @return True if open.
+	 */
+	[[nodiscard]] auto isOpen() const -> bool { return m_file.isOpen(); }
+
+	/**
+	 * @brief Check if a resource exists.
+	 * @param[in] iName The resource name.
+	 * @return True if the resource exists.
+	 */
+	[[nodiscard]] auto contains(std::string_view iName) const -> bool;
+
+	/**
+	 * @brief Get the bytes of a resource, expanding it on first access.
+	 * @param[in] iName The resource name.
+	 * @return The resource bytes, empty if not found.
+	 *
+	 * @note The returned bytes stay valid until the pack is closed.
+	 */
+	[[nodiscard]] auto get(std::string_view iName) -> std::span<const uint8_t>;
+
+	/**
+	 * @brief Get the names of all the resources.
+	 * @return The resource names.
+	 */
+	[[nodiscard]] auto getNames() const -> std::vector<std::string_view>;
+
+	/**
+	 * @brief Get the pack statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> Stats;
+
+	/**
+	 * @brief Write a pack file.
+	 * @param[in] iPath The pack file.
+	 * @param[in] iInputs The resources.
+	 * @param[in] iCompress Compress entries when it makes them smaller.
+	 * @return True if the file is written.
+	 */
+	static auto write(const std::filesystem::path& iPath, std::span<const Input> iInputs, bool iCompress = true)
+			-> bool;
+
+private:
+	/**
+	 * @brief Pack file header.
+	 */
+	struct Header {
+		/// File magic.
+		uint32_t magic = 0;
+		/// Format version.
+		uint32_t version = 0;
+		/// Number of entries.
+		uint32_t entryCount = 0;
+		/// Unused.
+		uint32_t reserved = 0;
+		/// Offset of the entry table.
+		uint64_t indexOffset = 0;
+		/// Offset of the name block.
+		uint64_t namesOffset = 0;
+	};
+
+	/**
+	 * @brief Entry of the index, sorted by name hash.
+	 */
+	struct Entry {
+		/// Hash of the name.
+		uint64_t nameHash = 0;
+		/// Offset of the data in the pack.
+		uint64_t dataOffset = 0;
+		/// Size of the data in the pack.
+		uint64_t storedSize = 0;
+		/// Size of the resource.
+		uint64_t rawSize = 0;
+		/// Offset of the name in the name block.
+		uint32_t nameOffset = 0;
+		/// Length of the name.
+		uint16_t nameLength = 0;
+		/// Storage codec.
+		Codec codec = Codec::Stored;
+	};
+
+	/**
+	 * @brief Find an entry.
+	 * @param[in] iName The resource name.
+	 * @return The entry or nullptr.
+	 */
+	[[nodiscard]] auto find(std::string_view iName) const -> const Entry*;
+	/**
+	 * @brief Get the name of an entry.
+	 * @param[in] iEntry The entry.
+	 * @return The name.
+	 */
+	[[nodiscard]] auto getName(const Entry& iEntry) const -> std::string_view;
+
+	/// Mapped pack.
+	MappedFile m_file;
+	/// Entry table.
+	std::span<const Entry> m_entries;
+	/// Name block.
+	std::string_view m_names;
+	/// Protect the expanded entries.
+	mutable std::mutex m_mutex;
+	/// Expanded entries.
+	std::unordered_map<const Entry*, std::vector<uint8_t>> m_expanded;
+	/// Bytes of the expanded entries.
+	uint64_t m_expandedBytes = 0;
+};
+
+}// namespace mvi::core::resources
@@ -8,6 +8,10 @@
 #include "utilities.h"
 #include "pch.h"
 
+#include "Log.h"
+
+#include <thread>
+
 namespace mvi::core {
 
 constexpr uint16_t g_currentSaveVersion = 6;
@@ -18,6 +22,11 @@ std::shared_ptr<Settings> g_settings;
 
 std::filesystem::path g_baseExecPath;
 
+std::shared_ptr<resources::ResourcePack> g_resourcePack;
+
+/// Part of the sleep left to spinning, the system sleep being coarse.
+constexpr auto g_spinTail = std::chrono::microseconds(1000);
+
 }// namespace
 
 void initializeUtilities([[maybe_unused]] int iArgc, char* iArgv[]) {
@@ -27,8 +36,27 @@ void initializeUtilities([[maybe_unused]] int iArgc, char* iArgv[]) {
 
 auto getExecPath() -> std::filesystem::path { return g_baseExecPath; }
 
+auto getCacheDir() -> std::filesystem::path { return g_baseExecPath / "cache"; }
+
+auto getCaptureDir() -> std::filesystem::path {
+	if (const auto directory = getSettings()->getValue<std::string>("capture/directory"); !directory.empty())
+		return directory;
+	return g_baseExecPath / "captures";
+}
+
 auto getConfigFile() -> std::filesystem::path { return g_baseExecPath / "config.yml"; }
 
+auto getResourcePackFile() -> std::filesystem::path { return g_baseExecPath / "resources.mvipack"; }
+
+auto getResourcePack() -> std::shared_ptr<resources::ResourcePack> {
+	if (g_resourcePack == nullptr) {
+		g_resourcePack = std::make_shared<resources::ResourcePack>();
+		if (!g_resourcePack->open(getResourcePackFile()))
+			log_error("Unable to open the resource pack '{}'.", getResourcePackFile().string());
+	}
+	return g_resourcePack;
+}
+
 auto getSettings() -> std::shared_ptr<Settings> {
 	if (g_settings == nullptr)
 		g_settings = std::make_shared<Settings>();
@@ -49,6 +77,64 @@ void mergeDefaultSettings() {
 		if (!g_settings->contains("general/log_level")) {
 			g_settings->setValue("general/log_level", std::string("info"));
 		}
+		// Fonts settings
+		if (!g_settings->contains("fonts/disk_cache")) {
+			g_settings->setValue("fonts/disk_cache", true);
+		}
+		if (!g_settings->contains("fonts/atlas_page_size")) {
+			g_settings->setValue("fonts/atlas_page_size", 2048);
+		}
+		if (!g_settings->contains("fonts/atlas_fill_ratio")) {
+			g_settings->setValue("fonts/atlas_fill_ratio", 0.75);
+		}
+		if (!g_settings->contains("fonts/atlas_unused_frames")) {
+			g_settings->setValue("fonts/atlas_unused_frames", 120);
+		}
+		if (!g_settings->contains("fonts/fallback_font")) {
+			g_settings->setValue("fonts/fallback_font", std::string());
+		}
+		if (!g_settings->contains("fonts/msdf_glyph_size")) {
+			g_settings->setValue("fonts/msdf_glyph_size", 32.0);
+		}
+		// Capture settings
+		if (!g_settings->contains("capture/directory")) {
+			g_settings->setValue("capture/directory", std::string());
+		}
+		if (!g_settings->contains("capture/ring_size")) {
+			g_settings->setValue("capture/ring_size", 4);
+		}
+		if (!g_settings->contains("capture/queue_size")) {
+			g_settings->setValue("capture/queue_size", 8);
+		}
+		if (!g_settings->contains("capture/record_format")) {
+			g_settings->setValue("capture/record_format", std::string("y4m"));
+		}
+		if (!g_settings->contains("capture/frame_rate")) {
+			g_settings->setValue("capture/frame_rate", 60);
+		}
+		// Frame rate caps, 0 for no cap
+		if (!g_settings->contains("frame_rate/focused_fps")) {
+			g_settings->setValue("frame_rate/focused_fps", 0.0);
+		}
+		if (!g_settings->contains("frame_rate/unfocused_fps")) {
+			g_settings->setValue("frame_rate/unfocused_fps", 30.0);
+		}
+		if (!g_settings->contains("frame_rate/occluded_fps")) {
+			g_settings->setValue("frame_rate/occluded_fps", 20.0);
+		}
+		if (!g_settings->contains("frame_rate/iconified_fps")) {
+			g_settings->setValue("frame_rate/iconified_fps", 20.0);
+		}
+		// Job system settings, 0 workers for one per hardware thread
+		if (!g_settings->contains("jobs/workers")) {
+			g_settings->setValue("jobs/workers", 0);
+		}
+		if (!g_settings->contains("jobs/io_workers")) {
+			g_settings->setValue("jobs/io_workers", 1);
+		}
+		if (!g_settings->contains("views/destroy_delay")) {
+			g_settings->setValue("views/destroy_delay", 60.0);
+		}
 	}
 }
 
@@ -67,4 +153,10 @@ void leaveSettings() {
 
 auto getSaveVersion() -> uint16_t { return g_currentSaveVersion; }
 
+void sleepUntil(const std::chrono::steady_clock::time_point iWake) {
+	if (const auto now = std::chrono::steady_clock::now(); iWake - now > g_spinTail)
+		std::this_thread::sleep_until(iWake - g_spinTail);
+	while (std::chrono::steady_clock::now() < iWake) std::this_thread::yield();
+}
+
 }// namespace mvi::core
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "Settings.h"
+#include "resources/ResourcePack.h"
+#include <chrono>
 #include <filesystem>
 #include <memory>
 
@@ -27,12 +29,36 @@ void initializeUtilities(int iArgc, char* iArgv[]);
  */
 auto getExecPath() -> std::filesystem::path;
 
+/**
+ * @brief Get the cache directory.
+ * @return The cache directory.
+ */
+auto getCacheDir() -> std::filesystem::path;
+
+/**
+ * @brief Get the capture directory (screenshots and recordings).
+ * @return The capture directory.
+ */
+auto getCaptureDir() -> std::filesystem::path;
+
 /**
  * @brief Get the ini file path.
  * @return The ini file path.
  */
 auto getConfigFile() -> std::filesystem::path;
 
+/**
+ * @brief Get the resource pack path.
+ * @return The resource pack path.
+ */
+auto getResourcePackFile() -> std::filesystem::path;
+
+/**
+ * @brief Get the resource pack, mapped on first call.
+ * @return The resource pack.
+ */
+auto getResourcePack() -> std::shared_ptr<resources::ResourcePack>;
+
 /**
  * @brief Load settings from file into the Settings singleton.
  */
@@ -65,5 +91,13 @@ void leaveSettings();
  */
 auto getSaveVersion() -> uint16_t;
 
+/**
+ * @brief Sleep until a time point, with a better precision than the system sleep.
+ * @param[in] iWake The time to wake up.
+ *
+ * The system sleep ends up to a millisecond before the time point, the rest is spent spinning.
+ */
+void sleepUntil(std::chrono::steady_clock::time_point iWake);
+
 
 }// namespace mvi::core
@@ -0,0 +1,82 @@
+/**
+ * @file AcquisitionView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "AcquisitionView.h"
+
+#include "core/Application.h"
+#include "core/event/AppEvent.h"
+
+#include <chrono>
+#include <cmath>
+#include <imgui.h>
+#include <numbers>
+#include <thread>
+
+namespace mvi::core::views {
+
+AcquisitionView::AcquisitionView() { setWindow({.title = "Data acquisition", .flags = 0, .closable = true}); }
+
+AcquisitionView::~AcquisitionView() = default;
+
+void AcquisitionView::onEvent(event::Event& ioEvent) {
+	event::EventDispatcher dispatcher(ioEvent);
+	dispatcher.dispatch<event::AppTickEvent>([this](const event::AppTickEvent& iTick) -> bool {
+		m_time += iTick.getStep();
+		const double phase = 2.0 * std::numbers::pi * static_cast<double>(m_frequency) * m_time;
+		m_samples[m_head] = static_cast<float>(std::sin(phase) + 0.25 * std::sin(7.0 * phase));
+		m_head = (m_head + 1) % g_sampleCount;
+		return false;
+	});
+}
+
+void AcquisitionView::onPrepare(const FrameContext& iContext) {
+	// The ticks only run on the main thread, waiting for the preparation.
+	std::rotate_copy(m_samples.begin(), m_samples.begin() + static_cast<std::ptrdiff_t>(m_head), m_samples.end(),
+					 m_render.samples.begin());
+	m_render.alpha = iContext.alpha;
+	const float last = m_render.samples[g_sampleCount - 1];
+	const float previous = m_render.samples[g_sampleCount - 2];
+	m_render.value = previous + (last - previous) * static_cast<float>(iContext.alpha);
+	const auto [minimum, maximum] = std::ranges::minmax(m_render.samples);
+	m_render.minimum = minimum;
+	m_render.maximum = maximum;
+	double squares = 0.0;
+	for (const float sample: m_render.samples) squares += static_cast<double>(sample) * static_cast<double>(sample);
+	m_render.rms = static_cast<float>(std::sqrt(squares / g_sampleCount));
+	// Simulate a slow preparation, the sampling must keep its rate.
+	if (m_loadMs > 0)
+		std::this_thread::sleep_for(std::chrono::milliseconds(m_loadMs));
+}
+
+void AcquisitionView::onUpdate() {
+	auto& scheduler = Application::get().getScheduler();
+	auto config = scheduler.getConfig();
+	auto tickRate = static_cast<int>(config.tickRate);
+	auto maxSteps = static_cast<int>(config.maxSteps);
+	bool changed = ImGui::SliderInt("Tick rate (Hz)", &tickRate, 10, 1000);
+	changed |= ImGui::SliderInt("Max steps per frame", &maxSteps, 1, 32);
+	if (changed) {
+		config.tickRate = static_cast<double>(tickRate);
+		config.maxSteps = static_cast<uint32_t>(maxSteps);
+		scheduler.setConfig(config);
+	}
+	ImGui::SliderFloat("Signal frequency (Hz)", &m_frequency, 0.1f, 20.f);
+	ImGui::SliderInt("Preparation load (ms)", &m_loadMs, 0, 100);
+	const auto& stats = scheduler.getStats();
+	ImGui::Text("Frame %.2f ms, ticks this frame: %u, alpha %.3f", stats.frameMs, stats.steps, m_render.alpha);
+	ImGui::Text("Ticks: %llu, dropped: %llu", static_cast<unsigned long long>(stats.ticks),
+				static_cast<unsigned long long>(stats.dropped));
+	ImGui::Text("Interpolated value: %+.4f", static_cast<double>(m_render.value));
+	ImGui::Text("Min %+.3f, max %+.3f, RMS %.3f", static_cast<double>(m_render.minimum),
+				static_cast<double>(m_render.maximum), static_cast<double>(m_render.rms));
+	ImGui::PlotLines("##signal", m_render.samples.data(), static_cast<int>(g_sampleCount), 0, nullptr, -1.5f, 1.5f,
+					 ImVec2(-1.f, 150.f));
+}
+
+}// namespace mvi::core::views
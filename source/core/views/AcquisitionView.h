@@ -0,0 +1,92 @@
+/**
+ * @file AcquisitionView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+
+#include <array>
+
+namespace mvi::core::views {
+
+/**
+ * @brief View sampling a signal at the tick rate, whatever the rendering rate.
+ */
+class AcquisitionView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	AcquisitionView();
+	/**
+	 * @brief Default destructor.
+	 */
+	~AcquisitionView() override;
+
+	AcquisitionView(const AcquisitionView&) = delete;
+	AcquisitionView(AcquisitionView&&) = delete;
+	auto operator=(const AcquisitionView&) -> AcquisitionView& = delete;
+	auto operator=(AcquisitionView&&) -> AcquisitionView& = delete;
+
+	/**
+	 * @brief Prepare the signal to draw, from a job worker.
+	 * @param[in] iContext The frame information.
+	 */
+	void onPrepare(const FrameContext& iContext) override;
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "acquisition_view"; }
+	/**
+	 * @brief Event handler.
+	 * @param[in,out] ioEvent The Event to react.
+	 */
+	void onEvent(event::Event& ioEvent) override;
+
+private:
+	/// Number of samples kept.
+	static constexpr size_t g_sampleCount = 512;
+
+	/**
+	 * @brief Data of the frame, prepared for the drawing.
+	 */
+	struct RenderData {
+		/// Samples in chronological order.
+		std::array<float, g_sampleCount> samples{};
+		/// Interpolation factor of the frame.
+		double alpha = 0.0;
+		/// Value between the last two samples, as of the rendering time.
+		float value = 0.f;
+		/// Minimum of the samples.
+		float minimum = 0.f;
+		/// Maximum of the samples.
+		float maximum = 0.f;
+		/// Root mean square of the samples.
+		float rms = 0.f;
+	};
+
+	/// Sampled signal, circular.
+	std::array<float, g_sampleCount> m_samples{};
+	/// Next sample to write.
+	size_t m_head = 0;
+	/// Time of the last sample, in seconds.
+	double m_time = 0.0;
+	/// Signal frequency, in Hertz.
+	float m_frequency = 2.f;
+	/// Artificial preparation load, in milliseconds.
+	int m_loadMs = 0;
+	/// Data of the frame.
+	RenderData m_render;
+};
+
+}// namespace mvi::core::views
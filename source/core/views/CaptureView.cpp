@@ -0,0 +1,55 @@
+/**
+ * @file CaptureView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "CaptureView.h"
+
+#include "core/Application.h"
+#include "core/vulkan/FrameCapture.h"
+
+#include <imgui.h>
+
+namespace mvi::core::views {
+
+CaptureView::CaptureView() { setWindow({.title = "Frame capture", .flags = 0, .closable = true}); }
+
+CaptureView::~CaptureView() = default;
+
+void CaptureView::onUpdate() {
+	auto* capture = Application::get().getMainWindow().getFrameCapture();
+	if (capture == nullptr) {
+		ImGui::TextUnformatted("Frame capture is not available.");
+		return;
+	}
+	if (ImGui::Button("Screenshot (F12)"))
+		capture->requestScreenshot();
+	ImGui::SameLine();
+	if (capture->isRecording()) {
+		if (ImGui::Button("Stop recording (Shift+F12)"))
+			capture->stopRecording();
+	} else if (ImGui::Button("Start recording (Shift+F12)")) {
+		capture->startRecording();
+	}
+	ImGui::Text("Output: %s", capture->getConfig().directory.string().c_str());
+
+	const auto stats = capture->getStats();
+	ImGui::Separator();
+	ImGui::Text("Captured: %llu, encoded: %llu, dropped: %llu", static_cast<unsigned long long>(stats.captured),
+				static_cast<unsigned long long>(stats.encoded), static_cast<unsigned long long>(stats.dropped));
+	ImGui::Text("Readback buffers: %.1f MiB", static_cast<double>(stats.bufferBytes) / (1024.0 * 1024.0));
+	// Overhead per captured frame: render thread (record + readback) and encoder thread.
+	const double captured = std::max(1.0, static_cast<double>(stats.captured));
+	const double encoded = std::max(1.0, static_cast<double>(stats.encoded));
+	ImGui::Text("Render thread: %.3f ms/frame (record %.3f, readback %.3f)",
+				(stats.recordMs + stats.readbackMs) / captured, stats.recordMs / captured,
+				stats.readbackMs / captured);
+	ImGui::Text("Encoder thread: %.2f ms/frame, %.1f MiB written", stats.encodeMs / encoded,
+				static_cast<double>(stats.bytes) / (1024.0 * 1024.0));
+}
+
+}// namespace mvi::core::views
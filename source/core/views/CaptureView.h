@@ -0,0 +1,45 @@
+/**
+ * @file CaptureView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+
+namespace mvi::core::views {
+
+/**
+ * @brief View controlling the frame capture and showing its overhead.
+ */
+class CaptureView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	CaptureView();
+	/**
+	 * @brief Default destructor.
+	 */
+	~CaptureView() override;
+
+	CaptureView(const CaptureView&) = delete;
+	CaptureView(CaptureView&&) = delete;
+	auto operator=(const CaptureView&) -> CaptureView& = delete;
+	auto operator=(CaptureView&&) -> CaptureView& = delete;
+
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "capture_view"; }
+};
+
+}// namespace mvi::core::views
@@ -0,0 +1,148 @@
+/**
+ * @file ComputeView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ComputeView.h"
+
+#include "core/Application.h"
+#include "core/vulkan/Shader.h"
+#include "core/vulkan/VulkanContext.h"
+
+#include <imgui.h>
+#include <random>
+
+namespace mvi::core::views {
+
+namespace {
+
+/// Number of histogram bins.
+constexpr uint32_t g_binCount = 64;
+/// Histogram range.
+constexpr float g_minValue = -4.f;
+/// Histogram range.
+constexpr float g_maxValue = 4.f;
+/// Work group size of the kernel.
+constexpr uint32_t g_groupSize = 256;
+
+/// Histogram kernel.
+constexpr std::string_view g_histogramKernel = R"(#version 450 core
+layout(local_size_x = 256) in;
+layout(std430, set = 0, binding = 0) readonly buffer Values { float values[]; };
+layout(std430, set = 0, binding = 1) buffer Bins { uint bins[]; };
+layout(push_constant) uniform Params { uint count; uint binCount; float minValue; float maxValue; } params;
+void main() {
+	uint i = gl_GlobalInvocationID.x;
+	if (i >= params.count)
+		return;
+	float t = (values[i] - params.minValue) / (params.maxValue - params.minValue);
+	uint bin = min(uint(max(t, 0.0) * float(params.binCount)), params.binCount - 1u);
+	atomicAdd(bins[bin], 1u);
+}
+)";
+
+/**
+ * @brief Kernel push constants.
+ */
+struct Params {
+	/// Number of values.
+	uint32_t count = 0;
+	/// Number of bins.
+	uint32_t binCount = g_binCount;
+	/// Lower bound.
+	float minValue = g_minValue;
+	/// Upper bound.
+	float maxValue = g_maxValue;
+};
+
+}// namespace
+
+ComputeView::ComputeView() { setWindow({.title = "GPU compute", .flags = 0, .closable = true}); }
+
+ComputeView::~ComputeView() = default;
+
+void ComputeView::onUpdate() {
+	auto* context = Application::get().getMainWindow().getVulkanContext();
+	if (context == nullptr) {
+		ImGui::TextUnformatted("GPU compute is not available.");
+		return;
+	}
+	auto& compute = context->getCompute();
+	ImGui::Text("Queue: %s", compute.isAsync() ? "dedicated compute family" : "graphics family");
+	ImGui::SetNextItemWidth(200.f);
+	ImGui::SliderInt("Samples", &m_sampleCount, 1024, 1 << 24, "%d", ImGuiSliderFlags_Logarithmic);
+	ImGui::BeginDisabled(m_result.isValid());
+	if (ImGui::Button("Histogram on GPU"))
+		run();
+	ImGui::EndDisabled();
+
+	// Non-blocking readback: the result is polled each frame.
+	if (m_result.isValid()) {
+		++m_framesWaited;
+		if (m_result.isReady()) {
+			m_latencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+			m_latencyFrames = m_framesWaited;
+			const auto bins = m_result.copyTo<uint32_t>(1);
+			m_histogram.assign(bins.begin(), bins.end());
+			m_result = {};
+		} else {
+			ImGui::SameLine();
+			ImGui::Text("running (%u frames)", m_framesWaited);
+		}
+	}
+	const auto stats = compute.getStats();
+	ImGui::Text("Jobs: %llu submitted, %llu completed, %llu failed, %llu batches",
+				static_cast<unsigned long long>(stats.submitted), static_cast<unsigned long long>(stats.completed),
+				static_cast<unsigned long long>(stats.failed), static_cast<unsigned long long>(stats.batches));
+	if (!m_histogram.empty()) {
+		ImGui::Text("GPU: %.2f ms (%u frames), CPU: %.2f ms", m_latencyMs, m_latencyFrames, m_cpuMs);
+		ImGui::PlotHistogram("##histogram", m_histogram.data(), static_cast<int>(m_histogram.size()), 0, nullptr, 0.f,
+							 std::numeric_limits<float>::max(), ImVec2(-1.f, 160.f));
+	}
+}
+
+void ComputeView::run() {
+	auto& context = *Application::get().getMainWindow().getVulkanContext();
+	if (m_kernel == nullptr) {
+		auto spirv = vulkan::compileShader(g_histogramKernel, vulkan::ShaderStage::Compute, "histogram.comp");
+		m_kernel = std::make_shared<vulkan::ComputeKernel>(context, std::move(spirv), 2,
+														   static_cast<uint32_t>(sizeof(Params)));
+	}
+	const auto count = static_cast<uint32_t>(m_sampleCount);
+	std::vector<float> values(count);
+	std::mt19937 generator{42};
+	std::normal_distribution distribution{0.f, 1.f};
+	for (auto& value: values) value = distribution(generator);
+
+	// Same histogram on the CPU, for reference.
+	{
+		const auto start = std::chrono::steady_clock::now();
+		std::vector<uint32_t> bins(g_binCount, 0);
+		for (const float value: values) {
+			const float t = std::max((value - g_minValue) / (g_maxValue - g_minValue), 0.f);
+			++bins[std::min(static_cast<uint32_t>(t * static_cast<float>(g_binCount)), g_binCount - 1)];
+		}
+		m_cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	const Params params{.count = count};
+	vulkan::ComputeQueue::Job job;
+	job.kernel = m_kernel;
+	job.bindings.resize(2);
+	job.bindings[0].data.resize(values.size() * sizeof(float));
+	std::memcpy(job.bindings[0].data.data(), values.data(), job.bindings[0].data.size());
+	job.bindings[1].size = g_binCount * sizeof(uint32_t);
+	job.bindings[1].readback = true;
+	job.pushConstants.resize(sizeof(Params));
+	std::memcpy(job.pushConstants.data(), &params, sizeof(Params));
+	job.groups = {(count + g_groupSize - 1) / g_groupSize, 1, 1};
+	m_start = std::chrono::steady_clock::now();
+	m_framesWaited = 0;
+	m_result = context.getCompute().submit(std::move(job));
+}
+
+}// namespace mvi::core::views
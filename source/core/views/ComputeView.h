@@ -0,0 +1,75 @@
+/**
+ * @file ComputeView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+#include "core/vulkan/ComputeQueue.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace mvi::core::views {
+
+/**
+ * @brief View offloading a histogram to the GPU compute queue.
+ */
+class ComputeView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	ComputeView();
+	/**
+	 * @brief Default destructor.
+	 */
+	~ComputeView() override;
+
+	ComputeView(const ComputeView&) = delete;
+	ComputeView(ComputeView&&) = delete;
+	auto operator=(const ComputeView&) -> ComputeView& = delete;
+	auto operator=(ComputeView&&) -> ComputeView& = delete;
+
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "compute_view"; }
+
+private:
+	/**
+	 * @brief Generate the samples and submit the histogram job.
+	 */
+	void run();
+
+	/// The histogram kernel.
+	std::shared_ptr<vulkan::ComputeKernel> m_kernel;
+	/// Pending job.
+	vulkan::ComputeResult m_result;
+	/// Submission time of the pending job.
+	std::chrono::steady_clock::time_point m_start;
+	/// Frames waited by the pending job.
+	uint32_t m_framesWaited = 0;
+	/// Number of samples.
+	int m_sampleCount = 1 << 20;
+	/// Last histogram.
+	std::vector<float> m_histogram;
+	/// Latency of the last job, in milliseconds.
+	double m_latencyMs = 0.0;
+	/// Frames waited by the last job.
+	uint32_t m_latencyFrames = 0;
+	/// CPU time of the same histogram, in milliseconds.
+	double m_cpuMs = 0.0;
+};
+
+}// namespace mvi::core::views
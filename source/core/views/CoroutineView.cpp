@@ -0,0 +1,87 @@
+/**
+ * @file CoroutineView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "CoroutineView.h"
+
+#include "core/Application.h"
+#include "core/utilities.h"
+
+#include <imgui.h>
+
+namespace mvi::core::views {
+
+namespace {
+
+/// Bytes counted by a background step.
+constexpr size_t g_chunkSize = 256 * 1024;
+
+}// namespace
+
+CoroutineView::CoroutineView() {
+	setWindow({.title = "Coroutines", .flags = 0, .closable = true});
+	const auto path = getConfigFile().string();
+	std::copy_n(path.begin(), std::min(path.size(), m_path.size() - 1), m_path.begin());
+}
+
+CoroutineView::~CoroutineView() = default;
+
+void CoroutineView::onUpdate() {
+	const bool running = m_task.isValid() && !m_task.isDone();
+	ImGui::BeginDisabled(running);
+	ImGui::InputText("File", m_path.data(), m_path.size());
+	ImGui::SameLine();
+	if (ImGui::Button("Analyse"))
+		m_task = analyse(m_path.data());
+	ImGui::EndDisabled();
+	ImGui::SameLine();
+	ImGui::BeginDisabled(!running);
+	if (ImGui::Button("Cancel")) {
+		m_task.reset();
+		m_status = "Cancelled";
+	}
+	ImGui::EndDisabled();
+	ImGui::Text("%s", m_status.c_str());
+	ImGui::ProgressBar(m_progress, ImVec2(-1.f, 0.f));
+	ImGui::Text("%zu bytes in %llu frames", m_size, static_cast<unsigned long long>(m_frames));
+	ImGui::PlotHistogram("Bytes", m_histogram.data(), static_cast<int>(m_histogram.size()), 0, nullptr, 0.f,
+						 std::numeric_limits<float>::max(), ImVec2(-1.f, 120.f));
+	const auto stats = Application::get().getCoroutines().getStats();
+	ImGui::Text("Resumed by frames: %llu, waiting: %zu frame, %zu condition",
+				static_cast<unsigned long long>(stats.resumed), stats.waitingFrame, stats.waitingCondition);
+}
+
+auto CoroutineView::analyse(std::filesystem::path iPath) -> coro::Task<> {
+	m_status = "Reading...";
+	m_size = 0;
+	m_progress = 0.f;
+	m_histogram.fill(0.f);
+	m_frames = 0;
+	const auto data = co_await coro::readFile(iPath);
+	if (data.empty()) {
+		m_status = std::format("Unable to read '{}'", iPath.string());
+		co_return;
+	}
+	m_status = "Counting...";
+	m_size = data.size();
+	std::array<uint64_t, 256> counts{};
+	for (size_t offset = 0; offset < data.size(); offset += g_chunkSize) {
+		co_await coro::background();
+		const size_t end = std::min(offset + g_chunkSize, data.size());
+		for (size_t i = offset; i < end; ++i) ++counts[data[i]];
+		// Back on the main thread to publish the progress.
+		co_await coro::nextFrame();
+		++m_frames;
+		m_progress = static_cast<float>(end) / static_cast<float>(data.size());
+		std::ranges::transform(counts, m_histogram.begin(),
+							   [](const uint64_t iCount) -> float { return static_cast<float>(iCount); });
+	}
+	m_status = "Done";
+}
+
+}// namespace mvi::core::views
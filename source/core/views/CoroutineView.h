@@ -0,0 +1,75 @@
+/**
+ * @file CoroutineView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+#include "core/coro/Task.h"
+
+#include <array>
+#include <filesystem>
+#include <string>
+
+namespace mvi::core::views {
+
+/**
+ * @brief View running a coroutine: a file read on an I/O job, then a byte histogram computed chunk by chunk.
+ */
+class CoroutineView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	CoroutineView();
+	/**
+	 * @brief Destructor, cancel the running analysis.
+	 */
+	~CoroutineView() override;
+
+	CoroutineView(const CoroutineView&) = delete;
+	CoroutineView(CoroutineView&&) = delete;
+	auto operator=(const CoroutineView&) -> CoroutineView& = delete;
+	auto operator=(CoroutineView&&) -> CoroutineView& = delete;
+
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "coroutine_view"; }
+
+private:
+	/**
+	 * @brief Read a file and compute its byte histogram, one chunk by frame in the background.
+	 *
+	 * The view members are only touched on the main thread, so the view may be destroyed meanwhile.
+	 * @param[in] iPath The file to analyse.
+	 * @return The task.
+	 */
+	auto analyse(std::filesystem::path iPath) -> coro::Task<>;
+
+	/// Path of the file to analyse.
+	std::array<char, 256> m_path{};
+	/// The running analysis.
+	coro::Task<> m_task;
+	/// Status of the analysis.
+	std::string m_status;
+	/// Size of the file, in bytes.
+	size_t m_size = 0;
+	/// Progress of the analysis.
+	float m_progress = 0.f;
+	/// Byte histogram.
+	std::array<float, 256> m_histogram{};
+	/// Frames used by the analysis.
+	uint64_t m_frames = 0;
+};
+
+}// namespace mvi::core::views
@@ -9,23 +9,31 @@
 
 #include "FirstView.h"
 
+#include "core/Application.h"
+#include "core/vulkan/VulkanContext.h"
+
 #include <imgui.h>
 
 namespace mvi::core::views {
 
-FirstView::FirstView(bool& iShowDemoWindow, bool& iShowAnotherWindow, std::array<float, 4>& iClearColor)
-	: m_showDemoWindow(iShowDemoWindow), m_showAnotherWindow(iShowAnotherWindow), m_clearColor(iClearColor) {}
+FirstView::FirstView(std::array<float, 4>& iClearColor) : m_clearColor(iClearColor) {
+	setWindow({.title = "Hello, world!", .flags = 0, .closable = false});
+}
 
 FirstView::~FirstView() = default;
 
 void FirstView::onUpdate() {
 	const ImGuiIO& io = ImGui::GetIO();
 
-	ImGui::Begin("Hello, world!");// Create a window called "Hello, world!" and append into it.
-
 	ImGui::Text("This is some useful text.");// Display some text (you can use a format strings too)
-	ImGui::Checkbox("Demo Window", &m_showDemoWindow);// Edit bools storing our window open/close state
-	ImGui::Checkbox("Another Window", &m_showAnotherWindow);
+	// Registered views, built on their first show
+	auto& registry = Application::get().getViewRegistry();
+	for (const auto& entry: registry.getEntries()) {
+		if (entry.options.label.empty())
+			continue;
+		if (bool shown = registry.isShown(entry.id); ImGui::Checkbox(entry.options.label.c_str(), &shown))
+			registry.setShown(entry.id, shown);
+	}
 
 	ImGui::SliderFloat("float", &m_float, 0.0f, 1.0f);// Edit 1 float using a slider from 0.0f to 1.0f
 	ImGui::ColorEdit3("clear color",
@@ -38,6 +46,18 @@ void FirstView::onUpdate() {
 
 	ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0 / static_cast<double>(io.Framerate),
 				static_cast<double>(io.Framerate));
-	ImGui::End();
+	if (auto* context = Application::get().getMainWindow().getVulkanContext(); context != nullptr) {
+		auto& pacer = context->getFramePacer();
+		auto config = pacer.getConfig();
+		if (ImGui::Checkbox("Low latency pacing", &config.lowLatency))
+			pacer.setConfig(config);
+		if (config.lowLatency) {
+			const auto stats = pacer.getStats();
+			ImGui::Text("Refresh %.2f ms, build %.2f ms, sleep %.2f ms, input to display %.2f ms (%s)",
+						stats.refreshMs, stats.buildMs, stats.sleepMs, stats.latencyMs,
+						stats.presentWait ? "present wait" : "measured");
+			ImGui::Text("Missed blanks: %llu", static_cast<unsigned long long>(stats.missed));
+		}
+	}
 }
 }// namespace mvi::core::views
@@ -22,7 +22,7 @@ public:
 	/**
 	 * @brief Default constructor.
 	 */
-	FirstView(bool& iShowDemoWindow, bool& iShowAnotherWindow, std::array<float, 4>& iClearColor);
+	explicit FirstView(std::array<float, 4>& iClearColor);
 	/**
 	 * @brief Default destructor.
 	 */
@@ -47,10 +47,6 @@ private:
 	int m_counter = 0;
 	/// A float value.
 	float m_float = 0.0f;
-	/// Reference to external demo window visibility flag.
-	bool& m_showDemoWindow;
-	/// Reference to external another window visibility flag.
-	bool& m_showAnotherWindow;
 	/// Reference to external clear color.
 	std::array<float, 4>& m_clearColor;
 };
@@ -0,0 +1,117 @@
+/**
+ * @file FrameRateView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "FrameRateView.h"
+
+#include "core/Application.h"
+
+#include <imgui.h>
+
+namespace mvi::core::views {
+
+FrameRateView::FrameRateView() { setWindow({.title = "Frame rate governor", .flags = 0, .closable = true}); }
+
+FrameRateView::~FrameRateView() = default;
+
+void FrameRateView::onUpdate() {
+	auto& governor = Application::get().getGovernor();
+	auto config = governor.getConfig();
+	ImGui::Text("Window state: %s", magic_enum::enum_name(governor.getState()).data());
+	ImGui::TextDisabled("Caps are in frames per second, 0 for no cap.");
+	constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+	if (ImGui::BeginTable("states", 6, flags)) {
+		ImGui::TableSetupColumn("State");
+		ImGui::TableSetupColumn("Cap", ImGuiTableColumnFlags_WidthFixed, 120.f);
+		ImGui::TableSetupColumn("Rate");
+		ImGui::TableSetupColumn("CPU");
+		ImGui::TableSetupColumn("Frames");
+		ImGui::TableSetupColumn("Time");
+		ImGui::TableHeadersRow();
+		bool changed = false;
+		for (const auto state: magic_enum::enum_values<FrameGovernor::State>()) {
+			const auto index = static_cast<size_t>(state);
+			const auto& stats = governor.getStats(state);
+			ImGui::PushID(static_cast<int>(index));
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			if (state == governor.getState())
+				ImGui::TextColored(ImVec4(0.4f, 1.f, 0.4f, 1.f), "%s", magic_enum::enum_name(state).data());
+			else
+				ImGui::TextUnformatted(magic_enum::enum_name(state).data());
+			ImGui::TableNextColumn();
+			auto cap = static_cast<int>(config.caps[index]);
+			ImGui::SetNextItemWidth(-1.f);
+			if (ImGui::SliderInt("##cap", &cap, 0, 240)) {
+				config.caps[index] = static_cast<double>(cap);
+				changed = true;
+			}
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f fps", stats.fps);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f %%", stats.cpuUsage * 100.0);
+			ImGui::TableNextColumn();
+			ImGui::Text("%llu", static_cast<unsigned long long>(stats.frames));
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f s (%.1f s CPU)", stats.seconds, stats.cpuSeconds);
+			ImGui::PopID();
+		}
+		ImGui::EndTable();
+		if (changed)
+			governor.setConfig(config);
+	}
+	if (ImGui::CollapsingHeader("View phases")) {
+		const auto& app = Application::get();
+		const auto& timings = app.getFrameTimings();
+		double prepareSum = 0.0;
+		for (const auto& view: app.getViews()) {
+			if (view->isVisible())
+				prepareSum += view->getPhaseTimings().prepareMs;
+		}
+		ImGui::Text("Prepare: %zu views in %.3f ms (%.3f ms of work), update: %.3f ms", timings.preparedViews,
+					timings.prepareMs, prepareSum, timings.updateMs);
+		const auto& registry = Application::get().getViewRegistry();
+		ImGui::Text("Views: %zu built of %zu, %llu creations, %llu destructions", registry.getStats().built,
+					registry.getEntries().size(), static_cast<unsigned long long>(registry.getStats().creations),
+					static_cast<unsigned long long>(registry.getStats().destructions));
+		if (ImGui::BeginTable("phases", 6, flags)) {
+			ImGui::TableSetupColumn("View");
+			ImGui::TableSetupColumn("Prepare");
+			ImGui::TableSetupColumn("Update");
+			ImGui::TableSetupColumn("Skipped builds");
+			ImGui::TableSetupColumn("Refresh");
+			ImGui::TableSetupColumn("Saved");
+			ImGui::TableHeadersRow();
+			for (const auto& view: app.getViews()) {
+				if (!view->isVisible())
+					continue;
+				const auto& phases = view->getPhaseTimings();
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(view->getName().c_str());
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f ms", phases.prepareAverageMs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f ms", phases.updateAverageMs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%llu", static_cast<unsigned long long>(view->getUpdateStats().skippedFrames));
+				const auto& refresh = view->getRefreshStats();
+				ImGui::TableNextColumn();
+				if (view->getRefreshRate() > 0.0)
+					ImGui::Text("%.1f Hz%s", view->getRefreshRate(), refresh.boosted ? " (boosted)" : "");
+				else
+					ImGui::TextUnformatted("every frame");
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f ms", refresh.savedMs);
+			}
+			ImGui::EndTable();
+		}
+	}
+}
+
+}// namespace mvi::core::views
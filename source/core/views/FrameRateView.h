@@ -0,0 +1,45 @@
+/**
+ * @file FrameRateView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+
+namespace mvi::core::views {
+
+/**
+ * @brief View showing and tuning the frame rate caps by window state.
+ */
+class FrameRateView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	FrameRateView();
+	/**
+	 * @brief Default destructor.
+	 */
+	~FrameRateView() override;
+
+	FrameRateView(const FrameRateView&) = delete;
+	FrameRateView(FrameRateView&&) = delete;
+	auto operator=(const FrameRateView&) -> FrameRateView& = delete;
+	auto operator=(FrameRateView&&) -> FrameRateView& = delete;
+
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "frame_rate_view"; }
+};
+
+}// namespace mvi::core::views
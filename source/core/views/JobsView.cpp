@@ -0,0 +1,127 @@
+/**
+ * @file JobsView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "JobsView.h"
+
+#include "core/Application.h"
+
+#include <cmath>
+#include <imgui.h>
+#include <thread>
+
+namespace mvi::core::views {
+
+namespace {
+
+/// Values summed by a partial sum job.
+constexpr int g_valuesPerJob = 200000;
+/// Rate of the statistics samplings, in hertz.
+constexpr double g_sampleRate = 2.0;
+
+}// namespace
+
+JobsView::JobsView() {
+	setWindow({.title = "Job system", .flags = 0, .closable = true});
+	setRefreshRate(g_sampleRate);
+}
+
+JobsView::~JobsView() {
+	// The jobs write into this view.
+	if (m_final != nullptr)
+		Application::get().getJobs().waitFor(m_final);
+}
+
+void JobsView::onPrepare([[maybe_unused]] const FrameContext& iContext) {
+	m_stats = Application::get().getJobs().sampleStats();
+}
+
+void JobsView::onUpdate() {
+	auto& jobSystem = Application::get().getJobs();
+	ImGui::Text("Backend: %s, %u workers, %llu pending jobs", jobs::JobSystem::usesTbb() ? "TBB" : "native",
+				jobSystem.getWorkerCount(), static_cast<unsigned long long>(jobSystem.getPendingJobs()));
+
+	const bool running = m_final != nullptr && !m_delivered;
+	ImGui::BeginDisabled(running);
+	ImGui::SetNextItemWidth(200.f);
+	ImGui::SliderInt("Jobs", &m_jobCount, 1, 1024);
+	ImGui::SameLine();
+	if (ImGui::Button("Run job graph"))
+		runGraph();
+	ImGui::EndDisabled();
+	if (running)
+		ImGui::Text("Running...");
+	else if (m_final != nullptr)
+		ImGui::Text("Result %.6g in %.2f ms", m_result, m_graphMs);
+	const auto posts = Application::get().getDispatcher().getStats();
+	ImGui::Text("Main thread posts: %llu, dispatched: %llu", static_cast<unsigned long long>(posts.posted),
+				static_cast<unsigned long long>(posts.dispatched));
+
+	constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+	if (ImGui::BeginTable("workers", 5, flags)) {
+		ImGui::TableSetupColumn("Thread");
+		ImGui::TableSetupColumn("Jobs");
+		ImGui::TableSetupColumn("Steals");
+		ImGui::TableSetupColumn("Busy");
+		ImGui::TableSetupColumn("Utilization", ImGuiTableColumnFlags_WidthFixed, 200.f);
+		ImGui::TableHeadersRow();
+		for (size_t i = 0; i < m_stats.size(); ++i) {
+			const auto& stats = m_stats[i];
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%s %zu", magic_enum::enum_name(stats.kind).data(), i);
+			ImGui::TableNextColumn();
+			ImGui::Text("%llu", static_cast<unsigned long long>(stats.jobs));
+			ImGui::TableNextColumn();
+			ImGui::Text("%llu", static_cast<unsigned long long>(stats.steals));
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2f s", stats.busySeconds);
+			ImGui::TableNextColumn();
+			ImGui::ProgressBar(static_cast<float>(std::min(stats.utilization, 1.0)), ImVec2(-1.f, 0.f));
+		}
+		ImGui::EndTable();
+	}
+}
+
+void JobsView::runGraph() {
+	auto& jobSystem = Application::get().getJobs();
+	m_start = std::chrono::steady_clock::now();
+	m_delivered = false;
+	m_partials.assign(static_cast<size_t>(m_jobCount), 0.0);
+	std::vector<jobs::JobHandle> dependencies;
+	dependencies.reserve(m_partials.size() + 1);
+	for (size_t i = 0; i < m_partials.size(); ++i) {
+		dependencies.push_back(jobSystem.submit([this, i]() -> void {
+			double sum = 0.0;
+			const auto first = static_cast<double>(i) * g_valuesPerJob;
+			for (int value = 0; value < g_valuesPerJob; ++value) sum += std::sqrt(first + static_cast<double>(value));
+			m_partials[i] = sum;
+		}));
+	}
+	// Simulated file read, on the blocking job workers.
+	dependencies.push_back(jobSystem.submit(
+			[]() -> void { std::this_thread::sleep_for(std::chrono::milliseconds(20)); }, jobs::Priority::Io));
+	m_final = jobSystem.submit(
+			[this, start = m_start, alive = std::weak_ptr(m_alive)]() -> void {
+				double result = 0.0;
+				for (const double partial: m_partials) result += partial;
+				const auto elapsed = std::chrono::steady_clock::now() - start;
+				// Delivered to the main thread, the view members are only touched there.
+				// The view may be destroyed before the dispatch.
+				Application::get().getDispatcher().post([this, alive, result, elapsed]() -> void {
+					if (alive.expired())
+						return;
+					m_result = result;
+					m_graphMs = std::chrono::duration<double, std::milli>(elapsed).count();
+					m_delivered = true;
+				});
+			},
+			jobs::Priority::Critical, dependencies);
+}
+
+}// namespace mvi::core::views
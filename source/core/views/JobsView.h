@@ -0,0 +1,80 @@
+/**
+ * @file JobsView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+#include "core/jobs/JobSystem.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace mvi::core::views {
+
+/**
+ * @brief View showing the job system activity, with a job graph to run.
+ */
+class JobsView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	JobsView();
+	/**
+	 * @brief Destructor, wait for the running graph.
+	 */
+	~JobsView() override;
+
+	JobsView(const JobsView&) = delete;
+	JobsView(JobsView&&) = delete;
+	auto operator=(const JobsView&) -> JobsView& = delete;
+	auto operator=(JobsView&&) -> JobsView& = delete;
+
+	/**
+	 * @brief Sample the job system statistics, at the refresh rate.
+	 * @param[in] iContext The frame information.
+	 */
+	void onPrepare(const FrameContext& iContext) override;
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "jobs_view"; }
+
+private:
+	/**
+	 * @brief Submit the job graph: partial sums, a simulated file read, then a critical reduction.
+	 */
+	void runGraph();
+
+	/// Number of partial sum jobs.
+	int m_jobCount = 64;
+	/// Partial sums, one by job.
+	std::vector<double> m_partials;
+	/// Final job of the graph.
+	jobs::JobHandle m_final;
+	/// Result of the graph, posted to the main thread.
+	double m_result = 0.0;
+	/// Result received.
+	bool m_delivered = false;
+	/// Start of the graph.
+	std::chrono::steady_clock::time_point m_start;
+	/// Duration of the graph, in milliseconds.
+	double m_graphMs = 0.0;
+	/// Last sampled statistics.
+	std::vector<jobs::JobSystem::WorkerStats> m_stats;
+	/// Lifetime token of the view, for the posted results.
+	std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
+};
+
+}// namespace mvi::core::views
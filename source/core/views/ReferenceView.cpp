@@ -0,0 +1,78 @@
+/**
+ * @file ReferenceView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ReferenceView.h"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <imgui.h>
+
+namespace mvi::core::views {
+
+ReferenceView::ReferenceView() {
+	setWindow({.title = "Reference table", .flags = 0, .closable = true});
+	setRetained(true);
+}
+
+ReferenceView::~ReferenceView() = default;
+
+void ReferenceView::onUpdate() {
+	bool retained = isRetained();
+	if (ImGui::Checkbox("Retained", &retained))
+		setRetained(retained);
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(200.f);
+	if (ImGui::SliderInt("Rows", &m_rowCount, 100, 5000))
+		markDirty();
+	const auto& stats = getRetainedStats();
+	ImGui::Text("Live frames: %llu, cached frames: %llu, captures: %llu",
+				static_cast<unsigned long long>(stats.liveFrames), static_cast<unsigned long long>(stats.cachedFrames),
+				static_cast<unsigned long long>(stats.captures));
+	ImGui::Text("Last build: %.3f ms", m_buildMs);
+	ImGui::Separator();
+
+	retainedContent([this]() -> void {
+		const auto start = std::chrono::steady_clock::now();
+		buildTable();
+		m_buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	});
+}
+
+void ReferenceView::buildTable() const {
+	constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+	if (!ImGui::BeginTable("reference", 5, flags))
+		return;
+	ImGui::TableSetupColumn("Value");
+	ImGui::TableSetupColumn("Hex");
+	ImGui::TableSetupColumn("Binary");
+	ImGui::TableSetupColumn("Square root");
+	ImGui::TableSetupColumn("Sine");
+	ImGui::TableHeadersRow();
+	for (int row = 0; row < m_rowCount; ++row) {
+		const auto value = static_cast<uint32_t>(row);
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::Text("%u", value);
+		ImGui::TableNextColumn();
+		ImGui::Text("0x%04X", value);
+		ImGui::TableNextColumn();
+		std::array<char, 17> binary{};
+		for (size_t bit = 0; bit < 16; ++bit)
+			binary[15 - bit] = (value >> bit & 1u) != 0 ? '1' : '0';
+		ImGui::TextUnformatted(binary.data());
+		ImGui::TableNextColumn();
+		ImGui::Text("%.6f", std::sqrt(static_cast<double>(value)));
+		ImGui::TableNextColumn();
+		ImGui::Text("%+.6f", std::sin(static_cast<double>(value) * 0.01));
+	}
+	ImGui::EndTable();
+}
+
+}// namespace mvi::core::views
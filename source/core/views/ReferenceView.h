@@ -0,0 +1,56 @@
+/**
+ * @file ReferenceView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+
+namespace mvi::core::views {
+
+/**
+ * @brief View showing a large static table, cached in retained mode.
+ */
+class ReferenceView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	ReferenceView();
+	/**
+	 * @brief Default destructor.
+	 */
+	~ReferenceView() override;
+
+	ReferenceView(const ReferenceView&) = delete;
+	ReferenceView(ReferenceView&&) = delete;
+	auto operator=(const ReferenceView&) -> ReferenceView& = delete;
+	auto operator=(ReferenceView&&) -> ReferenceView& = delete;
+
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "reference_view"; }
+
+private:
+	/**
+	 * @brief Build the table.
+	 */
+	void buildTable() const;
+
+	/// Number of rows.
+	int m_rowCount = 1500;
+	/// Time of the last build, in milliseconds.
+	double m_buildMs = 0.0;
+};
+
+}// namespace mvi::core::views
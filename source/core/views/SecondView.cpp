@@ -13,17 +13,17 @@
 
 namespace mvi::core::views {
 
-SecondView::SecondView() = default;
+SecondView::SecondView() {
+	// The window will have a closing button that will hide the view when clicked
+	setWindow({.title = "Another Window", .flags = 0, .closable = true});
+}
 
 SecondView::~SecondView() = default;
 
 void SecondView::onUpdate() {
-	// Pass a pointer to our bool variable (the window will have a closing button that will clear the bool when clicked)
-	ImGui::Begin("Another Window", &visibility());
 	ImGui::Text("Hello from another window!");
 	if (ImGui::Button("Close Me"))
 		hide();
-	ImGui::End();
 }
 
 }// namespace mvi::core::views
@@ -0,0 +1,221 @@
+/**
+ * @file TextView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "TextView.h"
+
+#include "core/Application.h"
+#include "core/fonts/AtlasBudget.h"
+#include "core/fonts/AtlasBuilder.h"
+#include "core/fonts/MsdfAtlas.h"
+#include "core/vulkan/MsdfRenderer.h"
+#include "core/vulkan/VulkanContext.h"
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+namespace mvi::core::views {
+
+namespace {
+
+/// Sizes baked to measure the bitmap atlas.
+constexpr std::array g_measureSizes = {12.f, 16.f, 20.f, 24.f, 32.f, 48.f, 64.f, 96.f};
+/// Sample text.
+constexpr std::string_view g_sampleText = "The quick brown fox jumps over the lazy dog.\nÀ bientôt, 0123456789 +-*/";
+
+/**
+ * @brief Code point range of a script.
+ */
+struct Script {
+	/// Displayed name.
+	const char* name = nullptr;
+	/// First code point.
+	ImWchar first = 0;
+	/// Last code point (inclusive).
+	ImWchar last = 0;
+};
+/// Scripts drawn at one size to fill the atlas (the CJK ones need a CJK main font).
+constexpr std::array g_scripts = {Script{.name = "Latin", .first = 0x20, .last = 0x24f},
+								  Script{.name = "Cyrillic", .first = 0x400, .last = 0x4ff},
+								  Script{.name = "CJK ideographs", .first = 0x4e00, .last = 0x9fff}};
+
+}// namespace
+
+TextView::TextView() { setWindow({.title = "Text rendering", .flags = 0, .closable = true}); }
+
+TextView::~TextView() = default;
+
+void TextView::onUpdate() {
+	auto* renderer = Application::get().getMainWindow().getMsdfRenderer();
+	if (renderer == nullptr) {
+		ImGui::TextUnformatted("MSDF text rendering is not available.");
+		return;
+	}
+	const auto& stats = renderer->getAtlas().getStats();
+	ImGui::Text("MSDF atlas: %u glyphs, %ux%u, built in %.1f ms, %.1f KiB (all sizes)", stats.glyphs,
+				renderer->getAtlas().getWidth(), renderer->getAtlas().getHeight(), static_cast<double>(stats.buildMs),
+				static_cast<double>(renderer->getTexture().getMemorySize()) / 1024.0);
+	if (ImGui::Button("Measure bitmap atlas"))
+		measureBitmap();
+	if (!m_bitmapMeasures.empty() &&
+		ImGui::BeginTable("bitmap", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+		ImGui::TableSetupColumn("Size");
+		ImGui::TableSetupColumn("Glyphs");
+		ImGui::TableSetupColumn("Bake (ms)");
+		ImGui::TableSetupColumn("Memory (KiB)");
+		ImGui::TableHeadersRow();
+		float totalMs = 0.f;
+		uint64_t totalBytes = 0;
+		for (const auto& [size, bakeMs, glyphs, bytes]: m_bitmapMeasures) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%.0f", static_cast<double>(size));
+			ImGui::TableNextColumn();
+			ImGui::Text("%u", glyphs);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2f", static_cast<double>(bakeMs));
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f", static_cast<double>(bytes) / 1024.0);
+			totalMs += bakeMs;
+			totalBytes += bytes;
+		}
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted("Total");
+		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", static_cast<double>(totalMs));
+		ImGui::TableNextColumn();
+		ImGui::Text("%.1f", static_cast<double>(totalBytes) / 1024.0);
+		ImGui::EndTable();
+	}
+
+	drawFontSettings();
+	drawAtlasBudget();
+
+	ImGui::Separator();
+	ImGui::SliderFloat("Size", &m_size, 6.f, 256.f, "%.0f px", ImGuiSliderFlags_Logarithmic);
+	ImGui::TextUnformatted("Bitmap atlas:");
+	ImGui::PushFont(nullptr, m_size);
+	ImGui::TextUnformatted(g_sampleText.data(), g_sampleText.data() + g_sampleText.size());
+	ImGui::PopFont();
+	ImGui::TextUnformatted("MSDF atlas:");
+	const ImVec2 textSize = renderer->calcTextSize(m_size, g_sampleText);
+	renderer->drawText(ImGui::GetWindowDrawList(), ImGui::GetCursorScreenPos(), m_size,
+					   ImGui::GetColorU32(ImGuiCol_Text), g_sampleText);
+	ImGui::Dummy(textSize);
+}
+
+void TextView::drawFontSettings() {
+	auto& window = Application::get().getMainWindow();
+	const auto* builder = window.getAtlasBuilder();
+	if (builder == nullptr)
+		return;
+	ImGui::SeparatorText("Main font");
+	ImGui::InputText("Font file", m_fontPath.data(), m_fontPath.size());
+	ImGui::SliderFloat("Font size", &m_fontSize, 8.f, 48.f, "%.0f px");
+	if (ImGui::Button("Apply"))
+		window.setFont(m_fontPath.data(), m_fontSize);
+	ImGui::SameLine();
+	const auto stats = builder->getStats();
+	if (builder->isBuilding())
+		ImGui::TextUnformatted("Preparing in the background...");
+	else
+		ImGui::Text("%u builds, last: %u glyphs in %.1f ms, %u served", stats.builds, stats.glyphs,
+					static_cast<double>(stats.buildMs), stats.served);
+	if (auto* context = window.getVulkanContext(); context != nullptr) {
+		const auto& uploads = context->getTextureUploader().getStats();
+		ImGui::Text("Texture uploads: %u textures, last batch %u rects (%.1f KiB), %.1f KiB in %llu batches",
+					uploads.textures, uploads.rects, static_cast<double>(uploads.bytes) / 1024.0,
+					static_cast<double>(uploads.totalBytes) / 1024.0,
+					static_cast<unsigned long long>(uploads.batches));
+	}
+}
+
+void TextView::drawAtlasBudget() {
+	const auto* budget = Application::get().getMainWindow().getAtlasBudget();
+	if (budget == nullptr)
+		return;
+	ImGui::SeparatorText("Atlas budget");
+	const auto& stats = budget->getStats();
+	const ImTextureData* texture = ImGui::GetIO().Fonts->TexData;
+	ImGui::Text("%u sizes, %u glyphs, %.2f Mtexels, texture %dx%d, %u evictions, %u compactions", stats.bakedSizes,
+				stats.glyphs, static_cast<double>(stats.usedTexels) * 1e-6, texture->Width, texture->Height,
+				stats.evictions, stats.compactions);
+	ImGui::SetNextItemWidth(200.f);
+	ImGui::Combo(
+			"Script", &m_script,
+			[](void*, const int iIndex) -> const char* { return g_scripts[static_cast<size_t>(iIndex)].name; },
+			nullptr, static_cast<int>(g_scripts.size()));
+	ImGui::SameLine();
+	ImGui::Checkbox("Draw every glyph at the displayed size", &m_drawScript);
+	if (!m_drawScript)
+		return;
+	const auto& script = g_scripts[static_cast<size_t>(m_script)];
+	if (m_scriptTextFor != m_script) {
+		std::vector<ImWchar> codepoints;
+		for (uint32_t codepoint = script.first; codepoint <= script.last; ++codepoint)
+			codepoints.push_back(static_cast<ImWchar>(codepoint));
+		// Up to 3 bytes by code point of the basic plane.
+		m_scriptText.resize(codepoints.size() * 3 + 1);
+		const int length = ImTextStrToUtf8(m_scriptText.data(), static_cast<int>(m_scriptText.size()),
+										   codepoints.data(), codepoints.data() + codepoints.size());
+		m_scriptText.resize(static_cast<size_t>(length));
+		m_scriptTextFor = m_script;
+	}
+	ImGui::PushFont(nullptr, m_size);
+	// The glyphs the font has but the atlas could not place.
+	ImFont* font = ImGui::GetFont();
+	ImFontBaked* baked = ImGui::GetFontBaked();
+	uint32_t missing = 0;
+	uint32_t available = 0;
+	for (uint32_t codepoint = script.first; codepoint <= script.last; ++codepoint) {
+		if (!font->IsGlyphInFont(static_cast<ImWchar>(codepoint)))
+			continue;
+		++available;
+		if (baked->FindGlyphNoFallback(static_cast<ImWchar>(codepoint)) == nullptr)
+			++missing;
+	}
+	ImGui::PopFont();
+	ImGui::Text("%u glyphs in the font, %u missing from the atlas", available, missing);
+	if (ImGui::BeginChild("script", ImVec2(0.f, 300.f), ImGuiChildFlags_Borders)) {
+		ImGui::PushFont(nullptr, m_size);
+		ImGui::PushTextWrapPos(0.f);
+		ImGui::TextUnformatted(m_scriptText.data(), m_scriptText.data() + m_scriptText.size());
+		ImGui::PopTextWrapPos();
+		ImGui::PopFont();
+	}
+	ImGui::EndChild();
+}
+
+void TextView::measureBitmap() {
+	ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+	ImFont* font = ImGui::GetFont();
+	const auto bytesPerPixel = static_cast<uint64_t>(atlas->TexData->BytesPerPixel);
+	const fonts::MsdfAtlas::Config config;
+	m_bitmapMeasures.clear();
+	for (const float size: g_measureSizes) {
+		BitmapMeasure measure{.size = size};
+		const auto start = std::chrono::steady_clock::now();
+		ImFontBaked* baked = font->GetFontBaked(size);
+		for (const auto& [first, last]: config.ranges) {
+			for (uint32_t codepoint = first; codepoint <= last; ++codepoint) {
+				const ImFontGlyph* glyph = baked->FindGlyphNoFallback(static_cast<ImWchar>(codepoint));
+				if (glyph == nullptr || glyph->PackId == ImFontAtlasRectId_Invalid)
+					continue;
+				const ImTextureRect* rect = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+				measure.bytes += static_cast<uint64_t>(rect->w) * rect->h * bytesPerPixel;
+				++measure.glyphs;
+			}
+		}
+		measure.bakeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		m_bitmapMeasures.push_back(measure);
+	}
+}
+
+}// namespace mvi::core::views
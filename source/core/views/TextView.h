@@ -0,0 +1,93 @@
+/**
+ * @file TextView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+
+#include <array>
+#include <vector>
+
+namespace mvi::core::views {
+
+/**
+ * @brief View comparing the MSDF text rendering with the bitmap atlas.
+ */
+class TextView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	TextView();
+	/**
+	 * @brief Default destructor.
+	 */
+	~TextView() override;
+
+	TextView(const TextView&) = delete;
+	TextView(TextView&&) = delete;
+	auto operator=(const TextView&) -> TextView& = delete;
+	auto operator=(TextView&&) -> TextView& = delete;
+
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "text_view"; }
+
+private:
+	/**
+	 * @brief Bitmap atlas measure for one size.
+	 */
+	struct BitmapMeasure {
+		/// Font size.
+		float size = 0.f;
+		/// Bake duration in milliseconds.
+		float bakeMs = 0.f;
+		/// Baked glyphs.
+		uint32_t glyphs = 0;
+		/// Atlas bytes used by the glyphs.
+		uint64_t bytes = 0;
+	};
+
+	/**
+	 * @brief Bake the measured glyphs at each size with the bitmap atlas.
+	 */
+	void measureBitmap();
+	/**
+	 * @brief Draw the main font settings.
+	 */
+	void drawFontSettings();
+	/**
+	 * @brief Draw the atlas budget statistics, and every glyph of a script at the displayed size.
+	 */
+	void drawAtlasBudget();
+
+	/// Displayed text size.
+	float m_size = 48.f;
+	/// Main font file, empty for the default one.
+	std::array<char, 256> m_fontPath{};
+	/// Main font size.
+	float m_fontSize = 20.f;
+	/// Bitmap atlas measures.
+	std::vector<BitmapMeasure> m_bitmapMeasures;
+	/// Draw every glyph of the selected script.
+	bool m_drawScript = false;
+	/// Selected script.
+	int m_script = 0;
+	/// Text of every glyph of the selected script, in UTF-8.
+	std::string m_scriptText;
+	/// Script of the text, -1 if not built.
+	int m_scriptTextFor = -1;
+};
+
+}// namespace mvi::core::views
@@ -9,16 +9,212 @@
 
 #include "View.h"
 
+#include "core/Application.h"
+#include "core/vulkan/DrawListTexture.h"
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
 namespace mvi::core::views {
 
+namespace {
+
+/// Generation of the retained contents, changed when they all need a rebuild.
+uint32_t g_retainedGeneration = 0;
+/// Weight of the last frame in the smoothed phase durations.
+constexpr double g_timingSmoothing = 0.05;
+/// Factor of the refresh rate while the user interacts with the view.
+constexpr double g_interactionBoost = 4.0;
+/// Duration of the raised refresh rate after the last interaction, in seconds.
+constexpr double g_interactionLinger = 0.5;
+
+/**
+ * @brief Measure a phase and update its durations.
+ * @param[in] iPhase The phase to run.
+ * @param[out] oLast The last duration, in milliseconds.
+ * @param[in,out] ioAverage The smoothed duration, in milliseconds.
+ */
+void timePhase(const std::function<void()>& iPhase, double& oLast, double& ioAverage) {
+	const auto start = std::chrono::steady_clock::now();
+	iPhase();
+	oLast = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	ioAverage += (oLast - ioAverage) * g_timingSmoothing;
+}
+
+/**
+ * @brief Check if the user interacts with the current window.
+ * @return True if the window is hovered, or has an active item.
+ */
+auto isInteracting() -> bool {
+	return ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows) ||
+		   (ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows) && ImGui::IsAnyItemActive());
+}
+
+/**
+ * @brief Compare two vectors.
+ * @param[in] iA The first vector.
+ * @param[in] iB The second vector.
+ * @param[in] iTolerance The tolerance on each component.
+ * @return True if they differ by more than the tolerance.
+ */
+auto differs(const ImVec2& iA, const ImVec2& iB, const float iTolerance) -> bool {
+	return std::abs(iA.x - iB.x) > iTolerance || std::abs(iA.y - iB.y) > iTolerance;
+}
+
+}// namespace
+
+/**
+ * @brief Cached rendering of the retained content, and what it depends on.
+ */
+struct View::Retained {
+	/// The cached rendering.
+	std::unique_ptr<vulkan::DrawListTexture> texture;
+	/// The texture holds the content.
+	bool valid = false;
+	/// The content was interactive at the last frame.
+	bool interacting = false;
+	/// Retained contents generation of the capture.
+	uint32_t generation = 0;
+	/// Captured area, relative to the window.
+	ImVec2 offset;
+	/// Captured area size.
+	ImVec2 size;
+	/// Window scroll.
+	ImVec2 scroll;
+	/// Framebuffer scale.
+	ImVec2 framebufferScale;
+	/// Cursor after the content, relative to the window.
+	ImVec2 cursor;
+	/// Content extent, relative to the window.
+	ImVec2 cursorMax;
+	/// Ideal content extent, relative to the window (auto-resize).
+	ImVec2 idealMax;
+};
+
 View::View() = default;
 
 View::~View() = default;
 
-void View::update() {
+auto View::scheduleRefresh(const FrameContext& iContext) -> bool {
+	// Not scheduled in the previous frame: the view was hidden, its data is outdated.
+	const bool shownAgain = iContext.frame != m_scheduledFrame + 1;
+	m_scheduledFrame = iContext.frame;
+	m_sinceRefresh += iContext.delta;
+	m_boostSeconds = std::max(m_boostSeconds - iContext.delta, 0.0);
+	m_refreshStats.boosted = m_refreshRate > 0.0 && m_boostSeconds > 0.0;
+	const double rate = m_refreshStats.boosted ? m_refreshRate * g_interactionBoost : m_refreshRate;
+	if (rate > 0.0 && m_refreshStats.refreshes > 0 && !shownAgain && m_sinceRefresh < 1.0 / rate) {
+		++m_refreshStats.skipped;
+		m_timings.prepareMs = 0.0;
+		m_refreshStats.savedMs += m_refreshStats.refreshMs / static_cast<double>(m_refreshStats.refreshes);
+		return false;
+	}
+	m_sinceRefresh = 0.0;
+	++m_refreshStats.refreshes;
+	return true;
+}
+
+void View::prepare(const FrameContext& iContext) {
 	if (m_showWindows) {
-		onUpdate();
+		timePhase([this, &iContext]() -> void { onPrepare(iContext); }, m_timings.prepareMs,
+				  m_timings.prepareAverageMs);
+		m_refreshStats.refreshMs += m_timings.prepareMs;
+	}
+}
+
+void View::update() {
+	if (!m_showWindows)
+		return;
+	if (m_window.title.empty()) {
+		timePhase([this]() -> void { onUpdate(); }, m_timings.updateMs, m_timings.updateAverageMs);
+		return;
 	}
+	timePhase(
+			[this]() -> void {
+				// Begin returns false for a collapsed, hidden or clipped window, whose content would be discarded.
+				if (ImGui::Begin(m_window.title.c_str(), m_window.closable ? &m_showWindows : nullptr,
+								 m_window.flags)) {
+					onUpdate();
+					++m_updateStats.builtFrames;
+					if (m_refreshRate > 0.0 && isInteracting())
+						m_boostSeconds = g_interactionLinger;
+				} else {
+					++m_updateStats.skippedFrames;
+				}
+				ImGui::End();
+			},
+			m_timings.updateMs, m_timings.updateAverageMs);
+}
+
+void View::setRetained(const bool iRetained) {
+	m_retained = iRetained;
+	m_dirty = true;
+	if (!m_retained)
+		m_retainedData.reset();
+}
+
+void View::invalidateRetained() { ++g_retainedGeneration; }
+
+void View::retainedContent(const std::function<void()>& iContent) {
+	if (!m_retained) {
+		iContent();
+		return;
+	}
+	if (m_retainedData == nullptr) {
+		m_retainedData = std::make_unique<Retained>();
+		if (auto* context = Application::get().getMainWindow().getVulkanContext(); context != nullptr)
+			m_retainedData->texture = std::make_unique<vulkan::DrawListTexture>(*context);
+	}
+	auto& data = *m_retainedData;
+	ImGuiWindow* window = ImGui::GetCurrentWindow();
+	ImDrawList* drawList = window->DrawList;
+	const ImVec2 clipMin = drawList->GetClipRectMin();
+	const ImVec2 clipMax = drawList->GetClipRectMax();
+	const ImVec2 size = {clipMax.x - clipMin.x, clipMax.y - clipMin.y};
+	const ImVec2 framebufferScale = ImGui::GetIO().DisplayFramebufferScale;
+
+	// Interactions need the live widgets; their end needs a new capture, as the content may have changed.
+	const bool interacting = isInteracting();
+	const bool stale = !data.valid || m_dirty || data.interacting || data.generation != g_retainedGeneration ||
+					   differs(size, data.size, 0.5f) || differs(window->Scroll, data.scroll, 0.5f) ||
+					   differs(framebufferScale, data.framebufferScale, 1e-3f);
+	data.interacting = interacting;
+	const bool canCapture = data.texture != nullptr && data.texture->isAvailable() && size.x >= 1.f && size.y >= 1.f;
+
+	if (!canCapture || interacting || stale) {
+		m_dirty = false;
+		const auto mark = vulkan::DrawListTexture::mark(*drawList);
+		iContent();
+		++m_retainedStats.liveFrames;
+		data.valid = false;
+		if (!canCapture || interacting || m_dirty)
+			return;
+		ImVec4 background = ImGui::GetStyleColorVec4(ImGuiCol_WindowBg);
+		if (window->Flags & ImGuiWindowFlags_ChildWindow)
+			background = ImGui::GetStyleColorVec4(ImGuiCol_ChildBg);
+		if (!data.texture->capture(*drawList, mark, clipMin, clipMax, background))
+			return;
+		++m_retainedStats.captures;
+		data.valid = true;
+		data.generation = g_retainedGeneration;
+		data.offset = {clipMin.x - window->Pos.x, clipMin.y - window->Pos.y};
+		data.size = size;
+		data.scroll = window->Scroll;
+		data.framebufferScale = framebufferScale;
+		data.cursor = {window->DC.CursorPos.x - window->Pos.x, window->DC.CursorPos.y - window->Pos.y};
+		data.cursorMax = {window->DC.CursorMaxPos.x - window->Pos.x, window->DC.CursorMaxPos.y - window->Pos.y};
+		data.idealMax = {window->DC.IdealMaxPos.x - window->Pos.x, window->DC.IdealMaxPos.y - window->Pos.y};
+		return;
+	}
+
+	// Cached: the texture in place of the content, and the layout the content would have left.
+	data.texture->draw(drawList, {window->Pos.x + data.offset.x, window->Pos.y + data.offset.y});
+	window->DC.CursorPos = {window->Pos.x + data.cursor.x, window->Pos.y + data.cursor.y};
+	window->DC.CursorMaxPos = ImMax(window->DC.CursorMaxPos,
+									ImVec2(window->Pos.x + data.cursorMax.x, window->Pos.y + data.cursorMax.y));
+	window->DC.IdealMaxPos =
+			ImMax(window->DC.IdealMaxPos, ImVec2(window->Pos.x + data.idealMax.x, window->Pos.y + data.idealMax.y));
+	++m_retainedStats.cachedFrames;
 }
 
 }// namespace mvi::core::views
@@ -9,10 +9,40 @@
 #pragma once
 #include "core/event/Event.h"
 
+#include <functional>
+#include <memory>
+#include <string>
+
 namespace mvi::core::views {
 
+/**
+ * @brief Frame information given to the preparation of the views.
+ */
+struct FrameContext {
+	/// Frame index.
+	uint64_t frame = 0;
+	/// Duration of the last frame, in seconds.
+	double delta = 0.0;
+	/// Interpolation factor between the last two ticks.
+	double alpha = 0.0;
+	/// Index of the last tick.
+	uint64_t tick = 0;
+};
+
 /**
  * @brief Class View.
+ *
+ * A frame has two phases. The visible views are first prepared in parallel on the job workers by
+ * onPrepare(), which computes the data of the frame without ImGui call; each view only touches its own data,
+ * the main thread waiting meanwhile. Then onUpdate() is called in order on the main thread, and only emits
+ * the ImGui calls from the prepared data.
+ *
+ * The view owns its window: update() opens it, and only calls onUpdate() for its content when ImGui reports it
+ * visible, so a collapsed window, a hidden dock tab or a clipped window costs no widget.
+ *
+ * A view may refresh its data below the display rate: onPrepare() is then only called at the refresh rate,
+ * onUpdate() building the widgets from the last prepared data in between. The rate is raised while the user
+ * interacts with the window.
  */
 class View {
 public:
@@ -31,7 +61,32 @@ public:
 	auto operator=(View&&) -> View& = delete;
 
 	/**
-	 * @brief Update function called each frame.
+	 * @brief Window opened by the view around its content.
+	 */
+	struct Window {
+		/// Window title, empty if the view opens its own windows in onUpdate().
+		std::string title;
+		/// ImGui window flags.
+		int flags = 0;
+		/// The window has a close button, hiding the view.
+		bool closable = true;
+	};
+
+	/**
+	 * @brief Preparation function called each frame, from a job worker.
+	 * @param[in] iContext The frame information.
+	 */
+	void prepare(const FrameContext& iContext);
+	/**
+	 * @brief Advance the refresh clock, to call each frame on the main thread before the preparation.
+	 *
+	 * The clock only runs while visible, so a view shown again is refreshed at once.
+	 * @param[in] iContext The frame information.
+	 * @return True if the view data is to be prepared in this frame.
+	 */
+	[[nodiscard]] auto scheduleRefresh(const FrameContext& iContext) -> bool;
+	/**
+	 * @brief Update function called each frame, opening the window and building its content if visible.
 	 */
 	void update();
 
@@ -50,7 +105,12 @@ public:
 	[[nodiscard]] auto isVisible() const -> bool { return m_showWindows; }
 
 	/**
-	 * @brief The update function to implement in derived classes.
+	 * @brief The preparation function to implement in derived classes, without ImGui call.
+	 * @param[in] iContext The frame information.
+	 */
+	virtual void onPrepare([[maybe_unused]] const FrameContext& iContext) {}
+	/**
+	 * @brief The window content function to implement in derived classes, called only when the window is visible.
 	 */
 	virtual void onUpdate() = 0;
 
@@ -72,9 +132,159 @@ public:
 	 */
 	virtual void onEvent([[maybe_unused]] event::Event& ioEvent) {}
 
+	/**
+	 * @brief Durations of the frame phases.
+	 */
+	struct PhaseTimings {
+		/// Preparation of the last frame, in milliseconds, 0 if skipped.
+		double prepareMs = 0.0;
+		/// Last update, in milliseconds.
+		double updateMs = 0.0;
+		/// Smoothed preparation, in milliseconds.
+		double prepareAverageMs = 0.0;
+		/// Smoothed update, in milliseconds.
+		double updateAverageMs = 0.0;
+	};
+
+	/**
+	 * @brief Get the durations of the frame phases of the view.
+	 * @return The durations.
+	 */
+	[[nodiscard]] auto getPhaseTimings() const -> const PhaseTimings& { return m_timings; }
+
+	/**
+	 * @brief Window content statistics.
+	 */
+	struct UpdateStats {
+		/// Frames where the content was built.
+		uint64_t builtFrames = 0;
+		/// Frames where the window was shown but not visible, and the content skipped.
+		uint64_t skippedFrames = 0;
+	};
+
+	/**
+	 * @brief Get the window content statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getUpdateStats() const -> const UpdateStats& { return m_updateStats; }
+
+	/**
+	 * @brief Set the refresh rate of the data prepared by onPrepare().
+	 * @param[in] iRate The rate, in hertz, 0 to refresh at every frame.
+	 */
+	void setRefreshRate(const double iRate) { m_refreshRate = iRate; }
+	/**
+	 * @brief Get the refresh rate of the data prepared by onPrepare().
+	 * @return The rate, in hertz, 0 to refresh at every frame.
+	 */
+	[[nodiscard]] auto getRefreshRate() const -> double { return m_refreshRate; }
+
+	/**
+	 * @brief Data refresh statistics.
+	 */
+	struct RefreshStats {
+		/// Frames where the data was prepared.
+		uint64_t refreshes = 0;
+		/// Frames where the preparation was skipped.
+		uint64_t skipped = 0;
+		/// Total duration of the preparations, in milliseconds.
+		double refreshMs = 0.0;
+		/// Estimated duration of the skipped preparations, in milliseconds.
+		double savedMs = 0.0;
+		/// The rate is raised by an interaction.
+		bool boosted = false;
+	};
+
+	/**
+	 * @brief Get the data refresh statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getRefreshStats() const -> const RefreshStats& { return m_refreshStats; }
+
+	/**
+	 * @brief Retained mode statistics.
+	 */
+	struct RetainedStats {
+		/// Frames where the retained content was built.
+		uint64_t liveFrames = 0;
+		/// Frames where the cached texture was drawn instead.
+		uint64_t cachedFrames = 0;
+		/// Renderings into the cached texture.
+		uint64_t captures = 0;
+	};
+
+	/**
+	 * @brief Enable or disable the retained mode of the content given to retainedContent().
+	 * @param[in] iRetained The retained flag.
+	 */
+	void setRetained(bool iRetained);
+	/**
+	 * @brief Check if the retained mode is enabled.
+	 * @return True if retained.
+	 */
+	[[nodiscard]] auto isRetained() const -> bool { return m_retained; }
+	/**
+	 * @brief Request a rebuild of the retained content at the next frame.
+	 */
+	void markDirty() { m_dirty = true; }
+	/**
+	 * @brief Get the retained mode statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getRetainedStats() const -> const RetainedStats& { return m_retainedStats; }
+	/**
+	 * @brief Invalidate the retained content of all the views (theme or font change).
+	 */
+	static void invalidateRetained();
+
+protected:
+	/**
+	 * @brief Define the window opened around the content, to call from the constructor.
+	 * @param[in] iWindow The window.
+	 */
+	void setWindow(Window iWindow) { m_window = std::move(iWindow); }
+
+	/**
+	 * @brief Build the content of the current window, or draw its cached rendering.
+	 *
+	 * To call from onUpdate(), for the content filling the rest of the window.
+	 * In retained mode, the content is built and rendered into a texture, then the texture is drawn in the next
+	 * frames. The content is built again when the view is dirty, hovered or has an active item, and when the
+	 * window is resized or scrolled. Child windows and popups opened by the content are not cached.
+	 * @param[in] iContent The content building function.
+	 */
+	void retainedContent(const std::function<void()>& iContent);
+
 private:
+	/// Retained mode data.
+	struct Retained;
+
 	/// Show windows flag.
 	bool m_showWindows = true;
+	/// The window opened around the content.
+	Window m_window;
+	/// Window content statistics.
+	UpdateStats m_updateStats;
+	/// Refresh rate of the prepared data, in hertz, 0 for every frame.
+	double m_refreshRate = 0.0;
+	/// Time since the last refresh, in seconds.
+	double m_sinceRefresh = 0.0;
+	/// Frame of the last refresh scheduling, a gap meaning the view was hidden in between.
+	uint64_t m_scheduledFrame = 0;
+	/// Remaining time of the raised rate, in seconds.
+	double m_boostSeconds = 0.0;
+	/// Data refresh statistics.
+	RefreshStats m_refreshStats;
+	/// Retained mode flag.
+	bool m_retained = false;
+	/// Rebuild request.
+	bool m_dirty = true;
+	/// Retained mode data.
+	std::unique_ptr<Retained> m_retainedData;
+	/// Retained mode statistics.
+	RetainedStats m_retainedStats;
+	/// Durations of the frame phases.
+	PhaseTimings m_timings;
 };
 
 }// namespace mvi::core::views
@@ -0,0 +1,122 @@
+/**
+ * @file ViewRegistry.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ViewRegistry.h"
+
+#include "core/Log.h"
+
+namespace mvi::core::views {
+
+ViewRegistry::ViewRegistry() = default;
+
+ViewRegistry::~ViewRegistry() { clear(); }
+
+auto ViewRegistry::registerView(const std::string& iName, Factory iFactory, Options iOptions) -> NameId {
+	const NameId id(iName);
+	if (find(id) != nullptr) {
+		log_warn("View '{}' already registered.", iName);
+		return id;
+	}
+	const bool shown = iOptions.shown;
+	m_index.insert(id, static_cast<uint32_t>(m_entries.size()));
+	m_entries.push_back({.name = iName,
+						 .id = id,
+						 .factory = std::move(iFactory),
+						 .options = std::move(iOptions),
+						 .instance = nullptr,
+						 .requested = shown,
+						 .hiddenSince = std::nullopt});
+	return id;
+}
+
+void ViewRegistry::setShown(const NameId iId, const bool iShown) {
+	auto* entry = find(iId);
+	if (entry == nullptr)
+		return;
+	entry->requested = iShown;
+	if (entry->instance == nullptr)
+		return;
+	if (iShown)
+		entry->instance->show();
+	else
+		entry->instance->hide();
+}
+
+auto ViewRegistry::isShown(const NameId iId) const -> bool {
+	const auto* entry = find(iId);
+	if (entry == nullptr)
+		return false;
+	return entry->instance != nullptr ? entry->instance->isVisible() : entry->requested;
+}
+
+auto ViewRegistry::get(const NameId iId) const -> std::shared_ptr<View> {
+	const auto* entry = find(iId);
+	return entry != nullptr ? entry->instance : nullptr;
+}
+
+void ViewRegistry::update(const clock::time_point iNow) {
+	bool changed = false;
+	for (auto& entry: m_entries) {
+		if (entry.instance == nullptr) {
+			if (!entry.requested)
+				continue;
+			entry.instance = entry.factory();
+			entry.instance->show();
+			entry.hiddenSince.reset();
+			++m_stats.creations;
+			changed = true;
+			log_trace("View '{}' built.", entry.name);
+			continue;
+		}
+		if (entry.instance->isVisible()) {
+			entry.hiddenSince.reset();
+			continue;
+		}
+		entry.requested = false;
+		if (entry.options.keepAlive || m_destroyDelay < 0.0)
+			continue;
+		if (!entry.hiddenSince.has_value()) {
+			entry.hiddenSince = iNow;
+			continue;
+		}
+		if (std::chrono::duration<double>(iNow - *entry.hiddenSince).count() < m_destroyDelay)
+			continue;
+		entry.instance.reset();
+		entry.hiddenSince.reset();
+		++m_stats.destructions;
+		changed = true;
+		log_trace("View '{}' destroyed after being hidden.", entry.name);
+	}
+	if (!changed)
+		return;
+	m_views.clear();
+	for (const auto& entry: m_entries) {
+		if (entry.instance != nullptr)
+			m_views.push_back(entry.instance);
+	}
+	m_stats.built = m_views.size();
+}
+
+void ViewRegistry::clear() {
+	m_views.clear();
+	for (auto& entry: m_entries) entry.instance.reset();
+	m_stats.built = 0;
+}
+
+auto ViewRegistry::find(const NameId iId) -> Entry* {
+	const uint32_t slot = m_index.find(iId);
+	return slot != SlotIndex::g_noSlot ? &m_entries[slot] : nullptr;
+}
+
+auto ViewRegistry::find(const NameId iId) const -> const Entry* {
+	const uint32_t slot = m_index.find(iId);
+	return slot != SlotIndex::g_noSlot ? &m_entries[slot] : nullptr;
+}
+
+}// namespace mvi::core::views
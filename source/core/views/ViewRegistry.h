@@ -0,0 +1,220 @@
+/**
+ * @file ViewRegistry.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+#include "core/NameId.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mvi::core::views {
+
+/**
+ * @brief Registry of the view factories, building the views on their first show.
+ *
+ * Registering a view only stores its factory. The view is built at the first frame after it is shown, and
+ * may be destroyed once hidden for the destruction delay, to be built again at its next show. The views are
+ * built and destroyed by update(), at the start of a frame, so the list of views never changes during the
+ * frame. The entries are stored contiguously in registration order, and indexed by the interned view names.
+ */
+class ViewRegistry final {
+public:
+	/// Clock of the registry.
+	using clock = std::chrono::steady_clock;
+	/// View factory.
+	using Factory = std::function<std::shared_ptr<View>()>;
+
+	/**
+	 * @brief Registration options.
+	 */
+	struct Options {
+		/// Label in the view list, empty to not list the view.
+		std::string label;
+		/// Shown at startup.
+		bool shown = false;
+		/// Never destroyed once built.
+		bool keepAlive = false;
+	};
+
+	/**
+	 * @brief Registered view.
+	 */
+	struct Entry {
+		/// The view name.
+		std::string name;
+		/// The interned view name.
+		NameId id;
+		/// The factory.
+		Factory factory;
+		/// The options.
+		Options options;
+		/// The view, null until built.
+		std::shared_ptr<View> instance;
+		/// Show requested before the view is built.
+		bool requested = false;
+		/// Time when the built view was hidden.
+		std::optional<clock::time_point> hiddenSince;
+	};
+
+	/**
+	 * @brief Registry statistics.
+	 */
+	struct Stats {
+		/// Built views.
+		size_t built = 0;
+		/// Views built since start.
+		uint64_t creations = 0;
+		/// Views destroyed since start.
+		uint64_t destructions = 0;
+	};
+
+	/**
+	 * @brief Default constructor.
+	 */
+	ViewRegistry();
+	/**
+	 * @brief Destructor, destroy the views.
+	 */
+	~ViewRegistry();
+
+	ViewRegistry(const ViewRegistry&) = delete;
+	ViewRegistry(ViewRegistry&&) = delete;
+	auto operator=(const ViewRegistry&) -> ViewRegistry& = delete;
+	auto operator=(ViewRegistry&&) -> ViewRegistry& = delete;
+
+	/**
+	 * @brief Register a view factory.
+	 * @param[in] iName The view name, as returned by the view.
+	 * @param[in] iFactory The factory.
+	 * @param[in] iOptions The options.
+	 * @return The interned view name.
+	 */
+	auto registerView(const std::string& iName, Factory iFactory, Options iOptions) -> NameId;
+	/**
+	 * @brief Register a default constructible view.
+	 * @tparam T The view type.
+	 * @param[in] iName The view name, as returned by the view.
+	 * @param[in] iOptions The options.
+	 * @return The interned view name.
+	 */
+	template<typename T>
+	auto registerView(const std::string& iName, Options iOptions) -> NameId {
+		return registerView(
+				iName, []() -> std::shared_ptr<View> { return std::make_shared<T>(); }, std::move(iOptions));
+	}
+
+	/**
+	 * @brief Set the delay before destroying a hidden view.
+	 * @param[in] iSeconds The delay, in seconds, negative to keep the hidden views.
+	 */
+	void setDestroyDelay(const double iSeconds) { m_destroyDelay = iSeconds; }
+	/**
+	 * @brief Get the delay before destroying a hidden view.
+	 * @return The delay, in seconds, negative to keep the hidden views.
+	 */
+	[[nodiscard]] auto getDestroyDelay() const -> double { return m_destroyDelay; }
+
+	/**
+	 * @brief Show or hide a view, built at the next update if needed.
+	 * @param[in] iId The interned view name.
+	 * @param[in] iShown The visibility.
+	 */
+	void setShown(NameId iId, bool iShown);
+	/**
+	 * @brief Show or hide a view, built at the next update if needed.
+	 * @param[in] iName The view name.
+	 * @param[in] iShown The visibility.
+	 */
+	void setShown(const std::string_view iName, const bool iShown) { setShown(NameId::find(iName), iShown); }
+	/**
+	 * @brief Check if a view is shown, or requested to be.
+	 * @param[in] iId The interned view name.
+	 * @return True if shown.
+	 */
+	[[nodiscard]] auto isShown(NameId iId) const -> bool;
+	/**
+	 * @brief Check if a view is shown, or requested to be.
+	 * @param[in] iName The view name.
+	 * @return True if shown.
+	 */
+	[[nodiscard]] auto isShown(const std::string_view iName) const -> bool { return isShown(NameId::find(iName)); }
+	/**
+	 * @brief Get a built view.
+	 * @param[in] iId The interned view name.
+	 * @return The view, null if not built or unknown.
+	 */
+	[[nodiscard]] auto get(NameId iId) const -> std::shared_ptr<View>;
+	/**
+	 * @brief Get a built view.
+	 * @param[in] iName The view name.
+	 * @return The view, null if not built or unknown.
+	 */
+	[[nodiscard]] auto get(const std::string_view iName) const -> std::shared_ptr<View> {
+		return get(NameId::find(iName));
+	}
+
+	/**
+	 * @brief Build the requested views and destroy the expired ones.
+	 * @param[in] iNow The current time.
+	 */
+	void update(clock::time_point iNow);
+	/**
+	 * @brief Destroy all the views.
+	 */
+	void clear();
+
+	/**
+	 * @brief Get the built views, in registration order.
+	 * @return The views.
+	 */
+	[[nodiscard]] auto getViews() const -> const std::vector<std::shared_ptr<View>>& { return m_views; }
+	/**
+	 * @brief Get the registered views.
+	 * @return The entries, in registration order.
+	 */
+	[[nodiscard]] auto getEntries() const -> const std::vector<Entry>& { return m_entries; }
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> const Stats& { return m_stats; }
+
+private:
+	/**
+	 * @brief Find an entry.
+	 * @param[in] iId The interned view name.
+	 * @return The entry, null if unknown.
+	 */
+	[[nodiscard]] auto find(NameId iId) -> Entry*;
+	/**
+	 * @brief Find an entry.
+	 * @param[in] iId The interned view name.
+	 * @return The entry, null if unknown.
+	 */
+	[[nodiscard]] auto find(NameId iId) const -> const Entry*;
+
+	/// Registered views.
+	std::vector<Entry> m_entries;
+	/// Entries by interned name.
+	SlotIndex m_index;
+	/// Built views.
+	std::vector<std::shared_ptr<View>> m_views;
+	/// Delay before destroying a hidden view, in seconds.
+	double m_destroyDelay = -1.0;
+	/// Statistics.
+	Stats m_stats;
+};
+
+}// namespace mvi::core::views
@@ -0,0 +1,209 @@
+/**
+ * @file ViewportView.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ViewportView.h"
+
+#include "core/Application.h"
+#include "core/vulkan/RenderTarget.h"
+#include "core/vulkan/Shader.h"
+#include "core/vulkan/VulkanContext.h"
+
+#include <imgui.h>
+
+namespace mvi::core::views {
+
+namespace {
+
+/// Vertex shader: two crossing triangles generated from the vertex index.
+constexpr std::string_view g_vertexShader = R"(#version 450 core
+layout(push_constant) uniform uPushConstant { float uAngle; float uAspect; } pc;
+out gl_PerVertex { vec4 gl_Position; };
+layout(location = 0) out vec3 vColor;
+const vec3 positions[6] = vec3[](vec3(0.0, -0.7, 0.0), vec3(0.6, 0.5, 0.0), vec3(-0.6, 0.5, 0.0),
+								 vec3(0.0, -0.7, -0.5), vec3(0.0, 0.5, 0.5), vec3(0.0, 0.5, -0.5));
+const vec3 colors[3] = vec3[](vec3(1.0, 0.3, 0.2), vec3(0.2, 1.0, 0.3), vec3(0.2, 0.4, 1.0));
+void main() {
+	vec3 p = positions[gl_VertexIndex];
+	float c = cos(pc.uAngle);
+	float s = sin(pc.uAngle);
+	p = vec3(c * p.x + s * p.z, p.y, -s * p.x + c * p.z);
+	gl_Position = vec4(p.x / pc.uAspect, p.y, 0.5 + 0.4 * p.z, 1.0);
+	vColor = colors[gl_VertexIndex % 3];
+}
+)";
+
+/// Fragment shader.
+constexpr std::string_view g_fragmentShader = R"(#version 450 core
+layout(location = 0) in vec3 vColor;
+layout(location = 0) out vec4 fColor;
+void main() { fColor = vec4(vColor, 1.0); }
+)";
+
+/**
+ * @brief Scene push constants.
+ */
+struct PushConstants {
+	/// Rotation angle.
+	float angle = 0.f;
+	/// Target aspect ratio.
+	float aspect = 1.f;
+};
+
+}// namespace
+
+ViewportView::ViewportView() { setWindow({.title = "Offscreen viewport", .flags = 0, .closable = true}); }
+
+ViewportView::~ViewportView() {
+	if (m_target == nullptr)
+		return;
+	m_target.reset();
+	const auto* context = Application::get().getMainWindow().getVulkanContext();
+	if (context == nullptr)
+		return;
+	auto& deletion = context->getDeletionQueue();
+	deletion.destroyPipeline(m_pipeline);
+	deletion.destroyPipelineLayout(m_pipelineLayout);
+}
+
+void ViewportView::onUpdate() {
+	if (!m_initialized)
+		m_initialized = init();
+	if (m_pipeline == VK_NULL_HANDLE) {
+		ImGui::TextUnformatted("Offscreen rendering is not available.");
+		return;
+	}
+	float scale = m_target->getResolutionScale();
+	ImGui::SetNextItemWidth(150.f);
+	if (ImGui::SliderFloat("Resolution scale", &scale, 0.25f, 2.f, "%.2f"))
+		m_target->setResolutionScale(scale);
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(150.f);
+	ImGui::SliderFloat("Speed", &m_speed, 0.f, 5.f, "%.1f rad/s");
+	const auto extent = m_target->getExtent();
+	ImGui::Text("Target %ux%u, %.1f MiB, %u resizes", extent.width, extent.height,
+				static_cast<double>(m_target->getMemorySize()) / (1024.0 * 1024.0), m_target->getResizeCount());
+	m_angle += m_speed * ImGui::GetIO().DeltaTime;
+
+	const ImVec2 region = ImGui::GetContentRegionAvail();
+	if (region.x >= 1.f && region.y >= 1.f && m_target->prepare(region))
+		m_target->drawImage(region);
+}
+
+auto ViewportView::init() -> bool {
+	auto* context = Application::get().getMainWindow().getVulkanContext();
+	if (context == nullptr)
+		return false;
+	const auto& vkData = context->getVkData();
+	m_target = std::make_unique<vulkan::RenderTarget>(
+			*context, vulkan::RenderTarget::Config{.clearColor = {0.08f, 0.08f, 0.1f, 1.f}});
+	m_target->setRecorder([this](VkCommandBuffer iCommandBuffer, const vulkan::RenderTarget& iTarget) -> void {
+		record(iCommandBuffer, iTarget);
+	});
+	VkResult err = VK_SUCCESS;
+	{
+		VkPushConstantRange push_constants = {};
+		push_constants.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+		push_constants.offset = 0;
+		push_constants.size = sizeof(PushConstants);
+		VkPipelineLayoutCreateInfo layout_info = {};
+		layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		layout_info.pushConstantRangeCount = 1;
+		layout_info.pPushConstantRanges = &push_constants;
+		err = vkCreatePipelineLayout(vkData.device, &layout_info, vkData.allocator, &m_pipelineLayout);
+		vulkan::VulkanContext::checkVkResult(err);
+	}
+
+	const auto vertexCode = vulkan::compileShader(g_vertexShader, vulkan::ShaderStage::Vertex, "viewport.vert");
+	const auto fragmentCode = vulkan::compileShader(g_fragmentShader, vulkan::ShaderStage::Fragment, "viewport.frag");
+	VkShaderModule vertexModule = vulkan::createShaderModule(vkData, vertexCode);
+	VkShaderModule fragmentModule = vulkan::createShaderModule(vkData, fragmentCode);
+	if (vertexModule == VK_NULL_HANDLE || fragmentModule == VK_NULL_HANDLE) {
+		vkDestroyShaderModule(vkData.device, vertexModule, vkData.allocator);
+		vkDestroyShaderModule(vkData.device, fragmentModule, vkData.allocator);
+		return true;
+	}
+	std::array<VkPipelineShaderStageCreateInfo, 2> stages = {};
+	stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	stages[0].module = vertexModule;
+	stages[0].pName = "main";
+	stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	stages[1].module = fragmentModule;
+	stages[1].pName = "main";
+
+	VkPipelineVertexInputStateCreateInfo vertex_info = {};
+	vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+	VkPipelineInputAssemblyStateCreateInfo ia_info = {};
+	ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	ia_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+	VkPipelineViewportStateCreateInfo viewport_info = {};
+	viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	viewport_info.viewportCount = 1;
+	viewport_info.scissorCount = 1;
+	VkPipelineRasterizationStateCreateInfo raster_info = {};
+	raster_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	raster_info.polygonMode = VK_POLYGON_MODE_FILL;
+	raster_info.cullMode = VK_CULL_MODE_NONE;
+	raster_info.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	raster_info.lineWidth = 1.0f;
+	VkPipelineMultisampleStateCreateInfo ms_info = {};
+	ms_info.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	ms_info.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+	VkPipelineDepthStencilStateCreateInfo depth_info = {};
+	depth_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+	depth_info.depthTestEnable = VK_TRUE;
+	depth_info.depthWriteEnable = VK_TRUE;
+	depth_info.depthCompareOp = VK_COMPARE_OP_LESS;
+	VkPipelineColorBlendAttachmentState color_attachment = {};
+	color_attachment.colorWriteMask =
+			VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+	VkPipelineColorBlendStateCreateInfo blend_info = {};
+	blend_info.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	blend_info.attachmentCount = 1;
+	blend_info.pAttachments = &color_attachment;
+	constexpr std::array dynamic_states = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+	VkPipelineDynamicStateCreateInfo dynamic_state = {};
+	dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+	dynamic_state.dynamicStateCount = static_cast<uint32_t>(dynamic_states.size());
+	dynamic_state.pDynamicStates = dynamic_states.data();
+
+	VkGraphicsPipelineCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	info.stageCount = static_cast<uint32_t>(stages.size());
+	info.pStages = stages.data();
+	info.pVertexInputState = &vertex_info;
+	info.pInputAssemblyState = &ia_info;
+	info.pViewportState = &viewport_info;
+	info.pRasterizationState = &raster_info;
+	info.pMultisampleState = &ms_info;
+	info.pDepthStencilState = &depth_info;
+	info.pColorBlendState = &blend_info;
+	info.pDynamicState = &dynamic_state;
+	info.layout = m_pipelineLayout;
+	info.renderPass = m_target->getRenderPass();
+	info.subpass = 0;
+	err = vkCreateGraphicsPipelines(vkData.device, vkData.pipelineCache, 1, &info, vkData.allocator, &m_pipeline);
+	vulkan::VulkanContext::checkVkResult(err);
+	vkDestroyShaderModule(vkData.device, vertexModule, vkData.allocator);
+	vkDestroyShaderModule(vkData.device, fragmentModule, vkData.allocator);
+	return true;
+}
+
+void ViewportView::record(VkCommandBuffer iCommandBuffer, const vulkan::RenderTarget& iTarget) const {
+	const auto extent = iTarget.getExtent();
+	const PushConstants constants{.angle = m_angle,
+								  .aspect = static_cast<float>(extent.width) / static_cast<float>(extent.height)};
+	vkCmdBindPipeline(iCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline);
+	vkCmdPushConstants(iCommandBuffer, m_pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PushConstants),
+					   &constants);
+	vkCmdDraw(iCommandBuffer, 6, 1, 0, 0);
+}
+
+}// namespace mvi::core::views
@@ -0,0 +1,78 @@
+/**
+ * @file ViewportView.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "View.h"
+#include "core/vulkan/vkData.h"
+
+#include <memory>
+
+namespace mvi::core::vulkan {
+class RenderTarget;
+}// namespace mvi::core::vulkan
+
+namespace mvi::core::views {
+
+/**
+ * @brief View drawing a 3D scene with its own pipeline into an offscreen target.
+ */
+class ViewportView final : public View {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	ViewportView();
+	/**
+	 * @brief Default destructor.
+	 */
+	~ViewportView() override;
+
+	ViewportView(const ViewportView&) = delete;
+	ViewportView(ViewportView&&) = delete;
+	auto operator=(const ViewportView&) -> ViewportView& = delete;
+	auto operator=(ViewportView&&) -> ViewportView& = delete;
+
+	/**
+	 * @brief The update function to implement in derived classes.
+	 */
+	void onUpdate() override;
+	/**
+	 * @brief Get the view name.
+	 * @return The view name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "viewport_view"; }
+
+private:
+	/**
+	 * @brief Create the target and the pipeline.
+	 * @return True if the view can draw.
+	 */
+	auto init() -> bool;
+	/**
+	 * @brief Record the scene into the target.
+	 * @param[in] iCommandBuffer The command buffer.
+	 * @param[in] iTarget The target.
+	 */
+	void record(VkCommandBuffer iCommandBuffer, const vulkan::RenderTarget& iTarget) const;
+
+	/// The offscreen target.
+	std::unique_ptr<vulkan::RenderTarget> m_target;
+	/// Scene pipeline layout.
+	VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+	/// Scene pipeline.
+	VkPipeline m_pipeline = VK_NULL_HANDLE;
+	/// Initialization done flag.
+	bool m_initialized = false;
+	/// Rotation angle.
+	float m_angle = 0.f;
+	/// Rotation speed, in radians per second.
+	float m_speed = 1.f;
+};
+
+}// namespace mvi::core::views
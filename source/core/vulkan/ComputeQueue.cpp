@@ -0,0 +1,340 @@
+/**
+ * @file ComputeQueue.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ComputeQueue.h"
+
+#include "Shader.h"
+#include "VulkanContext.h"
+#include "core/Log.h"
+
+namespace mvi::core::vulkan {
+
+ComputeKernel::ComputeKernel(const VulkanContext& iContext, std::vector<uint32_t> iSpirv, const uint32_t iBindingCount,
+							 const uint32_t iPushConstantSize)
+	: m_context{iContext}, m_spirv{std::move(iSpirv)}, m_bindingCount{iBindingCount},
+	  m_pushConstantSize{iPushConstantSize} {}
+
+ComputeKernel::~ComputeKernel() {
+	const auto& vkData = m_context.getVkData();
+	vkDestroyPipeline(vkData.device, m_pipeline, vkData.allocator);
+	vkDestroyPipelineLayout(vkData.device, m_pipelineLayout, vkData.allocator);
+	vkDestroyDescriptorSetLayout(vkData.device, m_setLayout, vkData.allocator);
+}
+
+auto ComputeKernel::build() -> bool {
+	if (m_built)
+		return m_pipeline != VK_NULL_HANDLE;
+	m_built = true;
+	const auto& vkData = m_context.getVkData();
+	VkResult err = VK_SUCCESS;
+	{
+		std::vector<VkDescriptorSetLayoutBinding> bindings(m_bindingCount);
+		for (uint32_t i = 0; i < m_bindingCount; ++i) {
+			bindings[i].binding = i;
+			bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			bindings[i].descriptorCount = 1;
+			bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		}
+		VkDescriptorSetLayoutCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		info.bindingCount = m_bindingCount;
+		info.pBindings = bindings.data();
+		err = vkCreateDescriptorSetLayout(vkData.device, &info, vkData.allocator, &m_setLayout);
+		VulkanContext::checkVkResult(err);
+
+		VkPushConstantRange push_constants = {};
+		push_constants.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		push_constants.offset = 0;
+		push_constants.size = m_pushConstantSize;
+		VkPipelineLayoutCreateInfo layout_info = {};
+		layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		layout_info.setLayoutCount = 1;
+		layout_info.pSetLayouts = &m_setLayout;
+		layout_info.pushConstantRangeCount = m_pushConstantSize > 0 ? 1 : 0;
+		layout_info.pPushConstantRanges = &push_constants;
+		err = vkCreatePipelineLayout(vkData.device, &layout_info, vkData.allocator, &m_pipelineLayout);
+		VulkanContext::checkVkResult(err);
+	}
+	VkShaderModule module = createShaderModule(vkData, m_spirv);
+	if (module == VK_NULL_HANDLE)
+		return false;
+	VkComputePipelineCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+	info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+	info.stage.module = module;
+	info.stage.pName = "main";
+	info.layout = m_pipelineLayout;
+	err = vkCreateComputePipelines(vkData.device, vkData.pipelineCache, 1, &info, vkData.allocator, &m_pipeline);
+	VulkanContext::checkVkResult(err);
+	vkDestroyShaderModule(vkData.device, module, vkData.allocator);
+	m_spirv = {};
+	return m_pipeline != VK_NULL_HANDLE;
+}
+
+void ComputeResult::wait() const {
+	if (m_state == nullptr)
+		return;
+	std::unique_lock lock(m_state->mutex);
+	m_state->condition.wait(lock, [this]() -> bool { return m_state->ready.load(std::memory_order_acquire); });
+}
+
+auto ComputeResult::getData(const size_t iBinding) const -> std::span<const uint8_t> {
+	if (!isReady() || iBinding >= m_state->outputs.size())
+		return {};
+	return m_state->outputs[iBinding];
+}
+
+ComputeQueue::ComputeQueue(const VulkanContext& iContext) : m_context{iContext} {
+	const auto& vkData = m_context.getVkData();
+	VkCommandPoolCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+	info.queueFamilyIndex = vkData.computeQueueFamily;
+	const VkResult err = vkCreateCommandPool(vkData.device, &info, vkData.allocator, &m_commandPool);
+	VulkanContext::checkVkResult(err);
+}
+
+ComputeQueue::~ComputeQueue() {
+	collect(true);
+	for (auto& pending: m_queue) complete(pending, true);
+	const auto& vkData = m_context.getVkData();
+	for (const auto& batch: m_freeBatches) vkDestroyFence(vkData.device, batch.fence, vkData.allocator);
+	vkDestroyCommandPool(vkData.device, m_commandPool, vkData.allocator);
+}
+
+auto ComputeQueue::submit(Job iJob) -> ComputeResult {
+	ComputeResult result;
+	result.m_state = std::make_shared<ComputeResult::State>();
+	const std::scoped_lock lock(m_mutex);
+	m_queue.push_back({.job = std::move(iJob), .state = result.m_state, .buffers = {}});
+	++m_stats.submitted;
+	return result;
+}
+
+void ComputeQueue::flush() {
+	collect(false);
+	std::vector<Pending> jobs;
+	{
+		const std::scoped_lock lock(m_mutex);
+		std::swap(jobs, m_queue);
+	}
+	if (jobs.empty())
+		return;
+	const auto start = std::chrono::steady_clock::now();
+	const auto& vkData = m_context.getVkData();
+	VkResult err = VK_SUCCESS;
+
+	Batch batch;
+	if (!m_freeBatches.empty()) {
+		batch = std::move(m_freeBatches.back());
+		m_freeBatches.pop_back();
+	} else {
+		VkCommandBufferAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		alloc_info.commandPool = m_commandPool;
+		alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		alloc_info.commandBufferCount = 1;
+		err = vkAllocateCommandBuffers(vkData.device, &alloc_info, &batch.commandBuffer);
+		VulkanContext::checkVkResult(err);
+		VkFenceCreateInfo fence_info = {};
+		fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		err = vkCreateFence(vkData.device, &fence_info, vkData.allocator, &batch.fence);
+		VulkanContext::checkVkResult(err);
+	}
+	{
+		uint32_t bufferCount = 0;
+		for (const auto& pending: jobs) bufferCount += static_cast<uint32_t>(pending.job.bindings.size());
+		const VkDescriptorPoolSize pool_size = {.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+												.descriptorCount = std::max(bufferCount, 1u)};
+		VkDescriptorPoolCreateInfo pool_info = {};
+		pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		pool_info.maxSets = static_cast<uint32_t>(jobs.size());
+		pool_info.poolSizeCount = 1;
+		pool_info.pPoolSizes = &pool_size;
+		err = vkCreateDescriptorPool(vkData.device, &pool_info, vkData.allocator, &batch.descriptorPool);
+		VulkanContext::checkVkResult(err);
+	}
+
+	VkCommandBufferBeginInfo begin_info = {};
+	begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	err = vkBeginCommandBuffer(batch.commandBuffer, &begin_info);
+	VulkanContext::checkVkResult(err);
+	for (auto& pending: jobs) {
+		auto& job = pending.job;
+		if (job.kernel == nullptr || job.bindings.size() != job.kernel->getBindingCount() || !job.kernel->build()) {
+			log_warning("Compute job rejected: invalid kernel or bindings.");
+			complete(pending, true);
+			continue;
+		}
+		// Host writes are made visible to the device by the submission itself.
+		std::vector<VkDescriptorBufferInfo> buffer_infos;
+		for (const auto& binding: job.bindings) {
+			const size_t size = std::max<size_t>((std::max(binding.size, binding.data.size()) + 3) & ~size_t{3}, 4);
+			auto& buffer = pending.buffers.emplace_back(createBuffer(size));
+			std::memcpy(buffer.mapped, binding.data.data(), binding.data.size());
+			std::memset(static_cast<uint8_t*>(buffer.mapped) + binding.data.size(), 0, size - binding.data.size());
+			buffer_infos.push_back({.buffer = buffer.buffer, .offset = 0, .range = VK_WHOLE_SIZE});
+		}
+		VkDescriptorSetAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		alloc_info.descriptorPool = batch.descriptorPool;
+		alloc_info.descriptorSetCount = 1;
+		alloc_info.pSetLayouts = &job.kernel->m_setLayout;
+		VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+		err = vkAllocateDescriptorSets(vkData.device, &alloc_info, &descriptor_set);
+		VulkanContext::checkVkResult(err);
+		std::vector<VkWriteDescriptorSet> writes(buffer_infos.size());
+		for (size_t i = 0; i < writes.size(); ++i) {
+			writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			writes[i].dstSet = descriptor_set;
+			writes[i].dstBinding = static_cast<uint32_t>(i);
+			writes[i].descriptorCount = 1;
+			writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			writes[i].pBufferInfo = &buffer_infos[i];
+		}
+		vkUpdateDescriptorSets(vkData.device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+
+		vkCmdBindPipeline(batch.commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, job.kernel->m_pipeline);
+		vkCmdBindDescriptorSets(batch.commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, job.kernel->m_pipelineLayout, 0, 1,
+								&descriptor_set, 0, nullptr);
+		if (job.kernel->getPushConstantSize() > 0) {
+			job.pushConstants.resize(job.kernel->getPushConstantSize());
+			vkCmdPushConstants(batch.commandBuffer, job.kernel->m_pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+							   job.kernel->getPushConstantSize(), job.pushConstants.data());
+		}
+		vkCmdDispatch(batch.commandBuffer, job.groups[0], job.groups[1], job.groups[2]);
+		batch.jobs.push_back(std::move(pending));
+	}
+	// Jobs use distinct buffers: a single barrier makes all the results visible to the host.
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+	vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1,
+						 &barrier, 0, nullptr, 0, nullptr);
+	err = vkEndCommandBuffer(batch.commandBuffer);
+	VulkanContext::checkVkResult(err);
+
+	const bool submitted = !batch.jobs.empty();
+	if (!submitted) {
+		vkDestroyDescriptorPool(vkData.device, batch.descriptorPool, vkData.allocator);
+		batch.descriptorPool = VK_NULL_HANDLE;
+		m_freeBatches.push_back(std::move(batch));
+	} else {
+		VkSubmitInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		info.commandBufferCount = 1;
+		info.pCommandBuffers = &batch.commandBuffer;
+		err = vkQueueSubmit(vkData.computeQueue, 1, &info, batch.fence);
+		VulkanContext::checkVkResult(err);
+		m_inFlight.push_back(std::move(batch));
+	}
+	const std::scoped_lock lock(m_mutex);
+	if (submitted)
+		++m_stats.batches;
+	m_stats.inFlight = static_cast<uint32_t>(m_inFlight.size());
+	m_stats.flushMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+auto ComputeQueue::getStats() const -> Stats {
+	const std::scoped_lock lock(m_mutex);
+	return m_stats;
+}
+
+auto ComputeQueue::isAsync() const -> bool {
+	const auto& vkData = m_context.getVkData();
+	return vkData.computeQueueFamily != vkData.queueFamily;
+}
+
+void ComputeQueue::collect(const bool iWait) {
+	const auto& vkData = m_context.getVkData();
+	while (!m_inFlight.empty()) {
+		auto& batch = m_inFlight.front();
+		if (iWait) {
+			const VkResult err = vkWaitForFences(vkData.device, 1, &batch.fence, VK_TRUE, UINT64_MAX);
+			VulkanContext::checkVkResult(err);
+		} else if (vkGetFenceStatus(vkData.device, batch.fence) != VK_SUCCESS) {
+			break;
+		}
+		for (auto& pending: batch.jobs) complete(pending, false);
+		batch.jobs.clear();
+		vkDestroyDescriptorPool(vkData.device, batch.descriptorPool, vkData.allocator);
+		batch.descriptorPool = VK_NULL_HANDLE;
+		const VkResult err = vkResetFences(vkData.device, 1, &batch.fence);
+		VulkanContext::checkVkResult(err);
+		m_freeBatches.push_back(std::move(batch));
+		m_inFlight.pop_front();
+	}
+}
+
+void ComputeQueue::complete(Pending& ioPending, const bool iFailed) {
+	auto& state = *ioPending.state;
+	{
+		const std::scoped_lock lock(state.mutex);
+		state.failed = iFailed;
+		if (!iFailed) {
+			state.outputs.resize(ioPending.job.bindings.size());
+			for (size_t i = 0; i < ioPending.buffers.size(); ++i) {
+				if (!ioPending.job.bindings[i].readback)
+					continue;
+				const auto* data = static_cast<const uint8_t*>(ioPending.buffers[i].mapped);
+				state.outputs[i].assign(data, data + ioPending.buffers[i].size);
+			}
+		}
+		state.ready.store(true, std::memory_order_release);
+	}
+	state.condition.notify_all();
+	for (auto& buffer: ioPending.buffers) destroyBuffer(buffer);
+	ioPending.buffers.clear();
+	const std::scoped_lock lock(m_mutex);
+	if (iFailed)
+		++m_stats.failed;
+	else
+		++m_stats.completed;
+}
+
+auto ComputeQueue::createBuffer(const VkDeviceSize iSize) const -> Buffer {
+	const auto& vkData = m_context.getVkData();
+	Buffer buffer;
+	buffer.size = iSize;
+	VkBufferCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	info.size = iSize;
+	info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	VkResult err = vkCreateBuffer(vkData.device, &info, vkData.allocator, &buffer.buffer);
+	VulkanContext::checkVkResult(err);
+	VkMemoryRequirements requirements;
+	vkGetBufferMemoryRequirements(vkData.device, buffer.buffer, &requirements);
+	VkMemoryAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.allocationSize = requirements.size;
+	alloc_info.memoryTypeIndex = m_context.findMemoryType(
+			requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+	err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &buffer.memory);
+	VulkanContext::checkVkResult(err);
+	err = vkBindBufferMemory(vkData.device, buffer.buffer, buffer.memory, 0);
+	VulkanContext::checkVkResult(err);
+	err = vkMapMemory(vkData.device, buffer.memory, 0, iSize, 0, &buffer.mapped);
+	VulkanContext::checkVkResult(err);
+	return buffer;
+}
+
+void ComputeQueue::destroyBuffer(Buffer& ioBuffer) const {
+	const auto& vkData = m_context.getVkData();
+	vkUnmapMemory(vkData.device, ioBuffer.memory);
+	vkDestroyBuffer(vkData.device, ioBuffer.buffer, vkData.allocator);
+	vkFreeMemory(vkData.device, ioBuffer.memory, vkData.allocator);
+	ioBuffer = {};
+}
+
+}// namespace mvi::core::vulkan
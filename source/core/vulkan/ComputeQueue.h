@@ -0,0 +1,328 @@
+/**
+ * @file ComputeQueue.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "vkData.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Compute shader with its storage buffer bindings and push constants.
+ *
+ * The kernel reads and writes storage buffers bound at set 0, bindings 0 to N-1, in the job order.
+ * The pipeline is built on the first dispatch.
+ */
+class ComputeKernel final {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iContext The Vulkan context.
+	 * @param[in] iSpirv The SPIR-V code.
+	 * @param[in] iBindingCount Number of storage buffers.
+	 * @param[in] iPushConstantSize Size of the push constants block.
+	 */
+	ComputeKernel(const VulkanContext& iContext, std::vector<uint32_t> iSpirv, uint32_t iBindingCount,
+				  uint32_t iPushConstantSize);
+	/**
+	 * @brief Destructor.
+	 */
+	~ComputeKernel();
+
+	ComputeKernel(const ComputeKernel&) = delete;
+	ComputeKernel(ComputeKernel&&) = delete;
+	auto operator=(const ComputeKernel&) -> ComputeKernel& = delete;
+	auto operator=(ComputeKernel&&) -> ComputeKernel& = delete;
+
+	/**
+	 * @brief Get the number of storage buffers.
+	 * @return The binding count.
+	 */
+	[[nodiscard]] auto getBindingCount() const -> uint32_t { return m_bindingCount; }
+	/**
+	 * @brief Get the size of the push constants block.
+	 * @return The size in bytes.
+	 */
+	[[nodiscard]] auto getPushConstantSize() const -> uint32_t { return m_pushConstantSize; }
+
+private:
+	friend class ComputeQueue;
+	/**
+	 * @brief Build the pipeline if not done yet.
+	 * @return True if the kernel can be dispatched.
+	 */
+	auto build() -> bool;
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// The SPIR-V code, released once built.
+	std::vector<uint32_t> m_spirv;
+	/// Number of storage buffers.
+	uint32_t m_bindingCount = 0;
+	/// Size of the push constants block.
+	uint32_t m_pushConstantSize = 0;
+	/// Build attempted flag.
+	bool m_built = false;
+	/// Descriptor set layout.
+	VkDescriptorSetLayout m_setLayout = VK_NULL_HANDLE;
+	/// Pipeline layout.
+	VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+	/// Pipeline.
+	VkPipeline m_pipeline = VK_NULL_HANDLE;
+};
+
+/**
+ * @brief Future-like handle on the result of a compute job.
+ */
+class ComputeResult final {
+public:
+	/**
+	 * @brief Check if the job is done (non-blocking).
+	 * @return True if the outputs can be read.
+	 */
+	[[nodiscard]] auto isReady() const -> bool {
+		return m_state != nullptr && m_state->ready.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief Check if the handle refers to a job.
+	 * @return True if valid.
+	 */
+	[[nodiscard]] auto isValid() const -> bool { return m_state != nullptr; }
+	/**
+	 * @brief Check if the job could not run.
+	 * @return True if failed (only meaningful once ready).
+	 */
+	[[nodiscard]] auto hasFailed() const -> bool { return isReady() && m_state->failed; }
+	/**
+	 * @brief Block until the job is done.
+	 *
+	 * @note Never from the main thread: the jobs are submitted there.
+	 */
+	void wait() const;
+	/**
+	 * @brief Get the content of a read back buffer.
+	 * @param[in] iBinding The binding.
+	 * @return The buffer content, empty if not ready or not read back.
+	 */
+	[[nodiscard]] auto getData(size_t iBinding) const -> std::span<const uint8_t>;
+	/**
+	 * @brief Copy the content of a read back buffer.
+	 * @tparam T Element type.
+	 * @param[in] iBinding The binding.
+	 * @return The elements.
+	 */
+	template<typename T>
+	[[nodiscard]] auto copyTo(const size_t iBinding) const -> std::vector<T> {
+		const auto data = getData(iBinding);
+		std::vector<T> result(data.size() / sizeof(T));
+		if (!result.empty())
+			std::memcpy(result.data(), data.data(), result.size() * sizeof(T));
+		return result;
+	}
+
+private:
+	friend class ComputeQueue;
+	/**
+	 * @brief Shared job state.
+	 */
+	struct State {
+		/// Done flag.
+		std::atomic<bool> ready = false;
+		/// Failure flag.
+		bool failed = false;
+		/// Read back buffers, by binding.
+		std::vector<std::vector<uint8_t>> outputs;
+		/// Protect the wait.
+		std::mutex mutex;
+		/// Wake up the waiting threads.
+		std::condition_variable condition;
+	};
+	/// The state.
+	std::shared_ptr<State> m_state;
+};
+
+/**
+ * @brief Compute jobs batched into one submission per frame.
+ *
+ * Jobs are submitted from any thread. Once per frame, flush() records all the queued jobs into one
+ * command buffer, submitted to the dedicated compute queue if the device has one. Finished batches are
+ * detected without waiting, at the next flushes, and their read back buffers are copied into the results.
+ */
+class ComputeQueue final {
+public:
+	/**
+	 * @brief Storage buffer of a job.
+	 */
+	struct Binding {
+		/// Initial content.
+		std::vector<uint8_t> data;
+		/// Buffer size, at least the data size (the rest is zeroed).
+		size_t size = 0;
+		/// Copy the buffer back into the result.
+		bool readback = false;
+	};
+
+	/**
+	 * @brief Compute job.
+	 */
+	struct Job {
+		/// The kernel.
+		std::shared_ptr<ComputeKernel> kernel;
+		/// Storage buffers, by binding.
+		std::vector<Binding> bindings;
+		/// Push constants.
+		std::vector<uint8_t> pushConstants;
+		/// Number of work groups.
+		std::array<uint32_t, 3> groups = {1, 1, 1};
+	};
+
+	/**
+	 * @brief Queue statistics.
+	 */
+	struct Stats {
+		/// Submitted jobs.
+		uint64_t submitted = 0;
+		/// Completed jobs.
+		uint64_t completed = 0;
+		/// Jobs that could not run.
+		uint64_t failed = 0;
+		/// GPU submissions.
+		uint64_t batches = 0;
+		/// Batches running on the GPU.
+		uint32_t inFlight = 0;
+		/// Main thread time of the last flush, in milliseconds.
+		double flushMs = 0.0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iContext The Vulkan context.
+	 */
+	explicit ComputeQueue(const VulkanContext& iContext);
+	/**
+	 * @brief Destructor: wait for the running batches.
+	 */
+	~ComputeQueue();
+
+	ComputeQueue(const ComputeQueue&) = delete;
+	ComputeQueue(ComputeQueue&&) = delete;
+	auto operator=(const ComputeQueue&) -> ComputeQueue& = delete;
+	auto operator=(ComputeQueue&&) -> ComputeQueue& = delete;
+
+	/**
+	 * @brief Queue a job (thread-safe).
+	 * @param[in] iJob The job.
+	 * @return The result handle.
+	 */
+	auto submit(Job iJob) -> ComputeResult;
+	/**
+	 * @brief Complete the finished batches and submit the queued jobs (main thread, once per frame).
+	 */
+	void flush();
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> Stats;
+	/**
+	 * @brief Check if the jobs run on a dedicated compute queue.
+	 * @return True if asynchronous compute is used.
+	 */
+	[[nodiscard]] auto isAsync() const -> bool;
+
+private:
+	/**
+	 * @brief Host-visible storage buffer.
+	 */
+	struct Buffer {
+		/// The buffer.
+		VkBuffer buffer = VK_NULL_HANDLE;
+		/// Buffer memory.
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		/// Persistent mapping.
+		void* mapped = nullptr;
+		/// Buffer size.
+		VkDeviceSize size = 0;
+	};
+	/**
+	 * @brief Job waiting for its result.
+	 */
+	struct Pending {
+		/// The job.
+		Job job;
+		/// The result state.
+		std::shared_ptr<ComputeResult::State> state;
+		/// Job buffers.
+		std::vector<Buffer> buffers;
+	};
+	/**
+	 * @brief One submission.
+	 */
+	struct Batch {
+		/// Command buffer.
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+		/// Completion fence.
+		VkFence fence = VK_NULL_HANDLE;
+		/// Descriptor sets of the jobs.
+		VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+		/// The jobs.
+		std::vector<Pending> jobs;
+	};
+
+	/**
+	 * @brief Complete the finished batches.
+	 * @param[in] iWait Wait for all batches.
+	 */
+	void collect(bool iWait);
+	/**
+	 * @brief Publish a job result.
+	 * @param[in,out] ioPending The job.
+	 * @param[in] iFailed Failure flag.
+	 */
+	void complete(Pending& ioPending, bool iFailed);
+	/**
+	 * @brief Create a storage buffer.
+	 * @param[in] iSize The size.
+	 * @return The buffer.
+	 */
+	[[nodiscard]] auto createBuffer(VkDeviceSize iSize) const -> Buffer;
+	/**
+	 * @brief Destroy a storage buffer.
+	 * @param[in,out] ioBuffer The buffer.
+	 */
+	void destroyBuffer(Buffer& ioBuffer) const;
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// Command pool on the compute family.
+	VkCommandPool m_commandPool = VK_NULL_HANDLE;
+	/// Jobs waiting for the next flush.
+	std::vector<Pending> m_queue;
+	/// Batches running on the GPU, in submission order.
+	std::deque<Batch> m_inFlight;
+	/// Recycled command buffers and fences.
+	std::vector<Batch> m_freeBatches;
+	/// Protect the queue and the statistics.
+	mutable std::mutex m_mutex;
+	/// The statistics.
+	Stats m_stats;
+};
+
+}// namespace mvi::core::vulkan
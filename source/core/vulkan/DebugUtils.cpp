@@ -0,0 +1,197 @@
+/**
+ * @file DebugUtils.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "pch.h"
+
+#include "DebugUtils.h"
+
+#include "VulkanContext.h"
+#include "core/Log.h"
+#include "core/defines.h"
+
+#include <backends/imgui_impl_vulkan.h>// NOLINT
+#include <imgui.h>
+
+namespace mvi::core::vulkan {
+
+namespace {
+
+/**
+ * @brief Get an instance entry point.
+ * @tparam T The function pointer type.
+ * @param[in] iInstance The instance.
+ * @param[in] iName The entry point name.
+ * @return The entry point, null if not found.
+ */
+template<typename T>
+auto getProc(VkInstance iInstance, const char* iName) -> T {
+	MVI_DIAG_PUSH
+	MVI_DIAG_DISABLE_CLANG("-Wcast-function-type-strict")
+	const auto proc = reinterpret_cast<T>(vkGetInstanceProcAddr(iInstance, iName));
+	MVI_DIAG_POP
+	return proc;
+}
+
+/**
+ * @brief Get the command buffer being recorded by the ImGui backend.
+ * @return The command buffer.
+ */
+auto getImGuiCommandBuffer() -> VkCommandBuffer {
+	return static_cast<const ImGui_ImplVulkan_RenderState*>(ImGui::GetPlatformIO().Renderer_RenderState)
+			->CommandBuffer;
+}
+
+}// namespace
+
+DebugUtils::DebugUtils(const VulkanContext& iContext, const bool iEnabled) : m_context{iContext} {
+	if (!iEnabled)
+		return;
+	const auto& vkData = m_context.getVkData();
+	m_setObjectName = getProc<PFN_vkSetDebugUtilsObjectNameEXT>(vkData.instance, "vkSetDebugUtilsObjectNameEXT");
+	m_beginLabel = getProc<PFN_vkCmdBeginDebugUtilsLabelEXT>(vkData.instance, "vkCmdBeginDebugUtilsLabelEXT");
+	m_endLabel = getProc<PFN_vkCmdEndDebugUtilsLabelEXT>(vkData.instance, "vkCmdEndDebugUtilsLabelEXT");
+	if (m_beginLabel == nullptr || m_endLabel == nullptr)
+		m_setObjectName = nullptr;
+#ifdef APP_USE_VULKAN_DEBUG_REPORT
+	const auto createMessenger =
+			getProc<PFN_vkCreateDebugUtilsMessengerEXT>(vkData.instance, "vkCreateDebugUtilsMessengerEXT");
+	if (createMessenger == nullptr)
+		return;
+	VkDebugUtilsMessengerCreateInfoEXT info = {};
+	info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+	info.messageSeverity =
+			VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+	info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
+					   VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+	info.pfnUserCallback = messengerCallback;
+	info.pUserData = this;
+	const VkResult err = createMessenger(vkData.instance, &info, vkData.allocator, &m_messenger);
+	VulkanContext::checkVkResult(err);
+#endif
+}
+
+DebugUtils::~DebugUtils() {
+	if (m_messenger == VK_NULL_HANDLE)
+		return;
+	const auto& vkData = m_context.getVkData();
+	const auto destroyMessenger =
+			getProc<PFN_vkDestroyDebugUtilsMessengerEXT>(vkData.instance, "vkDestroyDebugUtilsMessengerEXT");
+	if (destroyMessenger != nullptr)
+		destroyMessenger(vkData.instance, m_messenger, vkData.allocator);
+}
+
+auto DebugUtils::isAvailable(const std::vector<VkExtensionProperties>& iProperties) -> bool {
+	return std::ranges::any_of(iProperties, [](const VkExtensionProperties& iProperty) -> bool {
+		return strcmp(iProperty.extensionName, VK_EXT_DEBUG_UTILS_EXTENSION_NAME) == 0;
+	});
+}
+
+void DebugUtils::setObjectName(const VkObjectType iType, const uint64_t iHandle, const std::string_view iName) const {
+	if (m_setObjectName == nullptr || iHandle == 0)
+		return;
+	const std::string name(iName);
+	VkDebugUtilsObjectNameInfoEXT info = {};
+	info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+	info.objectType = iType;
+	info.objectHandle = iHandle;
+	info.pObjectName = name.c_str();
+	const VkResult err = m_setObjectName(m_context.getVkData().device, &info);
+	VulkanContext::checkVkResult(err);
+}
+
+void DebugUtils::beginLabel(VkCommandBuffer iCommandBuffer, const std::string_view iName) const {
+	if (m_beginLabel == nullptr)
+		return;
+	const std::string name(iName);
+	// A stable color per name, so that the same pass or view is easy to follow across captures.
+	const size_t hash = std::hash<std::string_view>{}(iName);
+	VkDebugUtilsLabelEXT label = {};
+	label.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+	label.pLabelName = name.c_str();
+	label.color[0] = 0.4f + 0.6f * static_cast<float>(hash & 0xffu) / 255.0f;
+	label.color[1] = 0.4f + 0.6f * static_cast<float>((hash >> 8u) & 0xffu) / 255.0f;
+	label.color[2] = 0.4f + 0.6f * static_cast<float>((hash >> 16u) & 0xffu) / 255.0f;
+	label.color[3] = 1.0f;
+	m_beginLabel(iCommandBuffer, &label);
+}
+
+void DebugUtils::endLabel(VkCommandBuffer iCommandBuffer) const {
+	if (m_endLabel == nullptr)
+		return;
+	m_endLabel(iCommandBuffer);
+}
+
+void DebugUtils::labelDrawLists(ImDrawData* ioDrawData) {
+	m_drawListLabels.clear();
+	if (m_beginLabel == nullptr || ioDrawData == nullptr)
+		return;
+	// Stable addresses: the callbacks get a pointer on their label.
+	m_drawListLabels.reserve(static_cast<size_t>(ioDrawData->CmdLists.Size));
+	for (ImDrawList* list: ioDrawData->CmdLists) {
+		if (list->CmdBuffer.empty())
+			continue;
+		const char* owner = list->_OwnerName != nullptr ? list->_OwnerName : "ImGui";
+		m_drawListLabels.emplace_back(this, owner);
+		ImDrawCmd begin;
+		begin.UserCallback = [](const ImDrawList*, const ImDrawCmd* iCmd) -> void {
+			const auto* label = static_cast<const std::pair<const DebugUtils*, const char*>*>(iCmd->UserCallbackData);
+			label->first->beginLabel(getImGuiCommandBuffer(), label->second);
+		};
+		begin.UserCallbackData = &m_drawListLabels.back();
+		ImDrawCmd end;
+		end.UserCallback = [](const ImDrawList*, const ImDrawCmd* iCmd) -> void {
+			static_cast<const DebugUtils*>(iCmd->UserCallbackData)->endLabel(getImGuiCommandBuffer());
+		};
+		end.UserCallbackData = this;
+		list->CmdBuffer.insert(list->CmdBuffer.begin(), begin);
+		list->CmdBuffer.push_back(end);
+	}
+}
+
+VKAPI_ATTR auto VKAPI_CALL DebugUtils::messengerCallback(const VkDebugUtilsMessageSeverityFlagBitsEXT iSeverity,
+														 const VkDebugUtilsMessageTypeFlagsEXT iTypes,
+														 const VkDebugUtilsMessengerCallbackDataEXT* iData,
+														 void* iUserData) -> VkBool32 {
+	if (iData != nullptr && iUserData != nullptr)
+		static_cast<DebugUtils*>(iUserData)->report(iSeverity, iTypes, *iData);
+	return VK_FALSE;
+}
+
+void DebugUtils::report(const VkDebugUtilsMessageSeverityFlagBitsEXT iSeverity,
+						const VkDebugUtilsMessageTypeFlagsEXT iTypes,
+						const VkDebugUtilsMessengerCallbackDataEXT& iData) {
+	const std::string_view message = iData.pMessage != nullptr ? iData.pMessage : "";
+	const std::string_view id = iData.pMessageIdName != nullptr ? iData.pMessageIdName : "";
+	uint64_t count = 0;
+	{
+		// Same message id and text: the same issue, usually repeated every frame.
+		const size_t hash = std::hash<std::string_view>{}(message) ^
+							(static_cast<size_t>(static_cast<uint32_t>(iData.messageIdNumber)) * 0x9e3779b97f4a7c15ull);
+		const std::scoped_lock lock(m_mutex);
+		count = ++m_occurrences[hash];
+	}
+	uint64_t next = 1;
+	while (next < count) next *= 10;
+	if (next != count)
+		return;
+	const std::string_view kind =
+			(iTypes & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT) != 0 ? "performance" : "validation";
+	if ((iSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) != 0) {
+		if (count == 1)
+			log_error("[vulkan] {} {}: {}", kind, id, message);
+		else
+			log_error("[vulkan] {} {} (repeated {} times): {}", kind, id, count, message);
+	} else {
+		if (count == 1)
+			log_warning("[vulkan] {} {}: {}", kind, id, message);
+		else
+			log_warning("[vulkan] {} {} (repeated {} times): {}", kind, id, count, message);
+	}
+}
+
+}// namespace mvi::core::vulkan
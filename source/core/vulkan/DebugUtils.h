@@ -0,0 +1,173 @@
+/**
+ * @file DebugUtils.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "vkData.h"
+
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+struct ImDrawData;
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief VK_EXT_debug_utils support: object names, command buffer labels and validation messages.
+ *
+ * Names and labels are seen by the validation layers and by the capture and profiling tools. Everything is
+ * a no-op when the extension is not available. In debug builds, the validation and performance messages
+ * are routed to the logger, each distinct message being logged once (then on every tenfold repetition).
+ */
+class DebugUtils final {
+public:
+	/**
+	 * @brief Constructor (right after the instance creation).
+	 * @param[in] iContext The Vulkan context.
+	 * @param[in] iEnabled If the extension is enabled on the instance.
+	 */
+	DebugUtils(const VulkanContext& iContext, bool iEnabled);
+	/**
+	 * @brief Destructor.
+	 */
+	~DebugUtils();
+
+	DebugUtils(const DebugUtils&) = delete;
+	DebugUtils(DebugUtils&&) = delete;
+	auto operator=(const DebugUtils&) -> DebugUtils& = delete;
+	auto operator=(DebugUtils&&) -> DebugUtils& = delete;
+
+	/**
+	 * @brief Check if the extension is available among the instance extensions.
+	 * @param[in] iProperties The instance extensions.
+	 * @return True if available.
+	 */
+	[[nodiscard]] static auto isAvailable(const std::vector<VkExtensionProperties>& iProperties) -> bool;
+	/**
+	 * @brief Check if names and labels are recorded.
+	 * @return True if enabled.
+	 */
+	[[nodiscard]] auto isEnabled() const -> bool { return m_setObjectName != nullptr; }
+	/**
+	 * @brief Check if the messages are routed to the logger.
+	 * @return True if a messenger is installed.
+	 */
+	[[nodiscard]] auto hasMessenger() const -> bool { return m_messenger != VK_NULL_HANDLE; }
+
+	/**
+	 * @brief Name a Vulkan object.
+	 * @tparam T The handle type.
+	 * @param[in] iType The object type.
+	 * @param[in] iHandle The object.
+	 * @param[in] iName The name.
+	 */
+	template<typename T>
+	void setName(const VkObjectType iType, T iHandle, const std::string_view iName) const {
+		if constexpr (std::is_pointer_v<T>)
+			setObjectName(iType, reinterpret_cast<uint64_t>(iHandle), iName);
+		else
+			setObjectName(iType, static_cast<uint64_t>(iHandle), iName);
+	}
+	/**
+	 * @brief Name a Vulkan object.
+	 * @param[in] iType The object type.
+	 * @param[in] iHandle The object handle.
+	 * @param[in] iName The name.
+	 */
+	void setObjectName(VkObjectType iType, uint64_t iHandle, std::string_view iName) const;
+
+	/**
+	 * @brief Open a label region in a command buffer.
+	 * @param[in] iCommandBuffer The command buffer.
+	 * @param[in] iName The label, also giving its color.
+	 */
+	void beginLabel(VkCommandBuffer iCommandBuffer, std::string_view iName) const;
+	/**
+	 * @brief Close the last label region of a command buffer.
+	 * @param[in] iCommandBuffer The command buffer.
+	 */
+	void endLabel(VkCommandBuffer iCommandBuffer) const;
+	/**
+	 * @brief Wrap the commands of each ImGui draw list into a label named after its window.
+	 * @param[in,out] ioDrawData The draw data, before its rendering.
+	 */
+	void labelDrawLists(ImDrawData* ioDrawData);
+
+	/**
+	 * @brief RAII label region.
+	 */
+	class ScopedLabel final {
+	public:
+		/**
+		 * @brief Constructor: open the region.
+		 * @param[in] iDebug The debug utils.
+		 * @param[in] iCommandBuffer The command buffer.
+		 * @param[in] iName The label.
+		 */
+		ScopedLabel(const DebugUtils& iDebug, VkCommandBuffer iCommandBuffer, const std::string_view iName)
+			: m_debug{iDebug}, m_commandBuffer{iCommandBuffer} {
+			m_debug.beginLabel(m_commandBuffer, iName);
+		}
+		/**
+		 * @brief Destructor: close the region.
+		 */
+		~ScopedLabel() { m_debug.endLabel(m_commandBuffer); }
+
+		ScopedLabel(const ScopedLabel&) = delete;
+		ScopedLabel(ScopedLabel&&) = delete;
+		auto operator=(const ScopedLabel&) -> ScopedLabel& = delete;
+		auto operator=(ScopedLabel&&) -> ScopedLabel& = delete;
+
+	private:
+		/// The debug utils.
+		const DebugUtils& m_debug;
+		/// The command buffer.
+		VkCommandBuffer m_commandBuffer;
+	};
+
+private:
+	/**
+	 * @brief Messenger callback.
+	 */
+	static VKAPI_ATTR auto VKAPI_CALL messengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT iSeverity,
+														VkDebugUtilsMessageTypeFlagsEXT iTypes,
+														const VkDebugUtilsMessengerCallbackDataEXT* iData,
+														void* iUserData) -> VkBool32;
+	/**
+	 * @brief Log a message, unless already logged.
+	 * @param[in] iSeverity The message severity.
+	 * @param[in] iTypes The message types.
+	 * @param[in] iData The message.
+	 */
+	void report(VkDebugUtilsMessageSeverityFlagBitsEXT iSeverity, VkDebugUtilsMessageTypeFlagsEXT iTypes,
+				const VkDebugUtilsMessengerCallbackDataEXT& iData);
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// Object naming entry point.
+	PFN_vkSetDebugUtilsObjectNameEXT m_setObjectName = nullptr;
+	/// Label begin entry point.
+	PFN_vkCmdBeginDebugUtilsLabelEXT m_beginLabel = nullptr;
+	/// Label end entry point.
+	PFN_vkCmdEndDebugUtilsLabelEXT m_endLabel = nullptr;
+	/// The messenger.
+	VkDebugUtilsMessengerEXT m_messenger = VK_NULL_HANDLE;
+	/// Occurrences of each logged message, by hash.
+	std::unordered_map<size_t, uint64_t> m_occurrences;
+	/// Protect the occurrences (messages come from any thread).
+	std::mutex m_mutex;
+	/// Labels of the draw lists of the frame (callback data).
+	std::vector<std::pair<const DebugUtils*, const char*>> m_drawListLabels;
+};
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,157 @@
+/**
+ * @file DeletionQueue.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "pch.h"
+
+#include "DeletionQueue.h"
+
+#include "VulkanContext.h"
+
+#include <backends/imgui_impl_vulkan.h>
+
+namespace mvi::core::vulkan {
+
+DeletionQueue::DeletionQueue(const VulkanContext& iContext) : m_context{iContext} {}
+
+DeletionQueue::~DeletionQueue() { flush(); }
+
+void DeletionQueue::push(std::function<void()> iRelease) {
+	if (!iRelease)
+		return;
+	// Tagged with the frame being recorded: the previous ones may still use the objects.
+	const uint64_t frame = m_context.getFrameSerial();
+	const std::scoped_lock lock(m_mutex);
+	m_entries.push_back({.frame = frame, .release = std::move(iRelease)});
+}
+
+void DeletionQueue::destroyBuffer(VkBuffer iBuffer) {
+	if (iBuffer == VK_NULL_HANDLE)
+		return;
+	push([this, iBuffer]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroyBuffer(vkData.device, iBuffer, vkData.allocator);
+	});
+}
+
+void DeletionQueue::destroyImage(VkImage iImage) {
+	if (iImage == VK_NULL_HANDLE)
+		return;
+	push([this, iImage]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroyImage(vkData.device, iImage, vkData.allocator);
+	});
+}
+
+void DeletionQueue::destroyImageView(VkImageView iView) {
+	if (iView == VK_NULL_HANDLE)
+		return;
+	push([this, iView]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroyImageView(vkData.device, iView, vkData.allocator);
+	});
+}
+
+void DeletionQueue::freeMemory(VkDeviceMemory iMemory) {
+	if (iMemory == VK_NULL_HANDLE)
+		return;
+	push([this, iMemory]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkFreeMemory(vkData.device, iMemory, vkData.allocator);
+	});
+}
+
+void DeletionQueue::destroyFramebuffer(VkFramebuffer iFramebuffer) {
+	if (iFramebuffer == VK_NULL_HANDLE)
+		return;
+	push([this, iFramebuffer]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroyFramebuffer(vkData.device, iFramebuffer, vkData.allocator);
+	});
+}
+
+void DeletionQueue::destroySampler(VkSampler iSampler) {
+	if (iSampler == VK_NULL_HANDLE)
+		return;
+	push([this, iSampler]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroySampler(vkData.device, iSampler, vkData.allocator);
+	});
+}
+
+void DeletionQueue::destroyPipeline(VkPipeline iPipeline) {
+	if (iPipeline == VK_NULL_HANDLE)
+		return;
+	push([this, iPipeline]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroyPipeline(vkData.device, iPipeline, vkData.allocator);
+	});
+}
+
+void DeletionQueue::destroyPipelineLayout(VkPipelineLayout iLayout) {
+	if (iLayout == VK_NULL_HANDLE)
+		return;
+	push([this, iLayout]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroyPipelineLayout(vkData.device, iLayout, vkData.allocator);
+	});
+}
+
+void DeletionQueue::destroyDescriptorSetLayout(VkDescriptorSetLayout iLayout) {
+	if (iLayout == VK_NULL_HANDLE)
+		return;
+	push([this, iLayout]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroyDescriptorSetLayout(vkData.device, iLayout, vkData.allocator);
+	});
+}
+
+void DeletionQueue::destroyRenderPass(VkRenderPass iRenderPass) {
+	if (iRenderPass == VK_NULL_HANDLE)
+		return;
+	push([this, iRenderPass]() -> void {
+		const auto& vkData = m_context.getVkData();
+		vkDestroyRenderPass(vkData.device, iRenderPass, vkData.allocator);
+	});
+}
+
+void DeletionQueue::removeTexture(VkDescriptorSet iDescriptorSet) {
+	if (iDescriptorSet == VK_NULL_HANDLE)
+		return;
+	push([iDescriptorSet]() -> void { ImGui_ImplVulkan_RemoveTexture(iDescriptorSet); });
+}
+
+void DeletionQueue::collect(const uint64_t iCompletedFrame) {
+	std::vector<std::function<void()>> ready;
+	{
+		const std::scoped_lock lock(m_mutex);
+		while (!m_entries.empty() && m_entries.front().frame <= iCompletedFrame) {
+			ready.push_back(std::move(m_entries.front().release));
+			m_entries.pop_front();
+		}
+		m_released += ready.size();
+	}
+	// Outside the lock: a release function may release other objects.
+	for (const auto& release: ready) release();
+}
+
+void DeletionQueue::flush() {
+	std::deque<Entry> entries;
+	{
+		const std::scoped_lock lock(m_mutex);
+		entries.swap(m_entries);
+		m_released += entries.size();
+	}
+	for (const auto& entry: entries) entry.release();
+}
+
+auto DeletionQueue::getStats() const -> Stats {
+	const std::scoped_lock lock(m_mutex);
+	return {.pending = m_entries.size(), .released = m_released};
+}
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,152 @@
+/**
+ * @file DeletionQueue.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "vkData.h"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Vulkan objects waiting for the GPU to finish with them.
+ *
+ * Each object is tagged with the frame being recorded when it is released, the last one that may
+ * use it, and destroyed once the context reports that frame as completed. Releasing resources
+ * mid-session thus never stalls the pipeline. Thread-safe.
+ */
+class DeletionQueue final {
+public:
+	/**
+	 * @brief Queue statistics.
+	 */
+	struct Stats {
+		/// Objects waiting.
+		uint64_t pending = 0;
+		/// Objects destroyed.
+		uint64_t released = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iContext The Vulkan context.
+	 */
+	explicit DeletionQueue(const VulkanContext& iContext);
+	/**
+	 * @brief Destructor: destroy everything (the device must be idle).
+	 */
+	~DeletionQueue();
+
+	DeletionQueue(const DeletionQueue&) = delete;
+	DeletionQueue(DeletionQueue&&) = delete;
+	auto operator=(const DeletionQueue&) -> DeletionQueue& = delete;
+	auto operator=(DeletionQueue&&) -> DeletionQueue& = delete;
+
+	/**
+	 * @brief Defer a release function.
+	 * @param[in] iRelease The function destroying the objects.
+	 */
+	void push(std::function<void()> iRelease);
+	/**
+	 * @brief Defer the destruction of a buffer.
+	 * @param[in] iBuffer The buffer.
+	 */
+	void destroyBuffer(VkBuffer iBuffer);
+	/**
+	 * @brief Defer the destruction of an image.
+	 * @param[in] iImage The image.
+	 */
+	void destroyImage(VkImage iImage);
+	/**
+	 * @brief Defer the destruction of an image view.
+	 * @param[in] iView The image view.
+	 */
+	void destroyImageView(VkImageView iView);
+	/**
+	 * @brief Defer the release of device memory.
+	 * @param[in] iMemory The memory.
+	 */
+	void freeMemory(VkDeviceMemory iMemory);
+	/**
+	 * @brief Defer the destruction of a framebuffer.
+	 * @param[in] iFramebuffer The framebuffer.
+	 */
+	void destroyFramebuffer(VkFramebuffer iFramebuffer);
+	/**
+	 * @brief Defer the destruction of a sampler.
+	 * @param[in] iSampler The sampler.
+	 */
+	void destroySampler(VkSampler iSampler);
+	/**
+	 * @brief Defer the destruction of a pipeline.
+	 * @param[in] iPipeline The pipeline.
+	 */
+	void destroyPipeline(VkPipeline iPipeline);
+	/**
+	 * @brief Defer the destruction of a pipeline layout.
+	 * @param[in] iLayout The pipeline layout.
+	 */
+	void destroyPipelineLayout(VkPipelineLayout iLayout);
+	/**
+	 * @brief Defer the destruction of a descriptor set layout.
+	 * @param[in] iLayout The descriptor set layout.
+	 */
+	void destroyDescriptorSetLayout(VkDescriptorSetLayout iLayout);
+	/**
+	 * @brief Defer the destruction of a render pass.
+	 * @param[in] iRenderPass The render pass.
+	 */
+	void destroyRenderPass(VkRenderPass iRenderPass);
+	/**
+	 * @brief Defer the removal of an ImGui texture.
+	 * @param[in] iDescriptorSet The texture descriptor set.
+	 */
+	void removeTexture(VkDescriptorSet iDescriptorSet);
+
+	/**
+	 * @brief Destroy the objects released up to a completed frame.
+	 * @param[in] iCompletedFrame The last frame completed by the GPU.
+	 */
+	void collect(uint64_t iCompletedFrame);
+	/**
+	 * @brief Destroy everything (the device must be idle).
+	 */
+	void flush();
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> Stats;
+
+private:
+	/**
+	 * @brief Deferred release.
+	 */
+	struct Entry {
+		/// Last frame that may use the objects.
+		uint64_t frame = 0;
+		/// The release function.
+		std::function<void()> release;
+	};
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// Entries, by increasing frame.
+	std::deque<Entry> m_entries;
+	/// Protect the entries and the statistics.
+	mutable std::mutex m_mutex;
+	/// Objects destroyed.
+	uint64_t m_released = 0;
+};
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,332 @@
+/**
+ * @file DrawListTexture.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "DrawListTexture.h"
+
+#include "Shader.h"
+#include "VulkanContext.h"
+
+#include <cstring>
+
+namespace mvi::core::vulkan {
+
+namespace {
+
+/// Vertex shader, identical to the ImGui backend one.
+constexpr std::string_view g_vertexShader = R"(#version 450 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in vec2 aUV;
+layout(location = 2) in vec4 aColor;
+layout(push_constant) uniform uPushConstant { vec2 uScale; vec2 uTranslate; } pc;
+out gl_PerVertex { vec4 gl_Position; };
+layout(location = 0) out struct { vec4 Color; vec2 UV; } Out;
+void main() {
+	Out.Color = aColor;
+	Out.UV = aUV;
+	gl_Position = vec4(aPos * pc.uScale + pc.uTranslate, 0, 1);
+}
+)";
+
+/// Fragment shader, identical to the ImGui backend one.
+constexpr std::string_view g_fragmentShader = R"(#version 450 core
+layout(location = 0) out vec4 fColor;
+layout(set = 0, binding = 0) uniform sampler2D sTexture;
+layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
+void main() {
+	fColor = In.Color * texture(sTexture, In.UV.st);
+}
+)";
+
+}// namespace
+
+DrawListTexture::DrawListTexture(VulkanContext& ioContext) : m_context{ioContext} {
+	m_target = std::make_unique<RenderTarget>(m_context, RenderTarget::Config{.colorFormat = VK_FORMAT_R8G8B8A8_UNORM,
+																			  .depthFormat = VK_FORMAT_UNDEFINED,
+																			  .ringSize = 2,
+																			  .settleFrames = 0,
+																			  .retained = true});
+	m_target->setRecorder(
+			[this](VkCommandBuffer iCommandBuffer, const RenderTarget&) -> void { record(iCommandBuffer); });
+	createPipeline();
+}
+
+DrawListTexture::~DrawListTexture() {
+	m_target.reset();
+	releaseBuffer();
+	auto& deletion = m_context.getDeletionQueue();
+	deletion.destroyPipeline(m_pipeline);
+	deletion.destroyPipelineLayout(m_pipelineLayout);
+	deletion.destroyDescriptorSetLayout(m_descriptorSetLayout);
+}
+
+auto DrawListTexture::mark(const ImDrawList& iDrawList) -> Mark {
+	return {.vertex = iDrawList.VtxBuffer.Size, .index = iDrawList.IdxBuffer.Size};
+}
+
+auto DrawListTexture::capture(const ImDrawList& iDrawList, const Mark& iBegin, const ImVec2& iMin, const ImVec2& iMax,
+							  const ImVec4& iBackground) -> bool {
+	const ImVec2 size = {iMax.x - iMin.x, iMax.y - iMin.y};
+	if (!isAvailable() || size.x < 1.f || size.y < 1.f)
+		return false;
+
+	// Commands overlapping the captured indices; the first and last ones may be shared with the rest of the list.
+	const auto indexBegin = static_cast<uint32_t>(iBegin.index);
+	const auto indexEnd = static_cast<uint32_t>(iDrawList.IdxBuffer.Size);
+	m_commands.clear();
+	for (const ImDrawCmd& cmd: iDrawList.CmdBuffer) {
+		if (cmd.UserCallback != nullptr)
+			continue;
+		const uint32_t first = std::max(cmd.IdxOffset, indexBegin);
+		const uint32_t last = std::min(cmd.IdxOffset + cmd.ElemCount, indexEnd);
+		if (first >= last)
+			continue;
+		m_commands.push_back({.clipRect = cmd.ClipRect,
+							  .texture = cmd.TexRef,
+							  .firstIndex = first - indexBegin,
+							  .indexCount = last - first,
+							  .vertexOffset = static_cast<int32_t>(cmd.VtxOffset) - iBegin.vertex});
+	}
+
+	// Geometry: the vertices and the indices added since the mark.
+	const auto vertexBytes =
+			static_cast<VkDeviceSize>(iDrawList.VtxBuffer.Size - iBegin.vertex) * sizeof(ImDrawVert);
+	const auto indexBytes = static_cast<VkDeviceSize>(indexEnd - indexBegin) * sizeof(ImDrawIdx);
+	m_indexOffset = (vertexBytes + 3u) & ~VkDeviceSize{3u};
+	if (!m_commands.empty()) {
+		reserve(m_indexOffset + indexBytes);
+		auto* data = static_cast<uint8_t*>(m_buffer.mapped);
+		std::memcpy(data, iDrawList.VtxBuffer.Data + iBegin.vertex, vertexBytes);
+		std::memcpy(data + m_indexOffset, iDrawList.IdxBuffer.Data + iBegin.index, indexBytes);
+		m_buffer.frame = m_context.getFrameSerial();
+	}
+
+	m_origin = iMin;
+	m_size = size;
+	m_target->setClearColor({iBackground.x, iBackground.y, iBackground.z, 1.f});
+	return m_target->prepare(size);
+}
+
+void DrawListTexture::draw(ImDrawList* ioDrawList, const ImVec2& iMin) const {
+	m_target->addImage(ioDrawList, iMin, {iMin.x + m_size.x, iMin.y + m_size.y});
+}
+
+auto DrawListTexture::getMemorySize() const -> VkDeviceSize { return m_target->getMemorySize() + m_buffer.size; }
+
+void DrawListTexture::record(VkCommandBuffer iCommandBuffer) const {
+	if (m_commands.empty() || m_buffer.buffer == VK_NULL_HANDLE)
+		return;
+	const VkExtent2D extent = m_target->getExtent();
+	vkCmdBindPipeline(iCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline);
+	constexpr VkDeviceSize vertex_offset = 0;
+	vkCmdBindVertexBuffers(iCommandBuffer, 0, 1, &m_buffer.buffer, &vertex_offset);
+	vkCmdBindIndexBuffer(iCommandBuffer, m_buffer.buffer, m_indexOffset,
+						 sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+	// Same projection as the ImGui backend, the captured area covering the whole target.
+	const std::array scale = {2.f / m_size.x, 2.f / m_size.y};
+	const std::array<float, 4> push_constants = {scale[0], scale[1], -1.f - m_origin.x * scale[0],
+												 -1.f - m_origin.y * scale[1]};
+	vkCmdPushConstants(iCommandBuffer, m_pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push_constants),
+					   push_constants.data());
+	const ImVec2 pixels = {static_cast<float>(extent.width) / m_size.x, static_cast<float>(extent.height) / m_size.y};
+	for (const auto& command: m_commands) {
+		const ImTextureID texture = command.texture.GetTexID();
+		if (texture == ImTextureID{})
+			continue;
+		const auto width = static_cast<float>(extent.width);
+		const auto height = static_cast<float>(extent.height);
+		const ImVec2 clipMin = {std::max((command.clipRect.x - m_origin.x) * pixels.x, 0.f),
+								std::max((command.clipRect.y - m_origin.y) * pixels.y, 0.f)};
+		const ImVec2 clipMax = {std::min((command.clipRect.z - m_origin.x) * pixels.x, width),
+								std::min((command.clipRect.w - m_origin.y) * pixels.y, height)};
+		if (clipMax.x <= clipMin.x || clipMax.y <= clipMin.y)
+			continue;
+		const VkRect2D scissor = {
+				.offset = {.x = static_cast<int32_t>(clipMin.x), .y = static_cast<int32_t>(clipMin.y)},
+				.extent = {.width = static_cast<uint32_t>(clipMax.x - clipMin.x),
+						   .height = static_cast<uint32_t>(clipMax.y - clipMin.y)}};
+		vkCmdSetScissor(iCommandBuffer, 0, 1, &scissor);
+		auto* descriptor_set = reinterpret_cast<VkDescriptorSet>(texture);
+		vkCmdBindDescriptorSets(iCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelineLayout, 0, 1,
+								&descriptor_set, 0, nullptr);
+		vkCmdDrawIndexed(iCommandBuffer, command.indexCount, 1, command.firstIndex, command.vertexOffset, 0);
+	}
+}
+
+void DrawListTexture::reserve(const VkDeviceSize iSize) {
+	// The buffer of the previous capture is reused once its frame is done.
+	if (m_buffer.size >= iSize && m_context.getCompletedFrame() >= m_buffer.frame)
+		return;
+	releaseBuffer();
+	const auto& vkData = m_context.getVkData();
+	m_buffer.size = std::max<VkDeviceSize>(iSize + iSize / 2, 64 * 1024);
+	VkBufferCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	info.size = m_buffer.size;
+	info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	VkResult err = vkCreateBuffer(vkData.device, &info, vkData.allocator, &m_buffer.buffer);
+	VulkanContext::checkVkResult(err);
+	VkMemoryRequirements requirements;
+	vkGetBufferMemoryRequirements(vkData.device, m_buffer.buffer, &requirements);
+	VkMemoryAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.allocationSize = requirements.size;
+	alloc_info.memoryTypeIndex = m_context.findMemoryType(
+			requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+	err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &m_buffer.memory);
+	VulkanContext::checkVkResult(err);
+	err = vkBindBufferMemory(vkData.device, m_buffer.buffer, m_buffer.memory, 0);
+	VulkanContext::checkVkResult(err);
+	err = vkMapMemory(vkData.device, m_buffer.memory, 0, m_buffer.size, 0, &m_buffer.mapped);
+	VulkanContext::checkVkResult(err);
+	m_context.getDebugUtils().setName(VK_OBJECT_TYPE_BUFFER, m_buffer.buffer, "retained view geometry");
+}
+
+void DrawListTexture::releaseBuffer() {
+	// Freeing the memory also unmaps it.
+	auto& deletion = m_context.getDeletionQueue();
+	deletion.destroyBuffer(m_buffer.buffer);
+	deletion.freeMemory(m_buffer.memory);
+	m_buffer = {};
+}
+
+void DrawListTexture::createPipeline() {
+	const auto& vkData = m_context.getVkData();
+	VkResult err = VK_SUCCESS;
+
+	// Layouts, compatible with the ImGui backend ones
+	{
+		VkDescriptorSetLayoutBinding binding = {};
+		binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		binding.descriptorCount = 1;
+		binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+		VkDescriptorSetLayoutCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		info.bindingCount = 1;
+		info.pBindings = &binding;
+		err = vkCreateDescriptorSetLayout(vkData.device, &info, vkData.allocator, &m_descriptorSetLayout);
+		VulkanContext::checkVkResult(err);
+
+		VkPushConstantRange push_constants = {};
+		push_constants.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+		push_constants.offset = 0;
+		push_constants.size = sizeof(float) * 4;
+		VkPipelineLayoutCreateInfo layout_info = {};
+		layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		layout_info.setLayoutCount = 1;
+		layout_info.pSetLayouts = &m_descriptorSetLayout;
+		layout_info.pushConstantRangeCount = 1;
+		layout_info.pPushConstantRanges = &push_constants;
+		err = vkCreatePipelineLayout(vkData.device, &layout_info, vkData.allocator, &m_pipelineLayout);
+		VulkanContext::checkVkResult(err);
+	}
+
+	const auto vertexCode = compileShader(g_vertexShader, ShaderStage::Vertex, "drawlist.vert");
+	const auto fragmentCode = compileShader(g_fragmentShader, ShaderStage::Fragment, "drawlist.frag");
+	VkShaderModule vertexModule = createShaderModule(vkData, vertexCode);
+	VkShaderModule fragmentModule = createShaderModule(vkData, fragmentCode);
+	if (vertexModule == VK_NULL_HANDLE || fragmentModule == VK_NULL_HANDLE) {
+		vkDestroyShaderModule(vkData.device, vertexModule, vkData.allocator);
+		vkDestroyShaderModule(vkData.device, fragmentModule, vkData.allocator);
+		return;
+	}
+	std::array<VkPipelineShaderStageCreateInfo, 2> stages = {};
+	stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	stages[0].module = vertexModule;
+	stages[0].pName = "main";
+	stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	stages[1].module = fragmentModule;
+	stages[1].pName = "main";
+
+	VkVertexInputBindingDescription binding_desc = {};
+	binding_desc.stride = sizeof(ImDrawVert);
+	binding_desc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+	std::array<VkVertexInputAttributeDescription, 3> attribute_desc = {};
+	attribute_desc[0] = {.location = 0,
+						 .binding = 0,
+						 .format = VK_FORMAT_R32G32_SFLOAT,
+						 .offset = static_cast<uint32_t>(offsetof(ImDrawVert, pos))};
+	attribute_desc[1] = {.location = 1,
+						 .binding = 0,
+						 .format = VK_FORMAT_R32G32_SFLOAT,
+						 .offset = static_cast<uint32_t>(offsetof(ImDrawVert, uv))};
+	attribute_desc[2] = {.location = 2,
+						 .binding = 0,
+						 .format = VK_FORMAT_R8G8B8A8_UNORM,
+						 .offset = static_cast<uint32_t>(offsetof(ImDrawVert, col))};
+	VkPipelineVertexInputStateCreateInfo vertex_info = {};
+	vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+	vertex_info.vertexBindingDescriptionCount = 1;
+	vertex_info.pVertexBindingDescriptions = &binding_desc;
+	vertex_info.vertexAttributeDescriptionCount = static_cast<uint32_t>(attribute_desc.size());
+	vertex_info.pVertexAttributeDescriptions = attribute_desc.data();
+
+	VkPipelineInputAssemblyStateCreateInfo ia_info = {};
+	ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	ia_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+	VkPipelineViewportStateCreateInfo viewport_info = {};
+	viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	viewport_info.viewportCount = 1;
+	viewport_info.scissorCount = 1;
+	VkPipelineRasterizationStateCreateInfo raster_info = {};
+	raster_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	raster_info.polygonMode = VK_POLYGON_MODE_FILL;
+	raster_info.cullMode = VK_CULL_MODE_NONE;
+	raster_info.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	raster_info.lineWidth = 1.0f;
+	VkPipelineMultisampleStateCreateInfo ms_info = {};
+	ms_info.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	ms_info.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+	// The background is opaque: the alpha stays at one and the texture is drawn as is.
+	VkPipelineColorBlendAttachmentState color_attachment = {};
+	color_attachment.blendEnable = VK_TRUE;
+	color_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+	color_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+	color_attachment.colorBlendOp = VK_BLEND_OP_ADD;
+	color_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+	color_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+	color_attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+	color_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT |
+									  VK_COLOR_COMPONENT_A_BIT;
+	VkPipelineDepthStencilStateCreateInfo depth_info = {};
+	depth_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+	VkPipelineColorBlendStateCreateInfo blend_info = {};
+	blend_info.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	blend_info.attachmentCount = 1;
+	blend_info.pAttachments = &color_attachment;
+	constexpr std::array dynamic_states = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+	VkPipelineDynamicStateCreateInfo dynamic_state = {};
+	dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+	dynamic_state.dynamicStateCount = static_cast<uint32_t>(dynamic_states.size());
+	dynamic_state.pDynamicStates = dynamic_states.data();
+
+	VkGraphicsPipelineCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	info.stageCount = static_cast<uint32_t>(stages.size());
+	info.pStages = stages.data();
+	info.pVertexInputState = &vertex_info;
+	info.pInputAssemblyState = &ia_info;
+	info.pViewportState = &viewport_info;
+	info.pRasterizationState = &raster_info;
+	info.pMultisampleState = &ms_info;
+	info.pDepthStencilState = &depth_info;
+	info.pColorBlendState = &blend_info;
+	info.pDynamicState = &dynamic_state;
+	info.layout = m_pipelineLayout;
+	info.renderPass = m_target->getRenderPass();
+	info.subpass = 0;
+	err = vkCreateGraphicsPipelines(vkData.device, vkData.pipelineCache, 1, &info, vkData.allocator, &m_pipeline);
+	VulkanContext::checkVkResult(err);
+	vkDestroyShaderModule(vkData.device, vertexModule, vkData.allocator);
+	vkDestroyShaderModule(vkData.device, fragmentModule, vkData.allocator);
+}
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,164 @@
+/**
+ * @file DrawListTexture.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "RenderTarget.h"
+#include "vkData.h"
+
+#include <imgui.h>
+#include <memory>
+#include <vector>
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Texture holding the rendering of a part of an ImGui draw list.
+ *
+ * The commands added to a draw list between a mark and the capture are copied and rendered once into
+ * an offscreen target, with a pipeline equivalent to the ImGui backend one, over an opaque background.
+ * The texture is then drawn in place of these commands in the next frames, until the next capture.
+ * User callbacks in the captured range are skipped.
+ */
+class DrawListTexture final {
+public:
+	/**
+	 * @brief Position in a draw list.
+	 */
+	struct Mark {
+		/// Vertex count.
+		int vertex = 0;
+		/// Index count.
+		int index = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in,out] ioContext The Vulkan context.
+	 */
+	explicit DrawListTexture(VulkanContext& ioContext);
+	/**
+	 * @brief Destructor.
+	 */
+	~DrawListTexture();
+
+	DrawListTexture(const DrawListTexture&) = delete;
+	DrawListTexture(DrawListTexture&&) = delete;
+	auto operator=(const DrawListTexture&) -> DrawListTexture& = delete;
+	auto operator=(DrawListTexture&&) -> DrawListTexture& = delete;
+
+	/**
+	 * @brief Check if captures can be rendered.
+	 * @return True if the pipeline exists.
+	 */
+	[[nodiscard]] auto isAvailable() const -> bool { return m_pipeline != VK_NULL_HANDLE; }
+	/**
+	 * @brief Get the current end of a draw list.
+	 * @param[in] iDrawList The draw list.
+	 * @return The mark.
+	 */
+	[[nodiscard]] static auto mark(const ImDrawList& iDrawList) -> Mark;
+	/**
+	 * @brief Copy the commands added since a mark and render them into the texture in this frame.
+	 * @param[in] iDrawList The draw list.
+	 * @param[in] iBegin The mark taken before the commands.
+	 * @param[in] iMin Top left corner of the captured area, in screen coordinates.
+	 * @param[in] iMax Bottom right corner of the captured area, in screen coordinates.
+	 * @param[in] iBackground The background color.
+	 * @return True if the capture will be rendered.
+	 */
+	auto capture(const ImDrawList& iDrawList, const Mark& iBegin, const ImVec2& iMin, const ImVec2& iMax,
+				 const ImVec4& iBackground) -> bool;
+	/**
+	 * @brief Draw the last capture.
+	 * @param[in,out] ioDrawList The draw list.
+	 * @param[in] iMin Top left corner, in screen coordinates.
+	 */
+	void draw(ImDrawList* ioDrawList, const ImVec2& iMin) const;
+	/**
+	 * @brief Get the memory held by the texture and the geometry.
+	 * @return The memory size in bytes.
+	 */
+	[[nodiscard]] auto getMemorySize() const -> VkDeviceSize;
+
+private:
+	/**
+	 * @brief Captured draw command.
+	 */
+	struct Command {
+		/// Clip rectangle, in screen coordinates.
+		ImVec4 clipRect;
+		/// Texture.
+		ImTextureRef texture;
+		/// First index.
+		uint32_t firstIndex = 0;
+		/// Number of indices.
+		uint32_t indexCount = 0;
+		/// Offset added to the indices.
+		int32_t vertexOffset = 0;
+	};
+	/**
+	 * @brief Host-visible vertex and index buffer.
+	 */
+	struct Buffer {
+		/// The buffer.
+		VkBuffer buffer = VK_NULL_HANDLE;
+		/// Buffer memory.
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		/// Persistent mapping.
+		void* mapped = nullptr;
+		/// Buffer size.
+		VkDeviceSize size = 0;
+		/// Last frame using the buffer.
+		uint64_t frame = 0;
+	};
+
+	/**
+	 * @brief Create the pipeline.
+	 */
+	void createPipeline();
+	/**
+	 * @brief Record the captured commands.
+	 * @param[in] iCommandBuffer The command buffer.
+	 */
+	void record(VkCommandBuffer iCommandBuffer) const;
+	/**
+	 * @brief Get a buffer able to hold the geometry, not used by the GPU anymore.
+	 * @param[in] iSize The needed size.
+	 */
+	void reserve(VkDeviceSize iSize);
+	/**
+	 * @brief Release the buffer once the GPU is done with it.
+	 */
+	void releaseBuffer();
+
+	/// The Vulkan context.
+	VulkanContext& m_context;
+	/// The offscreen target.
+	std::unique_ptr<RenderTarget> m_target;
+	/// Descriptor set layout, compatible with the ImGui backend textures.
+	VkDescriptorSetLayout m_descriptorSetLayout = VK_NULL_HANDLE;
+	/// Pipeline layout.
+	VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+	/// Pipeline.
+	VkPipeline m_pipeline = VK_NULL_HANDLE;
+	/// Geometry buffer.
+	Buffer m_buffer;
+	/// Captured commands.
+	std::vector<Command> m_commands;
+	/// Offset of the indices in the buffer.
+	VkDeviceSize m_indexOffset = 0;
+	/// Captured area top left corner, in screen coordinates.
+	ImVec2 m_origin;
+	/// Captured area size.
+	ImVec2 m_size;
+};
+
+}// namespace mvi::core::vulkan
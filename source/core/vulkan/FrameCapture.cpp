@@ -0,0 +1,388 @@
+/**
+ * @file FrameCapture.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "FrameCapture.h"
+
+#include "VulkanContext.h"
+#include "core/Log.h"
+
+namespace mvi::core::vulkan {
+
+namespace {
+
+/// Bytes per captured pixel.
+constexpr VkDeviceSize g_pixelSize = 4;
+
+auto isBgra(const VkFormat iFormat) -> bool {
+	return iFormat == VK_FORMAT_B8G8R8A8_UNORM || iFormat == VK_FORMAT_B8G8R8A8_SRGB;
+}
+
+auto isSupported(const VkFormat iFormat) -> bool {
+	return isBgra(iFormat) || iFormat == VK_FORMAT_R8G8B8A8_UNORM || iFormat == VK_FORMAT_R8G8B8A8_SRGB;
+}
+
+auto elapsedMs(const std::chrono::steady_clock::time_point& iStart) -> double {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - iStart).count();
+}
+
+/// Last timestamp given to a capture.
+std::string g_lastTimestamp;
+/// Captures named in the same millisecond as the last one.
+uint32_t g_timestampRepeat = 0;
+
+/**
+ * @brief Get a timestamp naming a capture, unique among the captures (called by the encoder thread only).
+ * @return The timestamp, with milliseconds.
+ */
+auto timestamp() -> std::string {
+	const auto now = std::chrono::floor<std::chrono::milliseconds>(std::chrono::system_clock::now());
+	const auto seconds = std::chrono::floor<std::chrono::seconds>(now);
+	auto stamp = std::format("{:%Y%m%d_%H%M%S}_{:03}", seconds, (now - seconds).count());
+	if (stamp == g_lastTimestamp)
+		return std::format("{}_{}", stamp, ++g_timestampRepeat);
+	g_lastTimestamp = stamp;
+	g_timestampRepeat = 0;
+	return stamp;
+}
+
+}// namespace
+
+FrameCapture::FrameCapture(const VulkanContext& iContext, Config iConfig)
+	: m_context{iContext}, m_config{std::move(iConfig)} {
+	const auto& vkData = m_context.getVkData();
+	m_config.ringSize = std::max(m_config.ringSize, 2u);
+	m_config.queueSize = std::max(m_config.queueSize, 1u);
+
+	VkCommandPoolCreateInfo pool_info = {};
+	pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+	pool_info.queueFamilyIndex = vkData.queueFamily;
+	VkResult err = vkCreateCommandPool(vkData.device, &pool_info, vkData.allocator, &m_commandPool);
+	VulkanContext::checkVkResult(err);
+
+	m_slots.resize(m_config.ringSize);
+	for (size_t index = 0; index < m_slots.size(); ++index) {
+		auto& slot = m_slots[index];
+		VkCommandBufferAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		alloc_info.commandPool = m_commandPool;
+		alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		alloc_info.commandBufferCount = 1;
+		err = vkAllocateCommandBuffers(vkData.device, &alloc_info, &slot.commandBuffer);
+		VulkanContext::checkVkResult(err);
+		VkFenceCreateInfo fence_info = {};
+		fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		err = vkCreateFence(vkData.device, &fence_info, vkData.allocator, &slot.fence);
+		VulkanContext::checkVkResult(err);
+		m_freeSlots.push_back(index);
+	}
+	m_encoder = std::thread([this] { encoderLoop(); });
+}
+
+FrameCapture::~FrameCapture() {
+	collect(true);
+	{
+		std::lock_guard lock(m_mutex);
+		if (m_closeRequested)
+			m_jobs.push_back({.image = {}, .target = Target::Recording, .session = m_session});
+		m_stop = true;
+	}
+	m_condition.notify_all();
+	if (m_encoder.joinable())
+		m_encoder.join();
+
+	const auto& vkData = m_context.getVkData();
+	for (auto& slot: m_slots) {
+		releaseBuffer(slot);
+		vkDestroyFence(vkData.device, slot.fence, vkData.allocator);
+	}
+	vkDestroyCommandPool(vkData.device, m_commandPool, vkData.allocator);
+}
+
+void FrameCapture::startRecording() {
+	if (m_recording)
+		return;
+	++m_session;
+	m_recording = true;
+	m_closeRequested = false;
+	log_info("Frame recording started.");
+}
+
+void FrameCapture::stopRecording() {
+	if (!m_recording)
+		return;
+	m_recording = false;
+	m_closeRequested = true;
+	log_info("Frame recording stopped.");
+}
+
+auto FrameCapture::prepare() -> bool {
+	collect(false);
+	if (m_closeRequested && m_pendingSlots.empty()) {
+		// Every frame of the session is queued: the marker closes the stream.
+		std::lock_guard lock(m_mutex);
+		m_jobs.push_back({.image = {}, .target = Target::Recording, .session = m_session});
+		m_closeRequested = false;
+		m_condition.notify_one();
+	}
+	if (!m_screenshotRequested && !m_recording)
+		return false;
+	if (m_freeSlots.empty()) {
+		std::lock_guard lock(m_mutex);
+		++m_stats.dropped;
+		return false;
+	}
+	m_reserved = m_freeSlots.back();
+	m_freeSlots.pop_back();
+	m_reservedTarget = m_screenshotRequested ? Target::Screenshot : Target::Recording;
+	m_screenshotRequested = false;
+	return true;
+}
+
+void FrameCapture::record(VkImage iImage, const VkImageLayout iLayout, const VkFormat iFormat,
+						  const VkExtent2D iExtent, VkSemaphore iSignal) {
+	const auto start = std::chrono::steady_clock::now();
+	const auto& vkData = m_context.getVkData();
+	auto& slot = m_slots[m_reserved];
+	VkSubmitInfo submit_info = {};
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.signalSemaphoreCount = iSignal == VK_NULL_HANDLE ? 0 : 1;
+	submit_info.pSignalSemaphores = &iSignal;
+	if (!isSupported(iFormat)) {
+		// Still signal the semaphore the presentation waits for.
+		log_warning("Frame capture: unsupported image format {}.", magic_enum::enum_name(iFormat));
+		const VkResult err = vkQueueSubmit(vkData.queue, 1, &submit_info, VK_NULL_HANDLE);
+		VulkanContext::checkVkResult(err);
+		m_freeSlots.push_back(m_reserved);
+		std::lock_guard lock(m_mutex);
+		++m_stats.dropped;
+		return;
+	}
+	ensureCapacity(slot, static_cast<VkDeviceSize>(iExtent.width) * iExtent.height * g_pixelSize);
+	slot.width = iExtent.width;
+	slot.height = iExtent.height;
+	slot.bgra = isBgra(iFormat);
+	slot.target = m_reservedTarget;
+	slot.session = m_session;
+
+	VkResult err = vkResetCommandBuffer(slot.commandBuffer, 0);
+	VulkanContext::checkVkResult(err);
+	VkCommandBufferBeginInfo begin_info = {};
+	begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	err = vkBeginCommandBuffer(slot.commandBuffer, &begin_info);
+	VulkanContext::checkVkResult(err);
+	{
+		// The barrier scope covers the rendering submitted before on this queue.
+		VkImageMemoryBarrier barrier = {};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		barrier.oldLayout = iLayout;
+		barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = iImage;
+		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		barrier.subresourceRange.levelCount = 1;
+		barrier.subresourceRange.layerCount = 1;
+		vkCmdPipelineBarrier(slot.commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+							 VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+		VkBufferImageCopy region = {};
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.layerCount = 1;
+		region.imageExtent = {.width = iExtent.width, .height = iExtent.height, .depth = 1};
+		vkCmdCopyImageToBuffer(slot.commandBuffer, iImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.buffer, 1,
+							   &region);
+
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		barrier.dstAccessMask = 0;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		barrier.newLayout = iLayout;
+		VkBufferMemoryBarrier buffer_barrier = {};
+		buffer_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		buffer_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		buffer_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+		buffer_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		buffer_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		buffer_barrier.buffer = slot.buffer;
+		buffer_barrier.size = VK_WHOLE_SIZE;
+		vkCmdPipelineBarrier(slot.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+							 VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT | VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1,
+							 &buffer_barrier, 1, &barrier);
+	}
+	err = vkEndCommandBuffer(slot.commandBuffer);
+	VulkanContext::checkVkResult(err);
+
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &slot.commandBuffer;
+	err = vkQueueSubmit(vkData.queue, 1, &submit_info, slot.fence);
+	VulkanContext::checkVkResult(err);
+	m_pendingSlots.push_back(m_reserved);
+
+	std::lock_guard lock(m_mutex);
+	++m_stats.captured;
+	m_stats.recordMs += elapsedMs(start);
+}
+
+auto FrameCapture::getStats() const -> Stats {
+	std::lock_guard lock(m_mutex);
+	return m_stats;
+}
+
+void FrameCapture::ensureCapacity(Slot& ioSlot, const VkDeviceSize iSize) {
+	if (ioSlot.size >= iSize)
+		return;
+	releaseBuffer(ioSlot);
+	const auto& vkData = m_context.getVkData();
+	VkBufferCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	info.size = iSize;
+	info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	VkResult err = vkCreateBuffer(vkData.device, &info, vkData.allocator, &ioSlot.buffer);
+	VulkanContext::checkVkResult(err);
+	VkMemoryRequirements requirements;
+	vkGetBufferMemoryRequirements(vkData.device, ioSlot.buffer, &requirements);
+	VkMemoryAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.allocationSize = requirements.size;
+	// Cached memory makes the CPU reads much faster when available.
+	alloc_info.memoryTypeIndex =
+			m_context.findMemoryType(requirements.memoryTypeBits,
+									 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+									 VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+	err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &ioSlot.memory);
+	VulkanContext::checkVkResult(err);
+	err = vkBindBufferMemory(vkData.device, ioSlot.buffer, ioSlot.memory, 0);
+	VulkanContext::checkVkResult(err);
+	err = vkMapMemory(vkData.device, ioSlot.memory, 0, VK_WHOLE_SIZE, 0, &ioSlot.mapped);
+	VulkanContext::checkVkResult(err);
+	ioSlot.size = iSize;
+	std::lock_guard lock(m_mutex);
+	m_stats.bufferBytes += requirements.size;
+}
+
+void FrameCapture::releaseBuffer(Slot& ioSlot) {
+	if (ioSlot.buffer == VK_NULL_HANDLE)
+		return;
+	const auto& vkData = m_context.getVkData();
+	VkMemoryRequirements requirements;
+	vkGetBufferMemoryRequirements(vkData.device, ioSlot.buffer, &requirements);
+	vkUnmapMemory(vkData.device, ioSlot.memory);
+	vkDestroyBuffer(vkData.device, ioSlot.buffer, vkData.allocator);
+	vkFreeMemory(vkData.device, ioSlot.memory, vkData.allocator);
+	ioSlot = {.buffer = VK_NULL_HANDLE,
+			  .memory = VK_NULL_HANDLE,
+			  .mapped = nullptr,
+			  .size = 0,
+			  .commandBuffer = ioSlot.commandBuffer,
+			  .fence = ioSlot.fence};
+	std::lock_guard lock(m_mutex);
+	m_stats.bufferBytes -= requirements.size;
+}
+
+void FrameCapture::collect(const bool iWait) {
+	const auto& vkData = m_context.getVkData();
+	while (!m_pendingSlots.empty()) {
+		auto& slot = m_slots[m_pendingSlots.front()];
+		// Copies complete in submission order: stop at the first one still running.
+		const VkResult status = iWait ? vkWaitForFences(vkData.device, 1, &slot.fence, VK_TRUE, UINT64_MAX)
+									  : vkGetFenceStatus(vkData.device, slot.fence);
+		if (status == VK_NOT_READY || status == VK_TIMEOUT)
+			break;
+		VulkanContext::checkVkResult(status);
+		const auto start = std::chrono::steady_clock::now();
+		Job job{.image = {.width = slot.width, .height = slot.height, .bgra = slot.bgra, .pixels = {}},
+				.target = slot.target,
+				.session = slot.session};
+		const auto* mapped = static_cast<const uint8_t*>(slot.mapped);
+		job.image.pixels.assign(mapped, mapped + static_cast<size_t>(slot.width) * slot.height * g_pixelSize);
+		const VkResult err = vkResetFences(vkData.device, 1, &slot.fence);
+		VulkanContext::checkVkResult(err);
+		m_freeSlots.push_back(m_pendingSlots.front());
+		m_pendingSlots.pop_front();
+		{
+			std::lock_guard lock(m_mutex);
+			m_stats.readbackMs += elapsedMs(start);
+			if (m_jobs.size() >= m_config.queueSize) {
+				++m_stats.dropped;
+				continue;
+			}
+			m_jobs.push_back(std::move(job));
+		}
+		m_condition.notify_one();
+	}
+}
+
+void FrameCapture::encoderLoop() {
+	while (true) {
+		Job job;
+		{
+			std::unique_lock lock(m_mutex);
+			m_condition.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+			if (m_jobs.empty())
+				break;
+			job = std::move(m_jobs.front());
+			m_jobs.pop_front();
+		}
+		encode(job);
+	}
+	m_video.close();
+}
+
+void FrameCapture::encode(const Job& iJob) {
+	const auto start = std::chrono::steady_clock::now();
+	std::error_code error;
+	std::filesystem::create_directories(m_config.directory, error);
+	bool written = false;
+	if (iJob.target == Target::Screenshot) {
+		const auto path = m_config.directory / std::format("screenshot_{}.png", timestamp());
+		written = capture::writePng(path, iJob.image);
+		if (written)
+			log_info("Screenshot saved to '{}'.", path.string());
+	} else if (iJob.image.pixels.empty()) {
+		// End of session marker.
+		if (m_video.isOpen())
+			log_info("Recording saved ({} frames).", m_video.getFrameCount());
+		m_video.close();
+		return;
+	} else {
+		if (iJob.session != m_videoSession) {
+			m_videoSession = iJob.session;
+			m_sequenceName = std::format("recording_{}", timestamp());
+			m_sequenceFrame = 0;
+			m_video.close();
+		}
+		if (m_config.recordFormat == Format::Png) {
+			written = capture::writePng(
+					m_config.directory / std::format("{}_{:06}.png", m_sequenceName, m_sequenceFrame++), iJob.image);
+		} else {
+			// A stream has fixed dimensions: a resized window starts a new file.
+			if (!m_video.isOpen() || m_video.getWidth() != iJob.image.width ||
+				m_video.getHeight() != iJob.image.height) {
+				const auto path = m_config.directory / std::format("{}_{}x{}.y4m", m_sequenceName, iJob.image.width,
+																   iJob.image.height);
+				if (!m_video.open(path, iJob.image.width, iJob.image.height, m_config.frameRate))
+					return;
+				log_info("Recording to '{}'.", path.string());
+			}
+			written = m_video.append(iJob.image);
+		}
+	}
+	std::lock_guard lock(m_mutex);
+	m_stats.encodeMs += elapsedMs(start);
+	if (written) {
+		++m_stats.encoded;
+		m_stats.bytes += iJob.image.pixels.size();
+	}
+}
+
+}// namespace mvi::core::vulkan
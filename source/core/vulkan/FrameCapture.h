@@ -0,0 +1,261 @@
+/**
+ * @file FrameCapture.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "core/capture/ImageWriter.h"
+#include "vkData.h"
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Asynchronous frame capture.
+ *
+ * Captured images are copied into a ring of host-visible buffers by a separate submission on the
+ * graphics queue. Each buffer is read back several frames later, once its fence is signaled, so the
+ * render thread never waits on the GPU. Encoding (PNG or YUV4MPEG2 stream) runs on a background thread.
+ */
+class FrameCapture final {
+public:
+	/// Output format of the continuous recording.
+	enum struct Format : uint8_t {
+		Y4m,///< Single raw YUV4MPEG2 stream.
+		Png,///< One PNG file per frame.
+	};
+
+	/**
+	 * @brief Capture configuration.
+	 */
+	struct Config {
+		/// Output directory.
+		std::filesystem::path directory;
+		/// Number of readback buffers (frames in flight).
+		uint32_t ringSize = 4;
+		/// Maximum number of frames waiting for the encoder.
+		uint32_t queueSize = 8;
+		/// Format of the continuous recording.
+		Format recordFormat = Format::Y4m;
+		/// Nominal frame rate written in video streams.
+		uint32_t frameRate = 60;
+	};
+
+	/**
+	 * @brief Capture statistics.
+	 */
+	struct Stats {
+		/// Captured frames (copied on the GPU).
+		uint64_t captured = 0;
+		/// Frames dropped because the ring or the encoder queue was full.
+		uint64_t dropped = 0;
+		/// Frames written to disk.
+		uint64_t encoded = 0;
+		/// Written bytes (raw frame data).
+		uint64_t bytes = 0;
+		/// Render thread time spent recording the copies, in milliseconds.
+		double recordMs = 0.0;
+		/// Render thread time spent reading the buffers back, in milliseconds.
+		double readbackMs = 0.0;
+		/// Encoder thread time, in milliseconds.
+		double encodeMs = 0.0;
+		/// Host-visible memory held by the ring.
+		uint64_t bufferBytes = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iContext The Vulkan context.
+	 * @param[in] iConfig The configuration.
+	 */
+	FrameCapture(const VulkanContext& iContext, Config iConfig);
+	/**
+	 * @brief Destructor: wait for the pending copies and flush the encoder.
+	 */
+	~FrameCapture();
+
+	FrameCapture(const FrameCapture&) = delete;
+	FrameCapture(FrameCapture&&) = delete;
+	auto operator=(const FrameCapture&) -> FrameCapture& = delete;
+	auto operator=(FrameCapture&&) -> FrameCapture& = delete;
+
+	/**
+	 * @brief Capture the next rendered frame to a PNG file.
+	 */
+	void requestScreenshot() { m_screenshotRequested = true; }
+	/**
+	 * @brief Start the continuous recording.
+	 */
+	void startRecording();
+	/**
+	 * @brief Stop the continuous recording.
+	 */
+	void stopRecording();
+	/**
+	 * @brief Check if the continuous recording is running.
+	 * @return True if recording.
+	 */
+	[[nodiscard]] auto isRecording() const -> bool { return m_recording; }
+
+	/**
+	 * @brief Read back the finished copies and reserve a buffer if this frame must be captured.
+	 * @return True if the frame must be recorded with record().
+	 */
+	[[nodiscard]] auto prepare() -> bool;
+	/**
+	 * @brief Submit the copy of the rendered image into the reserved buffer.
+	 *
+	 * Must follow the submission rendering the image on the same queue. The image is left in its layout.
+	 *
+	 * @param[in] iImage The image to capture.
+	 * @param[in] iLayout The current layout of the image.
+	 * @param[in] iFormat The image format (8 bits RGBA or BGRA).
+	 * @param[in] iExtent The image size.
+	 * @param[in] iSignal Semaphore to signal when the copy is done (may be null).
+	 */
+	void record(VkImage iImage, VkImageLayout iLayout, VkFormat iFormat, VkExtent2D iExtent, VkSemaphore iSignal);
+
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> Stats;
+	/**
+	 * @brief Get the configuration.
+	 * @return The configuration.
+	 */
+	[[nodiscard]] auto getConfig() const -> const Config& { return m_config; }
+
+private:
+	/// What a captured frame is used for.
+	enum struct Target : uint8_t {
+		Screenshot,
+		Recording,
+	};
+
+	/**
+	 * @brief Readback buffer.
+	 */
+	struct Slot {
+		/// Host-visible buffer.
+		VkBuffer buffer = VK_NULL_HANDLE;
+		/// Buffer memory.
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		/// Persistent mapping.
+		void* mapped = nullptr;
+		/// Buffer size.
+		VkDeviceSize size = 0;
+		/// Copy command buffer.
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+		/// Copy completion.
+		VkFence fence = VK_NULL_HANDLE;
+		/// Captured width.
+		uint32_t width = 0;
+		/// Captured height.
+		uint32_t height = 0;
+		/// Captured channels order.
+		bool bgra = false;
+		/// Capture usage.
+		Target target = Target::Screenshot;
+		/// Recording session.
+		uint32_t session = 0;
+	};
+
+	/**
+	 * @brief Frame waiting for the encoder.
+	 */
+	struct Job {
+		/// The image.
+		capture::Image image;
+		/// Capture usage.
+		Target target = Target::Screenshot;
+		/// Recording session.
+		uint32_t session = 0;
+	};
+
+	/**
+	 * @brief Make sure a slot buffer can hold an image.
+	 * @param[in,out] ioSlot The slot.
+	 * @param[in] iSize The required size.
+	 */
+	void ensureCapacity(Slot& ioSlot, VkDeviceSize iSize);
+	/**
+	 * @brief Destroy a slot buffer.
+	 * @param[in,out] ioSlot The slot.
+	 */
+	void releaseBuffer(Slot& ioSlot);
+	/**
+	 * @brief Hand the finished copies to the encoder.
+	 * @param[in] iWait Wait for all copies.
+	 */
+	void collect(bool iWait);
+	/**
+	 * @brief Encoder thread loop.
+	 */
+	void encoderLoop();
+	/**
+	 * @brief Encode one frame.
+	 * @param[in] iJob The frame.
+	 */
+	void encode(const Job& iJob);
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// The configuration.
+	Config m_config;
+	/// Command pool of the copies.
+	VkCommandPool m_commandPool = VK_NULL_HANDLE;
+	/// The readback ring.
+	std::vector<Slot> m_slots;
+	/// Free slots.
+	std::vector<size_t> m_freeSlots;
+	/// Slots being copied, in submission order.
+	std::deque<size_t> m_pendingSlots;
+	/// Slot reserved by prepare().
+	size_t m_reserved = 0;
+	/// Reserved slot usage.
+	Target m_reservedTarget = Target::Screenshot;
+	/// Screenshot requested flag.
+	bool m_screenshotRequested = false;
+	/// Continuous recording flag.
+	bool m_recording = false;
+	/// Current recording session.
+	uint32_t m_session = 0;
+	/// The recording stream must be closed once its frames are collected.
+	bool m_closeRequested = false;
+
+	/// Encoder thread.
+	std::thread m_encoder;
+	/// Encoder queue.
+	std::deque<Job> m_jobs;
+	/// Protect the queue and the statistics.
+	mutable std::mutex m_mutex;
+	/// Wake up the encoder.
+	std::condition_variable m_condition;
+	/// Encoder stop flag.
+	bool m_stop = false;
+	/// The statistics.
+	Stats m_stats;
+	/// Stream of the current recording (encoder thread only).
+	capture::Y4mWriter m_video;
+	/// Session of the open stream (encoder thread only).
+	uint32_t m_videoSession = 0;
+	/// Base name of the current recording files (encoder thread only).
+	std::string m_sequenceName;
+	/// Frames of the current PNG sequence (encoder thread only).
+	uint64_t m_sequenceFrame = 0;
+};
+
+}// namespace mvi::core::vulkan
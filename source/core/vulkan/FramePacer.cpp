@@ -0,0 +1,165 @@
+/**
+ * @file FramePacer.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "FramePacer.h"
+
+#include "VulkanContext.h"
+#include "core/defines.h"
+#include "core/utilities.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mvi::core::vulkan {
+
+namespace {
+
+/// Acquisition time above which the presentation engine is considered blocking until a vertical blank.
+constexpr double g_blockedAcquire = 0.5e-3;
+/// Age of the last measured vertical blank above which it is measured again.
+constexpr double g_resyncAge = 1.0;
+/// Frames without sleeping to measure the vertical blanks again.
+constexpr uint32_t g_resyncFrames = 3;
+
+/**
+ * @brief Convert seconds to a clock duration.
+ * @param[in] iSeconds The seconds.
+ * @return The duration.
+ */
+auto toDuration(const double iSeconds) -> FramePacer::clock::duration {
+	return std::chrono::duration_cast<FramePacer::clock::duration>(std::chrono::duration<double>(iSeconds));
+}
+
+/**
+ * @brief Convert a clock duration to seconds.
+ * @param[in] iDuration The duration.
+ * @return The seconds.
+ */
+auto toSeconds(const FramePacer::clock::duration iDuration) -> double {
+	return std::chrono::duration<double>(iDuration).count();
+}
+
+}// namespace
+
+FramePacer::FramePacer(const VulkanContext& iContext, const bool iPresentWait) : m_context{iContext} {
+	if (!iPresentWait)
+		return;
+	MVI_DIAG_PUSH
+	MVI_DIAG_DISABLE_CLANG("-Wcast-function-type-strict")
+	m_waitForPresent = reinterpret_cast<PFN_vkWaitForPresentKHR>(
+			vkGetDeviceProcAddr(m_context.getVkData().device, "vkWaitForPresentKHR"));
+	MVI_DIAG_POP
+}
+
+FramePacer::~FramePacer() = default;
+
+void FramePacer::setRefreshRate(const int iHertz) {
+	if (iHertz > 0)
+		m_period = 1.0 / static_cast<double>(iHertz);
+}
+
+void FramePacer::waitForFrame() {
+	m_sleep = 0.0;
+	if (!m_config.lowLatency) {
+		m_target = {};
+		m_inputTime = clock::now();
+		return;
+	}
+	// The previous frame is displayed at a vertical blank: its time anchors the prediction.
+	if (m_waitForPresent != nullptr && m_swapchain != VK_NULL_HANDLE && m_presentedId > m_waitedId) {
+		const auto timeout = static_cast<uint64_t>(4.0 * m_period * 1e9);
+		const VkResult err = m_waitForPresent(m_context.getVkData().device, m_swapchain, m_presentedId, timeout);
+		m_waitedId = m_presentedId;
+		if (err == VK_SUCCESS) {
+			const auto now = clock::now();
+			if (m_target != clock::time_point{} && now > m_target + toDuration(0.5 * m_period))
+				++m_missed;
+			vsync(now);
+		}
+	}
+	const auto now = clock::now();
+	if (m_lastVsync == clock::time_point{}) {
+		m_target = {};
+		m_inputTime = now;
+		return;
+	}
+	// Without present wait, the blanks are only measured while the presentation engine blocks.
+	if (m_waitForPresent == nullptr && m_resyncFrames == 0 && toSeconds(now - m_lastVsync) > g_resyncAge)
+		m_resyncFrames = g_resyncFrames;
+	if (m_resyncFrames > 0) {
+		--m_resyncFrames;
+		m_target = {};
+		m_inputTime = now;
+		return;
+	}
+
+	// First blank the frame can make, and the latest start to make it.
+	const double lead = expectedBuild() + m_config.marginMs * 1e-3;
+	const double blanks = std::max(std::ceil((toSeconds(now - m_lastVsync) + lead) / m_period), 1.0);
+	m_target = m_lastVsync + toDuration(blanks * m_period);
+	if (const auto wake = m_target - toDuration(lead); wake > now)
+		sleepUntil(wake);
+	m_inputTime = clock::now();
+	m_sleep = toSeconds(m_inputTime - now);
+}
+
+void FramePacer::acquired(const clock::time_point iStart) {
+	// Present wait gives better timings when in use.
+	if (m_waitForPresent != nullptr && m_config.lowLatency)
+		return;
+	const auto now = clock::now();
+	if (toSeconds(now - iStart) > g_blockedAcquire)
+		vsync(now);
+}
+
+auto FramePacer::nextPresentId() -> uint64_t { return m_waitForPresent != nullptr ? ++m_presentId : 0; }
+
+void FramePacer::presented(VkSwapchainKHR iSwapchain, const uint64_t iPresentId) {
+	m_swapchain = iSwapchain;
+	if (iPresentId != 0)
+		m_presentedId = iPresentId;
+	if (m_inputTime == clock::time_point{})
+		return;
+	m_buildTimes[m_buildIndex] = toSeconds(clock::now() - m_inputTime);
+	m_buildIndex = (m_buildIndex + 1) % m_buildTimes.size();
+}
+
+auto FramePacer::getStats() const -> Stats {
+	return {.presentWait = m_waitForPresent != nullptr && m_config.lowLatency,
+			.refreshMs = m_period * 1e3,
+			.buildMs = expectedBuild() * 1e3,
+			.sleepMs = m_sleep * 1e3,
+			.latencyMs = m_target != clock::time_point{} ? toSeconds(m_target - m_inputTime) * 1e3 : 0.0,
+			.missed = m_missed};
+}
+
+void FramePacer::vsync(const clock::time_point iTime) {
+	if (m_lastVsync != clock::time_point{}) {
+		// Blanks may be skipped: the interval is a multiple of the period.
+		const double interval = toSeconds(iTime - m_lastVsync);
+		if (const double blanks = std::round(interval / m_period); blanks >= 1.0 && blanks <= 8.0) {
+			if (const double sample = interval / blanks; std::abs(sample - m_period) < 0.25 * m_period)
+				m_period += 0.05 * (sample - m_period);
+		}
+	}
+	m_lastVsync = iTime;
+}
+
+auto FramePacer::expectedBuild() const -> double {
+	// A high percentile of the last build times: a late frame costs a whole refresh period.
+	std::array<double, 32> sorted = m_buildTimes;
+	std::ranges::sort(sorted);
+	const auto first = std::ranges::find_if(sorted, [](const double iTime) -> bool { return iTime > 0.0; });
+	if (first == sorted.end())
+		return 0.25 * m_period;
+	const auto count = static_cast<size_t>(sorted.end() - first);
+	return *(first + static_cast<std::ptrdiff_t>(count * 9 / 10));
+}
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,169 @@
+/**
+ * @file FramePacer.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "vkData.h"
+
+#include <array>
+#include <chrono>
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Frame pacing, to sample the inputs as late as possible before the presentation.
+ *
+ * With FIFO presentation, a frame built right after the previous one waits for up to two vertical
+ * blanks before being displayed, with inputs polled at its start. In low latency mode, the pacer
+ * predicts the next vertical blank and sleeps until just before it, minus the expected CPU build time,
+ * so the inputs are polled just in time for the frame to be displayed at that blank.
+ *
+ * The vertical blanks are timed by waiting for the previous presentation (VK_KHR_present_wait), or,
+ * without it, by the acquisitions blocked by the presentation engine.
+ */
+class FramePacer final {
+public:
+	/// Clock of the pacing.
+	using clock = std::chrono::steady_clock;
+
+	/**
+	 * @brief Pacer configuration.
+	 */
+	struct Config {
+		/// Sleep before the frames to reduce the input latency.
+		bool lowLatency = false;
+		/// Safety margin before the predicted deadline, in milliseconds.
+		double marginMs = 1.0;
+	};
+
+	/**
+	 * @brief Pacing statistics.
+	 */
+	struct Stats {
+		/// Vertical blanks timed by the presentation engine.
+		bool presentWait = false;
+		/// Estimated refresh period, in milliseconds.
+		double refreshMs = 0.0;
+		/// Expected CPU build time, in milliseconds.
+		double buildMs = 0.0;
+		/// Sleep before the last frame, in milliseconds.
+		double sleepMs = 0.0;
+		/// Predicted delay between the input sampling and the display, in milliseconds.
+		double latencyMs = 0.0;
+		/// Frames displayed later than predicted.
+		uint64_t missed = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iContext The Vulkan context.
+	 * @param[in] iPresentWait The present id and present wait extensions are enabled.
+	 */
+	FramePacer(const VulkanContext& iContext, bool iPresentWait);
+	/**
+	 * @brief Destructor.
+	 */
+	~FramePacer();
+
+	FramePacer(const FramePacer&) = delete;
+	FramePacer(FramePacer&&) = delete;
+	auto operator=(const FramePacer&) -> FramePacer& = delete;
+	auto operator=(FramePacer&&) -> FramePacer& = delete;
+
+	/**
+	 * @brief Define the configuration.
+	 * @param[in] iConfig The configuration.
+	 */
+	void setConfig(const Config& iConfig) { m_config = iConfig; }
+	/**
+	 * @brief Get the configuration.
+	 * @return The configuration.
+	 */
+	[[nodiscard]] auto getConfig() const -> const Config& { return m_config; }
+	/**
+	 * @brief Define the nominal refresh rate, until the vertical blanks are measured.
+	 * @param[in] iHertz The refresh rate.
+	 */
+	void setRefreshRate(int iHertz);
+
+	/**
+	 * @brief Wait for the time to start the next frame (main thread, before polling the inputs).
+	 */
+	void waitForFrame();
+	/**
+	 * @brief Report a swap chain image acquisition.
+	 * @param[in] iStart Time before the acquisition.
+	 */
+	void acquired(clock::time_point iStart);
+	/**
+	 * @brief Get the identifier of the next presentation.
+	 * @return The present id, 0 if not used.
+	 */
+	[[nodiscard]] auto nextPresentId() -> uint64_t;
+	/**
+	 * @brief Report a successful presentation.
+	 * @param[in] iSwapchain The swap chain.
+	 * @param[in] iPresentId The present id given to the presentation.
+	 */
+	void presented(VkSwapchainKHR iSwapchain, uint64_t iPresentId);
+
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> Stats;
+
+private:
+	/**
+	 * @brief Record a vertical blank.
+	 * @param[in] iTime The time of the blank.
+	 */
+	void vsync(clock::time_point iTime);
+	/**
+	 * @brief Get the expected CPU build time.
+	 * @return The build time, in seconds.
+	 */
+	[[nodiscard]] auto expectedBuild() const -> double;
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// The configuration.
+	Config m_config;
+	/// Present wait entry point, null if not available.
+	PFN_vkWaitForPresentKHR m_waitForPresent = nullptr;
+	/// Swap chain of the last presentation.
+	VkSwapchainKHR m_swapchain = VK_NULL_HANDLE;
+	/// Last present id given.
+	uint64_t m_presentId = 0;
+	/// Present id of the last presentation.
+	uint64_t m_presentedId = 0;
+	/// Last present id waited for.
+	uint64_t m_waitedId = 0;
+	/// Time of the last vertical blank.
+	clock::time_point m_lastVsync;
+	/// Estimated refresh period, in seconds.
+	double m_period = 1.0 / 60.0;
+	/// Vertical blank the current frame is built for.
+	clock::time_point m_target;
+	/// Time of the input sampling of the current frame.
+	clock::time_point m_inputTime;
+	/// Frames left without sleeping, to measure the vertical blanks again.
+	uint32_t m_resyncFrames = 0;
+	/// Last build times, in seconds.
+	std::array<double, 32> m_buildTimes{};
+	/// Next build time slot.
+	size_t m_buildIndex = 0;
+	/// Sleep before the last frame, in seconds.
+	double m_sleep = 0.0;
+	/// Frames displayed later than predicted.
+	uint64_t m_missed = 0;
+};
+
+}// namespace mvi::core::vulkan
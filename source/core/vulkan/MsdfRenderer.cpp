@@ -0,0 +1,270 @@
+/**
+ * @file MsdfRenderer.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "MsdfRenderer.h"
+
+#include "Shader.h"
+#include "VulkanContext.h"
+
+#include <backends/imgui_impl_vulkan.h>// NOLINT
+#include <imgui.h>
+#include <imgui_internal.h>
+
+namespace mvi::core::vulkan {
+
+namespace {
+
+/// Vertex shader, identical to the ImGui backend one.
+constexpr std::string_view g_vertexShader = R"(#version 450 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in vec2 aUV;
+layout(location = 2) in vec4 aColor;
+layout(push_constant) uniform uPushConstant { vec2 uScale; vec2 uTranslate; } pc;
+out gl_PerVertex { vec4 gl_Position; };
+layout(location = 0) out struct { vec4 Color; vec2 UV; } Out;
+void main() {
+	Out.Color = aColor;
+	Out.UV = aUV;
+	gl_Position = vec4(aPos * pc.uScale + pc.uTranslate, 0, 1);
+}
+)";
+
+/// Fragment shader: median of the channels, anti-aliased over one screen pixel.
+constexpr std::string_view g_fragmentShader = R"(#version 450 core
+layout(location = 0) out vec4 fColor;
+layout(set = 0, binding = 0) uniform sampler2D sTexture;
+layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
+layout(constant_id = 0) const float cPixelRange = 4.0;
+float median(vec3 v) { return max(min(v.r, v.g), min(max(v.r, v.g), v.b)); }
+void main() {
+	vec3 msd = texture(sTexture, In.UV).rgb;
+	vec2 unitRange = vec2(cPixelRange) / vec2(textureSize(sTexture, 0));
+	vec2 screenTexSize = vec2(1.0) / fwidth(In.UV);
+	float screenPxRange = max(0.5 * dot(unitRange, screenTexSize), 1.0);
+	float opacity = clamp(screenPxRange * (median(msd) - 0.5) + 0.5, 0.0, 1.0);
+	fColor = vec4(In.Color.rgb, In.Color.a * opacity);
+}
+)";
+
+}// namespace
+
+MsdfRenderer::MsdfRenderer(const VulkanContext& iContext, VkRenderPass iRenderPass,
+						   std::unique_ptr<fonts::MsdfAtlas> iAtlas)
+	: m_context{iContext}, m_atlas{std::move(iAtlas)} {
+	const auto& vkData = m_context.getVkData();
+	m_texture = std::make_unique<Texture>(m_context, m_atlas->getWidth(), m_atlas->getHeight(), m_atlas->getPixels());
+	VkResult err = VK_SUCCESS;
+
+	// Layouts, compatible with the ImGui backend ones
+	{
+		VkDescriptorSetLayoutBinding binding = {};
+		binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		binding.descriptorCount = 1;
+		binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+		VkDescriptorSetLayoutCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		info.bindingCount = 1;
+		info.pBindings = &binding;
+		err = vkCreateDescriptorSetLayout(vkData.device, &info, vkData.allocator, &m_descriptorSetLayout);
+		VulkanContext::checkVkResult(err);
+
+		VkPushConstantRange push_constants = {};
+		push_constants.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+		push_constants.offset = 0;
+		push_constants.size = sizeof(float) * 4;
+		VkPipelineLayoutCreateInfo layout_info = {};
+		layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		layout_info.setLayoutCount = 1;
+		layout_info.pSetLayouts = &m_descriptorSetLayout;
+		layout_info.pushConstantRangeCount = 1;
+		layout_info.pPushConstantRanges = &push_constants;
+		err = vkCreatePipelineLayout(vkData.device, &layout_info, vkData.allocator, &m_pipelineLayout);
+		VulkanContext::checkVkResult(err);
+	}
+
+	// Pipeline
+	{
+		const auto vertexCode = compileShader(g_vertexShader, ShaderStage::Vertex, "msdf.vert");
+		const auto fragmentCode = compileShader(g_fragmentShader, ShaderStage::Fragment, "msdf.frag");
+		VkShaderModule vertexModule = createShaderModule(vkData, vertexCode);
+		VkShaderModule fragmentModule = createShaderModule(vkData, fragmentCode);
+		if (vertexModule == VK_NULL_HANDLE || fragmentModule == VK_NULL_HANDLE) {
+			vkDestroyShaderModule(vkData.device, vertexModule, vkData.allocator);
+			vkDestroyShaderModule(vkData.device, fragmentModule, vkData.allocator);
+			return;
+		}
+
+		const float pixelRange = m_atlas->getPixelRange();
+		const VkSpecializationMapEntry specialization_entry = {.constantID = 0, .offset = 0, .size = sizeof(float)};
+		const VkSpecializationInfo specialization = {
+				.mapEntryCount = 1, .pMapEntries = &specialization_entry, .dataSize = sizeof(float), .pData = &pixelRange};
+		std::array<VkPipelineShaderStageCreateInfo, 2> stages = {};
+		stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+		stages[0].module = vertexModule;
+		stages[0].pName = "main";
+		stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+		stages[1].module = fragmentModule;
+		stages[1].pName = "main";
+		stages[1].pSpecializationInfo = &specialization;
+
+		VkVertexInputBindingDescription binding_desc = {};
+		binding_desc.stride = sizeof(ImDrawVert);
+		binding_desc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+		std::array<VkVertexInputAttributeDescription, 3> attribute_desc = {};
+		attribute_desc[0] = {.location = 0,
+							 .binding = 0,
+							 .format = VK_FORMAT_R32G32_SFLOAT,
+							 .offset = static_cast<uint32_t>(offsetof(ImDrawVert, pos))};
+		attribute_desc[1] = {.location = 1,
+							 .binding = 0,
+							 .format = VK_FORMAT_R32G32_SFLOAT,
+							 .offset = static_cast<uint32_t>(offsetof(ImDrawVert, uv))};
+		attribute_desc[2] = {.location = 2,
+							 .binding = 0,
+							 .format = VK_FORMAT_R8G8B8A8_UNORM,
+							 .offset = static_cast<uint32_t>(offsetof(ImDrawVert, col))};
+		VkPipelineVertexInputStateCreateInfo vertex_info = {};
+		vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+		vertex_info.vertexBindingDescriptionCount = 1;
+		vertex_info.pVertexBindingDescriptions = &binding_desc;
+		vertex_info.vertexAttributeDescriptionCount = static_cast<uint32_t>(attribute_desc.size());
+		vertex_info.pVertexAttributeDescriptions = attribute_desc.data();
+
+		VkPipelineInputAssemblyStateCreateInfo ia_info = {};
+		ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+		ia_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		VkPipelineViewportStateCreateInfo viewport_info = {};
+		viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+		viewport_info.viewportCount = 1;
+		viewport_info.scissorCount = 1;
+		VkPipelineRasterizationStateCreateInfo raster_info = {};
+		raster_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+		raster_info.polygonMode = VK_POLYGON_MODE_FILL;
+		raster_info.cullMode = VK_CULL_MODE_NONE;
+		raster_info.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+		raster_info.lineWidth = 1.0f;
+		VkPipelineMultisampleStateCreateInfo ms_info = {};
+		ms_info.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+		ms_info.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+		VkPipelineColorBlendAttachmentState color_attachment = {};
+		color_attachment.blendEnable = VK_TRUE;
+		color_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+		color_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+		color_attachment.colorBlendOp = VK_BLEND_OP_ADD;
+		color_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+		color_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+		color_attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+		color_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+										  VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+		VkPipelineDepthStencilStateCreateInfo depth_info = {};
+		depth_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+		VkPipelineColorBlendStateCreateInfo blend_info = {};
+		blend_info.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+		blend_info.attachmentCount = 1;
+		blend_info.pAttachments = &color_attachment;
+		constexpr std::array dynamic_states = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+		VkPipelineDynamicStateCreateInfo dynamic_state = {};
+		dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+		dynamic_state.dynamicStateCount = static_cast<uint32_t>(dynamic_states.size());
+		dynamic_state.pDynamicStates = dynamic_states.data();
+
+		VkGraphicsPipelineCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+		info.stageCount = static_cast<uint32_t>(stages.size());
+		info.pStages = stages.data();
+		info.pVertexInputState = &vertex_info;
+		info.pInputAssemblyState = &ia_info;
+		info.pViewportState = &viewport_info;
+		info.pRasterizationState = &raster_info;
+		info.pMultisampleState = &ms_info;
+		info.pDepthStencilState = &depth_info;
+		info.pColorBlendState = &blend_info;
+		info.pDynamicState = &dynamic_state;
+		info.layout = m_pipelineLayout;
+		info.renderPass = iRenderPass;
+		info.subpass = 0;
+		err = vkCreateGraphicsPipelines(vkData.device, vkData.pipelineCache, 1, &info, vkData.allocator, &m_pipeline);
+		VulkanContext::checkVkResult(err);
+		vkDestroyShaderModule(vkData.device, vertexModule, vkData.allocator);
+		vkDestroyShaderModule(vkData.device, fragmentModule, vkData.allocator);
+	}
+}
+
+MsdfRenderer::~MsdfRenderer() {
+	const auto& vkData = m_context.getVkData();
+	vkDestroyPipeline(vkData.device, m_pipeline, vkData.allocator);
+	vkDestroyPipelineLayout(vkData.device, m_pipelineLayout, vkData.allocator);
+	vkDestroyDescriptorSetLayout(vkData.device, m_descriptorSetLayout, vkData.allocator);
+}
+
+void MsdfRenderer::drawText(ImDrawList* ioDrawList, const ImVec2& iPosition, const float iSize, const uint32_t iColor,
+							const std::string_view iText) const {
+	if (m_pipeline == VK_NULL_HANDLE || iText.empty())
+		return;
+	ioDrawList->AddCallback(&MsdfRenderer::bindPipeline, const_cast<MsdfRenderer*>(this));// NOLINT
+	ioDrawList->PushTexture(ImTextureRef(static_cast<ImTextureID>(m_texture->getTextureId())));
+	ImVec2 pen{iPosition.x, iPosition.y + m_atlas->getAscent() * iSize};
+	const char* text = iText.data();
+	const char* textEnd = text + iText.size();
+	while (text < textEnd) {
+		unsigned int codepoint = 0;
+		text += ImTextCharFromUtf8(&codepoint, text, textEnd);
+		if (codepoint == '\n') {
+			pen = {iPosition.x, pen.y + m_atlas->getLineHeight() * iSize};
+			continue;
+		}
+		const auto* glyph = m_atlas->findGlyph(codepoint);
+		if (glyph == nullptr)
+			glyph = m_atlas->findGlyph('?');
+		if (glyph == nullptr)
+			continue;
+		if (glyph->visible) {
+			ioDrawList->PrimReserve(6, 4);
+			ioDrawList->PrimRectUV({pen.x + glyph->x0 * iSize, pen.y + glyph->y0 * iSize},
+								   {pen.x + glyph->x1 * iSize, pen.y + glyph->y1 * iSize}, {glyph->u0, glyph->v0},
+								   {glyph->u1, glyph->v1}, iColor);
+		}
+		pen.x += glyph->advance * iSize;
+	}
+	ioDrawList->PopTexture();
+	ioDrawList->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+}
+
+auto MsdfRenderer::calcTextSize(const float iSize, const std::string_view iText) const -> ImVec2 {
+	ImVec2 size{0.f, m_atlas->getLineHeight() * iSize};
+	float lineWidth = 0.f;
+	const char* text = iText.data();
+	const char* textEnd = text + iText.size();
+	while (text < textEnd) {
+		unsigned int codepoint = 0;
+		text += ImTextCharFromUtf8(&codepoint, text, textEnd);
+		if (codepoint == '\n') {
+			size.x = std::max(size.x, lineWidth);
+			size.y += m_atlas->getLineHeight() * iSize;
+			lineWidth = 0.f;
+			continue;
+		}
+		if (const auto* glyph = m_atlas->findGlyph(codepoint); glyph != nullptr)
+			lineWidth += glyph->advance * iSize;
+	}
+	size.x = std::max(size.x, lineWidth);
+	return size;
+}
+
+void MsdfRenderer::bindPipeline(const ImDrawList*, const ImDrawCmd* iCmd) {
+	const auto* renderer = static_cast<const MsdfRenderer*>(iCmd->UserCallbackData);
+	const auto* renderState = static_cast<ImGui_ImplVulkan_RenderState*>(ImGui::GetPlatformIO().Renderer_RenderState);
+	if (renderState == nullptr)
+		return;
+	vkCmdBindPipeline(renderState->CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, renderer->m_pipeline);
+}
+
+}// namespace mvi::core::vulkan
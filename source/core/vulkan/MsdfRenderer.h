@@ -0,0 +1,100 @@
+/**
+ * @file MsdfRenderer.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "Texture.h"
+#include "core/fonts/MsdfAtlas.h"
+
+#include <memory>
+#include <string_view>
+
+struct ImDrawList;
+struct ImDrawCmd;
+struct ImVec2;
+
+namespace mvi::core::vulkan {
+
+/**
+ * @brief Draw text from a MSDF atlas inside ImGui draw lists.
+ *
+ * Text quads are regular ImGui vertices; draw callbacks switch to the MSDF pipeline around them. The
+ * pipeline layout matches the ImGui one, so the backend descriptor sets and push constants stay valid.
+ */
+class MsdfRenderer final {
+public:
+	/**
+	 * @brief Constructor: upload the atlas and create the pipeline.
+	 * @param[in] iContext The Vulkan context.
+	 * @param[in] iRenderPass The render pass the text is drawn in.
+	 * @param[in] iAtlas The built atlas.
+	 */
+	MsdfRenderer(const VulkanContext& iContext, VkRenderPass iRenderPass, std::unique_ptr<fonts::MsdfAtlas> iAtlas);
+	/**
+	 * @brief Destructor.
+	 */
+	~MsdfRenderer();
+
+	MsdfRenderer(const MsdfRenderer&) = delete;
+	MsdfRenderer(MsdfRenderer&&) = delete;
+	auto operator=(const MsdfRenderer&) -> MsdfRenderer& = delete;
+	auto operator=(MsdfRenderer&&) -> MsdfRenderer& = delete;
+
+	/**
+	 * @brief Add text to a draw list.
+	 * @param[in,out] ioDrawList The draw list.
+	 * @param[in] iPosition The top left position.
+	 * @param[in] iSize The font size in pixels.
+	 * @param[in] iColor The text color.
+	 * @param[in] iText The UTF-8 text.
+	 */
+	void drawText(ImDrawList* ioDrawList, const ImVec2& iPosition, float iSize, uint32_t iColor,
+				  std::string_view iText) const;
+
+	/**
+	 * @brief Compute the size of a text.
+	 * @param[in] iSize The font size in pixels.
+	 * @param[in] iText The UTF-8 text.
+	 * @return The text size.
+	 */
+	[[nodiscard]] auto calcTextSize(float iSize, std::string_view iText) const -> ImVec2;
+
+	/**
+	 * @brief Get the atlas.
+	 * @return The atlas.
+	 */
+	[[nodiscard]] auto getAtlas() const -> const fonts::MsdfAtlas& { return *m_atlas; }
+	/**
+	 * @brief Get the atlas texture.
+	 * @return The texture.
+	 */
+	[[nodiscard]] auto getTexture() const -> const Texture& { return *m_texture; }
+
+private:
+	/**
+	 * @brief Draw callback binding the MSDF pipeline.
+	 * @param[in] iDrawList The draw list.
+	 * @param[in] iCmd The draw command.
+	 */
+	static void bindPipeline(const ImDrawList* iDrawList, const ImDrawCmd* iCmd);
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// The atlas.
+	std::unique_ptr<fonts::MsdfAtlas> m_atlas;
+	/// The atlas texture.
+	std::unique_ptr<Texture> m_texture;
+	/// Descriptor set layout (same as the ImGui one).
+	VkDescriptorSetLayout m_descriptorSetLayout = VK_NULL_HANDLE;
+	/// Pipeline layout (same as the ImGui one).
+	VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+	/// MSDF pipeline.
+	VkPipeline m_pipeline = VK_NULL_HANDLE;
+};
+
+}// namespace mvi::core::vulkan
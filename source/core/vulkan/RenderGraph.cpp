@@ -0,0 +1,383 @@
+/**
+ * @file RenderGraph.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "RenderGraph.h"
+
+#include "VulkanContext.h"
+#include "core/Log.h"
+
+namespace mvi::core::vulkan {
+
+namespace {
+
+/// Accesses that must be made available before another access.
+constexpr VkAccessFlags g_writeAccesses = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+										  VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT |
+										  VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+/**
+ * @brief Get the synchronization state required by a usage.
+ * @param[in] iUsage The usage.
+ * @param[in] iWrite Write flag.
+ * @return The required state.
+ */
+auto getRequiredState(const RenderGraph::Usage iUsage, const bool iWrite) -> RenderGraph::ImageState {
+	switch (iUsage) {
+		case RenderGraph::Usage::ColorAttachment:
+			return {.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+					.stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+					.access = iWrite ? VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+									 : VK_ACCESS_COLOR_ATTACHMENT_READ_BIT};
+		case RenderGraph::Usage::DepthAttachment:
+			return {.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+					.stage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+					.access = iWrite ? VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+											   VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+									 : VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT};
+		case RenderGraph::Usage::Sampled:
+			return {.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+					.stage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+					.access = VK_ACCESS_SHADER_READ_BIT};
+		case RenderGraph::Usage::Storage:
+			return {.layout = VK_IMAGE_LAYOUT_GENERAL,
+					.stage = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+					.access = iWrite ? VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT
+									 : VK_ACCESS_SHADER_READ_BIT};
+		case RenderGraph::Usage::TransferSrc:
+			return {.layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+					.stage = VK_PIPELINE_STAGE_TRANSFER_BIT,
+					.access = VK_ACCESS_TRANSFER_READ_BIT};
+		case RenderGraph::Usage::TransferDst:
+			return {.layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+					.stage = VK_PIPELINE_STAGE_TRANSFER_BIT,
+					.access = VK_ACCESS_TRANSFER_WRITE_BIT};
+	}
+	return {};
+}
+
+/**
+ * @brief Get the aspect of an image format.
+ * @param[in] iFormat The format.
+ * @return The aspect flags.
+ */
+auto getAspect(const VkFormat iFormat) -> VkImageAspectFlags {
+	switch (iFormat) {
+		case VK_FORMAT_D16_UNORM:
+		case VK_FORMAT_X8_D24_UNORM_PACK32:
+		case VK_FORMAT_D32_SFLOAT:
+			return VK_IMAGE_ASPECT_DEPTH_BIT;
+		case VK_FORMAT_D16_UNORM_S8_UINT:
+		case VK_FORMAT_D24_UNORM_S8_UINT:
+		case VK_FORMAT_D32_SFLOAT_S8_UINT:
+			return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+		default:
+			return VK_IMAGE_ASPECT_COLOR_BIT;
+	}
+}
+
+/**
+ * @brief Compare two image descriptions.
+ * @param[in] iA First description.
+ * @param[in] iB Second description.
+ * @return True if identical.
+ */
+auto isSameDesc(const RenderGraph::ImageDesc& iA, const RenderGraph::ImageDesc& iB) -> bool {
+	return iA.format == iB.format && iA.extent.width == iB.extent.width && iA.extent.height == iB.extent.height &&
+		   iA.usage == iB.usage;
+}
+
+}// namespace
+
+auto RenderGraph::Pass::read(const ResourceId iResource, const Usage iUsage) -> Pass& {
+	for (auto& access: m_accesses) {
+		if (access.resource != iResource)
+			continue;
+		access.read = true;
+		return *this;
+	}
+	m_accesses.push_back({.resource = iResource, .usage = iUsage, .read = true});
+	return *this;
+}
+
+auto RenderGraph::Pass::write(const ResourceId iResource, const Usage iUsage, const VkImageLayout iFinalLayout)
+		-> Pass& {
+	for (auto& access: m_accesses) {
+		if (access.resource != iResource)
+			continue;
+		// An image is bound once per pass: the write usage wins.
+		access.usage = iUsage;
+		access.write = true;
+		access.finalLayout = iFinalLayout;
+		return *this;
+	}
+	m_accesses.push_back({.resource = iResource, .usage = iUsage, .write = true, .finalLayout = iFinalLayout});
+	return *this;
+}
+
+RenderGraph::RenderGraph(const VulkanContext& iContext) : m_context{iContext} {}
+
+RenderGraph::~RenderGraph() { releaseTransients(); }
+
+auto RenderGraph::importImage(const std::string_view iName, VkImage iImage, VkImageView iView, const ImageDesc& iDesc,
+							  const ImageState& iState) -> ResourceId {
+	m_resources.push_back({.name = std::string(iName), .desc = iDesc, .image = iImage, .view = iView, .state = iState});
+	return static_cast<ResourceId>(m_resources.size() - 1);
+}
+
+auto RenderGraph::createImage(const std::string_view iName, const ImageDesc& iDesc) -> ResourceId {
+	auto& resource = m_resources.emplace_back();
+	resource.name = iName;
+	resource.desc = iDesc;
+	resource.transient = true;
+	return static_cast<ResourceId>(m_resources.size() - 1);
+}
+
+void RenderGraph::setOutput(const ResourceId iResource) {
+	if (iResource < m_resources.size())
+		m_resources[iResource].output = true;
+}
+
+auto RenderGraph::addPass(const std::string_view iName, Execute iExecute) -> Pass& {
+	auto& pass = m_passes.emplace_back();
+	pass.m_name = iName;
+	pass.m_execute = std::move(iExecute);
+	return pass;
+}
+
+void RenderGraph::execute(VkCommandBuffer iCommandBuffer) {
+	m_stats = {.passes = static_cast<uint32_t>(m_passes.size())};
+	const auto kept = cull();
+	allocateTransients(kept);
+
+	std::vector<VkImageMemoryBarrier> barriers;
+	std::vector<bool> begun(m_resources.size(), false);
+	for (size_t i = 0; i < m_passes.size(); ++i) {
+		auto& pass = m_passes[i];
+		if (!kept[i]) {
+			++m_stats.culledPasses;
+			continue;
+		}
+		const DebugUtils::ScopedLabel label(m_context.getDebugUtils(), iCommandBuffer, pass.m_name);
+		barriers.clear();
+		VkPipelineStageFlags src_stages = 0;
+		VkPipelineStageFlags dst_stages = 0;
+		for (const auto& access: pass.m_accesses) {
+			auto& resource = m_resources[access.resource];
+			const auto required = getRequiredState(access.usage, access.write);
+			auto& state = resource.state;
+			if (resource.transient && !begun[access.resource]) {
+				// Content is discarded, but the previous occupant of the memory must be done.
+				const auto& block = m_blocks[m_transients[resource.allocation].block];
+				state = {.layout = VK_IMAGE_LAYOUT_UNDEFINED, .stage = block.stage, .access = block.access};
+				begun[access.resource] = true;
+			}
+			if (state.layout == required.layout && (state.access & g_writeAccesses) == 0 && !access.write) {
+				// Read after read: no barrier, but later writes must wait for this reader too.
+				state.stage |= required.stage;
+				state.access |= required.access;
+				continue;
+			}
+			VkImageMemoryBarrier barrier = {};
+			barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			barrier.srcAccessMask = state.access & g_writeAccesses;
+			barrier.dstAccessMask = required.access;
+			barrier.oldLayout = state.layout;
+			barrier.newLayout = required.layout;
+			barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.image = resource.image;
+			barrier.subresourceRange.aspectMask = getAspect(resource.desc.format);
+			barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+			barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+			barriers.push_back(barrier);
+			src_stages |= state.stage;
+			dst_stages |= required.stage;
+			state = required;
+		}
+		if (!barriers.empty()) {
+			vkCmdPipelineBarrier(iCommandBuffer, src_stages != 0 ? src_stages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+								 dst_stages, 0, 0, nullptr, 0, nullptr, static_cast<uint32_t>(barriers.size()),
+								 barriers.data());
+			m_stats.barriers += static_cast<uint32_t>(barriers.size());
+		}
+		if (pass.m_execute)
+			pass.m_execute(iCommandBuffer, *this);
+		for (const auto& access: pass.m_accesses) {
+			auto& resource = m_resources[access.resource];
+			if (access.finalLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+				resource.state.layout = access.finalLayout;
+			if (!resource.transient)
+				continue;
+			// The next occupant of the memory, in this frame or the next ones, waits for these accesses.
+			auto& block = m_blocks[m_transients[resource.allocation].block];
+			block.stage = resource.state.stage;
+			block.access = resource.state.access;
+		}
+	}
+	m_stats.transientImages = static_cast<uint32_t>(m_transients.size());
+	m_stats.memoryBlocks = static_cast<uint32_t>(m_blocks.size());
+	for (const auto& transient: m_transients) m_stats.requiredBytes += transient.size;
+	for (const auto& block: m_blocks) m_stats.allocatedBytes += block.size;
+	reset();
+}
+
+void RenderGraph::reset() {
+	m_passes.clear();
+	m_resources.clear();
+}
+
+auto RenderGraph::getImage(const ResourceId iResource) const -> VkImage {
+	if (iResource >= m_resources.size())
+		return VK_NULL_HANDLE;
+	return m_resources[iResource].image;
+}
+
+auto RenderGraph::getImageView(const ResourceId iResource) const -> VkImageView {
+	if (iResource >= m_resources.size())
+		return VK_NULL_HANDLE;
+	return m_resources[iResource].view;
+}
+
+auto RenderGraph::cull() const -> std::vector<bool> {
+	std::vector<bool> kept(m_passes.size(), false);
+	std::vector<bool> live(m_resources.size(), false);
+	for (size_t i = 0; i < m_resources.size(); ++i) live[i] = m_resources[i].output;
+	for (size_t i = m_passes.size(); i-- > 0;) {
+		const auto& pass = m_passes[i];
+		bool needed = pass.m_keep;
+		for (const auto& access: pass.m_accesses) needed |= access.write && live[access.resource];
+		if (!needed)
+			continue;
+		kept[i] = true;
+		// The content read here comes from earlier writers.
+		for (const auto& access: pass.m_accesses) {
+			if (access.write)
+				live[access.resource] = false;
+		}
+		for (const auto& access: pass.m_accesses) {
+			if (access.read)
+				live[access.resource] = true;
+		}
+	}
+	return kept;
+}
+
+void RenderGraph::allocateTransients(const std::vector<bool>& iKept) {
+	// Transient images of the kept passes, in first use order.
+	std::vector<TransientImage> wanted;
+	std::vector<uint32_t> allocation(m_resources.size(), invalidResource);
+	for (uint32_t i = 0; i < m_passes.size(); ++i) {
+		if (!iKept[i])
+			continue;
+		for (const auto& access: m_passes[i].m_accesses) {
+			const auto& resource = m_resources[access.resource];
+			if (!resource.transient)
+				continue;
+			if (allocation[access.resource] == invalidResource) {
+				allocation[access.resource] = static_cast<uint32_t>(wanted.size());
+				wanted.push_back({.desc = resource.desc, .first = i, .last = i, .name = resource.name});
+			} else {
+				wanted[allocation[access.resource]].last = i;
+			}
+		}
+	}
+
+	const bool same = std::ranges::equal(wanted, m_transients,
+										 [](const TransientImage& iA, const TransientImage& iB) -> bool {
+											 return isSameDesc(iA.desc, iB.desc) && iA.first == iB.first &&
+													iA.last == iB.last;
+										 });
+	if (!same) {
+		const auto& vkData = m_context.getVkData();
+		// The previous frames may still use the images: destroyed once they are done.
+		releaseTransients();
+		m_transients = std::move(wanted);
+		std::vector<VkMemoryRequirements> requirements(m_transients.size());
+		for (size_t i = 0; i < m_transients.size(); ++i) {
+			auto& transient = m_transients[i];
+			VkImageCreateInfo info = {};
+			info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+			info.imageType = VK_IMAGE_TYPE_2D;
+			info.format = transient.desc.format;
+			info.extent = {.width = transient.desc.extent.width, .height = transient.desc.extent.height, .depth = 1};
+			info.mipLevels = 1;
+			info.arrayLayers = 1;
+			info.samples = VK_SAMPLE_COUNT_1_BIT;
+			info.tiling = VK_IMAGE_TILING_OPTIMAL;
+			info.usage = transient.desc.usage;
+			info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+			info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			const VkResult err = vkCreateImage(vkData.device, &info, vkData.allocator, &transient.image);
+			VulkanContext::checkVkResult(err);
+			m_context.getDebugUtils().setName(VK_OBJECT_TYPE_IMAGE, transient.image, transient.name);
+			vkGetImageMemoryRequirements(vkData.device, transient.image, &requirements[i]);
+			transient.size = requirements[i].size;
+			// First fit: a block whose last user is done before this image starts.
+			auto block = std::ranges::find_if(m_blocks, [&](const MemoryBlock& iBlock) -> bool {
+				return iBlock.last < transient.first && (iBlock.typeBits & requirements[i].memoryTypeBits) != 0;
+			});
+			if (block == m_blocks.end()) {
+				m_blocks.emplace_back();
+				block = std::prev(m_blocks.end());
+			}
+			block->size = std::max(block->size, requirements[i].size);
+			block->typeBits &= requirements[i].memoryTypeBits;
+			block->last = transient.last;
+			transient.block = static_cast<uint32_t>(std::distance(m_blocks.begin(), block));
+		}
+		for (auto& block: m_blocks) {
+			VkMemoryAllocateInfo alloc_info = {};
+			alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+			alloc_info.allocationSize = block.size;
+			alloc_info.memoryTypeIndex = m_context.findMemoryType(block.typeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+			const VkResult err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &block.memory);
+			VulkanContext::checkVkResult(err);
+			m_context.getDebugUtils().setName(VK_OBJECT_TYPE_DEVICE_MEMORY, block.memory, "render graph transients");
+		}
+		for (auto& transient: m_transients) {
+			VkResult err = vkBindImageMemory(vkData.device, transient.image, m_blocks[transient.block].memory, 0);
+			VulkanContext::checkVkResult(err);
+			VkImageViewCreateInfo view_info = {};
+			view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+			view_info.image = transient.image;
+			view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+			view_info.format = transient.desc.format;
+			view_info.subresourceRange.aspectMask = getAspect(transient.desc.format);
+			view_info.subresourceRange.levelCount = 1;
+			view_info.subresourceRange.layerCount = 1;
+			err = vkCreateImageView(vkData.device, &view_info, vkData.allocator, &transient.view);
+			VulkanContext::checkVkResult(err);
+			m_context.getDebugUtils().setName(VK_OBJECT_TYPE_IMAGE_VIEW, transient.view, transient.name);
+		}
+		++m_generation;
+		log_debug("Render graph: {} transient images in {} memory blocks.", m_transients.size(), m_blocks.size());
+	}
+
+	for (size_t i = 0; i < m_resources.size(); ++i) {
+		if (allocation[i] == invalidResource)
+			continue;
+		auto& resource = m_resources[i];
+		resource.allocation = allocation[i];
+		resource.image = m_transients[allocation[i]].image;
+		resource.view = m_transients[allocation[i]].view;
+	}
+}
+
+void RenderGraph::releaseTransients() {
+	auto& deletion = m_context.getDeletionQueue();
+	for (const auto& transient: m_transients) {
+		deletion.destroyImageView(transient.view);
+		deletion.destroyImage(transient.image);
+	}
+	for (const auto& block: m_blocks) deletion.freeMemory(block.memory);
+	m_transients.clear();
+	m_blocks.clear();
+}
+
+}// namespace mvi::core::vulkan
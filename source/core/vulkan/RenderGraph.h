@@ -0,0 +1,324 @@
+/**
+ * @file RenderGraph.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "vkData.h"
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Graph of the passes recorded in one frame.
+ *
+ * Passes are added during the frame with the images they read and write, and run in registration
+ * order when the frame is rendered. The graph inserts the pipeline barriers and layout transitions
+ * between passes, culls the passes whose writes are never read by a kept pass or an output, and
+ * allocates the transient images, sharing memory between those whose lifetimes do not overlap.
+ *
+ * A pass updating an image (loading its previous content) declares both a read and a write.
+ */
+class RenderGraph final {
+public:
+	/// Resource handle, valid for the current frame.
+	using ResourceId = uint32_t;
+	/// Invalid resource handle.
+	static constexpr ResourceId invalidResource = ~0u;
+
+	/// How a pass uses an image.
+	enum struct Usage : uint8_t {
+		ColorAttachment,///< Color attachment of a render pass.
+		DepthAttachment,///< Depth/stencil attachment of a render pass.
+		Sampled,///< Sampled in a fragment shader.
+		Storage,///< Storage image in a compute shader.
+		TransferSrc,///< Copy source.
+		TransferDst,///< Copy destination.
+	};
+
+	/**
+	 * @brief Image description.
+	 */
+	struct ImageDesc {
+		/// Image format.
+		VkFormat format = VK_FORMAT_UNDEFINED;
+		/// Image size.
+		VkExtent2D extent = {.width = 0, .height = 0};
+		/// Image usage flags.
+		VkImageUsageFlags usage = 0;
+	};
+
+	/**
+	 * @brief Synchronization state of an image.
+	 */
+	struct ImageState {
+		/// Current layout.
+		VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+		/// Stages of the last accesses.
+		VkPipelineStageFlags stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		/// Last accesses.
+		VkAccessFlags access = 0;
+	};
+
+	/// Pass recording function.
+	using Execute = std::function<void(VkCommandBuffer, const RenderGraph&)>;
+
+	/**
+	 * @brief A pass and its declared accesses.
+	 */
+	class Pass final {
+	public:
+		/**
+		 * @brief Declare a read.
+		 * @param[in] iResource The image.
+		 * @param[in] iUsage The usage.
+		 * @return This pass.
+		 */
+		auto read(ResourceId iResource, Usage iUsage) -> Pass&;
+		/**
+		 * @brief Declare a write.
+		 * @param[in] iResource The image.
+		 * @param[in] iUsage The usage.
+		 * @param[in] iFinalLayout Layout left by the pass (its render pass final layout), undefined if unchanged.
+		 * @return This pass.
+		 */
+		auto write(ResourceId iResource, Usage iUsage, VkImageLayout iFinalLayout = VK_IMAGE_LAYOUT_UNDEFINED)
+				-> Pass&;
+		/**
+		 * @brief Never cull this pass.
+		 * @return This pass.
+		 */
+		auto keep() -> Pass& {
+			m_keep = true;
+			return *this;
+		}
+
+	private:
+		friend class RenderGraph;
+		/**
+		 * @brief Declared access.
+		 */
+		struct Access {
+			/// The image.
+			ResourceId resource = invalidResource;
+			/// The usage.
+			Usage usage = Usage::Sampled;
+			/// Read flag.
+			bool read = false;
+			/// Write flag.
+			bool write = false;
+			/// Layout left by the pass.
+			VkImageLayout finalLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		};
+		/// Pass name.
+		std::string m_name;
+		/// Recording function.
+		Execute m_execute;
+		/// Declared accesses.
+		std::vector<Access> m_accesses;
+		/// Never cull flag.
+		bool m_keep = false;
+	};
+
+	/**
+	 * @brief Statistics of the last rendered frame.
+	 */
+	struct Stats {
+		/// Registered passes.
+		uint32_t passes = 0;
+		/// Culled passes.
+		uint32_t culledPasses = 0;
+		/// Image barriers.
+		uint32_t barriers = 0;
+		/// Transient images.
+		uint32_t transientImages = 0;
+		/// Memory blocks backing the transient images.
+		uint32_t memoryBlocks = 0;
+		/// Memory the transient images would need without aliasing.
+		VkDeviceSize requiredBytes = 0;
+		/// Memory actually allocated.
+		VkDeviceSize allocatedBytes = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iContext The Vulkan context.
+	 */
+	explicit RenderGraph(const VulkanContext& iContext);
+	/**
+	 * @brief Destructor.
+	 */
+	~RenderGraph();
+
+	RenderGraph(const RenderGraph&) = delete;
+	RenderGraph(RenderGraph&&) = delete;
+	auto operator=(const RenderGraph&) -> RenderGraph& = delete;
+	auto operator=(RenderGraph&&) -> RenderGraph& = delete;
+
+	/**
+	 * @brief Use an image owned elsewhere in this frame.
+	 * @param[in] iName Debug name.
+	 * @param[in] iImage The image.
+	 * @param[in] iView The image view.
+	 * @param[in] iDesc The image description.
+	 * @param[in] iState The image state when the frame starts.
+	 * @return The resource handle.
+	 */
+	auto importImage(std::string_view iName, VkImage iImage, VkImageView iView, const ImageDesc& iDesc,
+					 const ImageState& iState) -> ResourceId;
+	/**
+	 * @brief Declare an image living only in this frame, allocated by the graph.
+	 * @param[in] iName Debug name.
+	 * @param[in] iDesc The image description.
+	 * @return The resource handle.
+	 */
+	auto createImage(std::string_view iName, const ImageDesc& iDesc) -> ResourceId;
+	/**
+	 * @brief Mark an image as used after the frame: its writers are never culled.
+	 * @param[in] iResource The image.
+	 */
+	void setOutput(ResourceId iResource);
+	/**
+	 * @brief Add a pass.
+	 * @param[in] iName Debug name.
+	 * @param[in] iExecute The recording function.
+	 * @return The pass, to declare its accesses.
+	 */
+	auto addPass(std::string_view iName, Execute iExecute) -> Pass&;
+
+	/**
+	 * @brief Record the kept passes and start a new frame.
+	 * @param[in] iCommandBuffer The frame command buffer.
+	 */
+	void execute(VkCommandBuffer iCommandBuffer);
+	/**
+	 * @brief Drop the passes of this frame.
+	 */
+	void reset();
+
+	/**
+	 * @brief Get an image, valid while executing.
+	 * @param[in] iResource The image.
+	 * @return The Vulkan image.
+	 */
+	[[nodiscard]] auto getImage(ResourceId iResource) const -> VkImage;
+	/**
+	 * @brief Get an image view, valid while executing.
+	 * @param[in] iResource The image.
+	 * @return The Vulkan image view.
+	 */
+	[[nodiscard]] auto getImageView(ResourceId iResource) const -> VkImageView;
+	/**
+	 * @brief Get the generation of the transient images, changing each time they are reallocated.
+	 * @return The generation.
+	 */
+	[[nodiscard]] auto getGeneration() const -> uint32_t { return m_generation; }
+	/**
+	 * @brief Get the statistics of the last frame.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> const Stats& { return m_stats; }
+
+private:
+	/**
+	 * @brief Image used in the frame.
+	 */
+	struct Resource {
+		/// Debug name.
+		std::string name;
+		/// Description.
+		ImageDesc desc;
+		/// Image.
+		VkImage image = VK_NULL_HANDLE;
+		/// Image view.
+		VkImageView view = VK_NULL_HANDLE;
+		/// Current state.
+		ImageState state;
+		/// Allocated by the graph.
+		bool transient = false;
+		/// Used after the frame.
+		bool output = false;
+		/// Index in the transient allocation (transient only).
+		uint32_t allocation = 0;
+	};
+	/**
+	 * @brief Transient image of the allocation.
+	 */
+	struct TransientImage {
+		/// Description.
+		ImageDesc desc;
+		/// First pass using it.
+		uint32_t first = 0;
+		/// Last pass using it.
+		uint32_t last = 0;
+		/// Image.
+		VkImage image = VK_NULL_HANDLE;
+		/// Image view.
+		VkImageView view = VK_NULL_HANDLE;
+		/// Memory size.
+		VkDeviceSize size = 0;
+		/// Backing memory block.
+		uint32_t block = 0;
+		/// Debug name (of its first resource).
+		std::string name;
+	};
+	/**
+	 * @brief Memory shared by transient images.
+	 */
+	struct MemoryBlock {
+		/// Device memory.
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		/// Block size.
+		VkDeviceSize size = 0;
+		/// Memory types allowed by all the images.
+		uint32_t typeBits = ~0u;
+		/// Last pass using the block.
+		uint32_t last = 0;
+		/// Stages of the last accesses to the block.
+		VkPipelineStageFlags stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		/// Last accesses to the block.
+		VkAccessFlags access = 0;
+	};
+
+	/**
+	 * @brief Flag the passes to keep.
+	 * @return Keep flag of each pass.
+	 */
+	[[nodiscard]] auto cull() const -> std::vector<bool>;
+	/**
+	 * @brief Map the transient images of the kept passes, reallocating them if the frame layout changed.
+	 * @param[in] iKept Keep flag of each pass.
+	 */
+	void allocateTransients(const std::vector<bool>& iKept);
+	/**
+	 * @brief Destroy the transient images.
+	 */
+	void releaseTransients();
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// Images of the frame.
+	std::vector<Resource> m_resources;
+	/// Passes of the frame.
+	std::deque<Pass> m_passes;
+	/// Transient images, reused while the frame layout does not change.
+	std::vector<TransientImage> m_transients;
+	/// Memory blocks of the transient images.
+	std::vector<MemoryBlock> m_blocks;
+	/// Transient images generation.
+	uint32_t m_generation = 0;
+	/// Statistics.
+	Stats m_stats;
+};
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,289 @@
+/**
+ * @file RenderTarget.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "RenderTarget.h"
+
+#include "VulkanContext.h"
+
+#include <backends/imgui_impl_vulkan.h>// NOLINT
+#include <imgui.h>
+
+namespace mvi::core::vulkan {
+
+RenderTarget::RenderTarget(VulkanContext& ioContext, Config iConfig)
+	: m_context{ioContext}, m_config{std::move(iConfig)} {
+	const auto& vkData = m_context.getVkData();
+	m_config.ringSize = std::max(m_config.ringSize, 1u);
+	const bool hasDepth = m_config.depthFormat != VK_FORMAT_UNDEFINED;
+	VkResult err = VK_SUCCESS;
+
+	// Render pass: cleared each frame, color left ready for sampling.
+	{
+		std::array<VkAttachmentDescription, 2> attachments = {};
+		attachments[0].format = m_config.colorFormat;
+		attachments[0].samples = VK_SAMPLE_COUNT_1_BIT;
+		attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		attachments[0].finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		attachments[1].format = m_config.depthFormat;
+		attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
+		attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		attachments[1].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+		const VkAttachmentReference color_ref = {.attachment = 0, .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+		const VkAttachmentReference depth_ref = {.attachment = 1,
+												 .layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+		VkSubpassDescription subpass = {};
+		subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		subpass.colorAttachmentCount = 1;
+		subpass.pColorAttachments = &color_ref;
+		subpass.pDepthStencilAttachment = hasDepth ? &depth_ref : nullptr;
+		std::array<VkSubpassDependency, 2> dependencies = {};
+		dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+		dependencies[0].dstSubpass = 0;
+		dependencies[0].srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		dependencies[0].dstStageMask =
+				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+		dependencies[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		dependencies[0].dstAccessMask =
+				VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+		dependencies[1].srcSubpass = 0;
+		dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+		dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		VkRenderPassCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+		info.attachmentCount = hasDepth ? 2 : 1;
+		info.pAttachments = attachments.data();
+		info.subpassCount = 1;
+		info.pSubpasses = &subpass;
+		info.dependencyCount = static_cast<uint32_t>(dependencies.size());
+		info.pDependencies = dependencies.data();
+		err = vkCreateRenderPass(vkData.device, &info, vkData.allocator, &m_renderPass);
+		VulkanContext::checkVkResult(err);
+	}
+	{
+		VkSamplerCreateInfo sampler_info = {};
+		sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+		sampler_info.magFilter = VK_FILTER_LINEAR;
+		sampler_info.minFilter = VK_FILTER_LINEAR;
+		sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+		sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		sampler_info.minLod = -1000;
+		sampler_info.maxLod = 1000;
+		sampler_info.maxAnisotropy = 1.0f;
+		err = vkCreateSampler(vkData.device, &sampler_info, vkData.allocator, &m_sampler);
+		VulkanContext::checkVkResult(err);
+	}
+}
+
+RenderTarget::~RenderTarget() {
+	// The frames in flight may still use the target: destroyed once they are done.
+	release();
+	auto& deletion = m_context.getDeletionQueue();
+	deletion.destroySampler(m_sampler);
+	deletion.destroyRenderPass(m_renderPass);
+}
+
+void RenderTarget::setResolutionScale(const float iScale) {
+	m_config.resolutionScale = std::clamp(iScale, 0.1f, 4.f);
+}
+
+auto RenderTarget::prepare(const ImVec2& iRegion) -> bool {
+	const ImVec2 framebufferScale = ImGui::GetIO().DisplayFramebufferScale;
+	const auto toPixels = [this](const float iSize, const float iFramebufferScale) -> uint32_t {
+		return static_cast<uint32_t>(std::max(1.f, std::round(iSize * iFramebufferScale * m_config.resolutionScale)));
+	};
+	const VkExtent2D wanted = {.width = toPixels(iRegion.x, framebufferScale.x),
+							   .height = toPixels(iRegion.y, framebufferScale.y)};
+	if (wanted.width != m_pending.width || wanted.height != m_pending.height) {
+		m_pending = wanted;
+		m_stableFrames = 0;
+	} else if (m_stableFrames < m_config.settleFrames) {
+		++m_stableFrames;
+	}
+	const bool sizeChanged = wanted.width != m_extent.width || wanted.height != m_extent.height;
+	if (sizeChanged && (m_slots.empty() || m_stableFrames >= m_config.settleFrames))
+		resize(wanted);
+	if (m_slots.empty())
+		return false;
+	m_current = (m_current + 1) % m_slots.size();
+
+	// The previous content is discarded, the previous sampling of this image must be done.
+	auto& graph = m_context.getRenderGraph();
+	m_preparedFrame = ImGui::GetFrameCount();
+	const auto& slot = m_slots[m_current];
+	m_color = graph.importImage(
+			"offscreen_color", slot.color.image, slot.color.view,
+			{.format = m_config.colorFormat, .extent = m_extent, .usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT},
+			{.layout = VK_IMAGE_LAYOUT_UNDEFINED, .stage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, .access = 0});
+	auto& pass = graph.addPass("offscreen", [this](VkCommandBuffer iCommandBuffer, const RenderGraph& iGraph) -> void {
+		render(iCommandBuffer, iGraph);
+	});
+	pass.write(m_color, RenderGraph::Usage::ColorAttachment, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	if (m_config.retained)
+		pass.keep();
+	m_depth = RenderGraph::invalidResource;
+	if (m_config.depthFormat != VK_FORMAT_UNDEFINED) {
+		m_depth = graph.createImage("offscreen_depth", {.format = m_config.depthFormat,
+														.extent = m_extent,
+														.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT});
+		pass.write(m_depth, RenderGraph::Usage::DepthAttachment);
+	}
+	return true;
+}
+
+void RenderTarget::drawImage(const ImVec2& iSize) const {
+	if (m_slots.empty())
+		return;
+	if (m_preparedFrame == ImGui::GetFrameCount())
+		m_context.sampleInUi(m_color);
+	ImGui::Image(ImTextureRef(reinterpret_cast<ImTextureID>(m_slots[m_current].descriptorSet)), iSize);
+}
+
+void RenderTarget::addImage(ImDrawList* ioDrawList, const ImVec2& iMin, const ImVec2& iMax) const {
+	if (m_slots.empty())
+		return;
+	if (m_preparedFrame == ImGui::GetFrameCount())
+		m_context.sampleInUi(m_color);
+	ioDrawList->AddImage(ImTextureRef(reinterpret_cast<ImTextureID>(m_slots[m_current].descriptorSet)), iMin, iMax);
+}
+
+void RenderTarget::render(VkCommandBuffer iCommandBuffer, const RenderGraph& iGraph) {
+	auto& slot = m_slots[m_current];
+	const VkImageView depthView = iGraph.getImageView(m_depth);
+	if (slot.framebuffer == VK_NULL_HANDLE || slot.framebufferDepth != depthView ||
+		slot.framebufferGeneration != iGraph.getGeneration()) {
+		m_context.getDeletionQueue().destroyFramebuffer(slot.framebuffer);
+		const auto& vkData = m_context.getVkData();
+		const std::array views = {slot.color.view, depthView};
+		VkFramebufferCreateInfo fb_info = {};
+		fb_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+		fb_info.renderPass = m_renderPass;
+		fb_info.attachmentCount = depthView != VK_NULL_HANDLE ? 2 : 1;
+		fb_info.pAttachments = views.data();
+		fb_info.width = m_extent.width;
+		fb_info.height = m_extent.height;
+		fb_info.layers = 1;
+		const VkResult err = vkCreateFramebuffer(vkData.device, &fb_info, vkData.allocator, &slot.framebuffer);
+		VulkanContext::checkVkResult(err);
+		slot.framebufferDepth = depthView;
+		slot.framebufferGeneration = iGraph.getGeneration();
+	}
+	std::array<VkClearValue, 2> clear_values = {};
+	std::ranges::copy(m_config.clearColor, std::begin(clear_values[0].color.float32));
+	clear_values[1].depthStencil = {.depth = 1.f, .stencil = 0};
+	VkRenderPassBeginInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+	info.renderPass = m_renderPass;
+	info.framebuffer = slot.framebuffer;
+	info.renderArea.extent = m_extent;
+	info.clearValueCount = m_config.depthFormat != VK_FORMAT_UNDEFINED ? 2 : 1;
+	info.pClearValues = clear_values.data();
+	vkCmdBeginRenderPass(iCommandBuffer, &info, VK_SUBPASS_CONTENTS_INLINE);
+	if (m_recorder) {
+		const VkViewport viewport = {.x = 0.f,
+									 .y = 0.f,
+									 .width = static_cast<float>(m_extent.width),
+									 .height = static_cast<float>(m_extent.height),
+									 .minDepth = 0.f,
+									 .maxDepth = 1.f};
+		vkCmdSetViewport(iCommandBuffer, 0, 1, &viewport);
+		const VkRect2D scissor = {.offset = {.x = 0, .y = 0}, .extent = m_extent};
+		vkCmdSetScissor(iCommandBuffer, 0, 1, &scissor);
+		m_recorder(iCommandBuffer, *this);
+	}
+	vkCmdEndRenderPass(iCommandBuffer);
+}
+
+void RenderTarget::createAttachment(Attachment& oAttachment) {
+	const auto& vkData = m_context.getVkData();
+	VkImageCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	info.imageType = VK_IMAGE_TYPE_2D;
+	info.format = m_config.colorFormat;
+	info.extent = {.width = m_extent.width, .height = m_extent.height, .depth = 1};
+	info.mipLevels = 1;
+	info.arrayLayers = 1;
+	info.samples = VK_SAMPLE_COUNT_1_BIT;
+	info.tiling = VK_IMAGE_TILING_OPTIMAL;
+	info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	VkResult err = vkCreateImage(vkData.device, &info, vkData.allocator, &oAttachment.image);
+	VulkanContext::checkVkResult(err);
+	VkMemoryRequirements requirements;
+	vkGetImageMemoryRequirements(vkData.device, oAttachment.image, &requirements);
+	VkMemoryAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.allocationSize = requirements.size;
+	alloc_info.memoryTypeIndex =
+			m_context.findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+	err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &oAttachment.memory);
+	VulkanContext::checkVkResult(err);
+	err = vkBindImageMemory(vkData.device, oAttachment.image, oAttachment.memory, 0);
+	VulkanContext::checkVkResult(err);
+	m_memorySize += requirements.size;
+
+	VkImageViewCreateInfo view_info = {};
+	view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	view_info.image = oAttachment.image;
+	view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	view_info.format = m_config.colorFormat;
+	view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	view_info.subresourceRange.levelCount = 1;
+	view_info.subresourceRange.layerCount = 1;
+	err = vkCreateImageView(vkData.device, &view_info, vkData.allocator, &oAttachment.view);
+	VulkanContext::checkVkResult(err);
+}
+
+void RenderTarget::destroyAttachment(Attachment& ioAttachment) const {
+	auto& deletion = m_context.getDeletionQueue();
+	deletion.destroyImageView(ioAttachment.view);
+	deletion.destroyImage(ioAttachment.image);
+	deletion.freeMemory(ioAttachment.memory);
+	ioAttachment = {};
+}
+
+void RenderTarget::resize(const VkExtent2D iExtent) {
+	// The old images stay alive until the frames in flight are done with them.
+	release();
+	m_extent = iExtent;
+	++m_resizeCount;
+	m_slots.resize(m_config.ringSize);
+	for (auto& slot: m_slots) {
+		createAttachment(slot.color);
+		slot.descriptorSet =
+				ImGui_ImplVulkan_AddTexture(m_sampler, slot.color.view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	}
+	m_current = 0;
+}
+
+void RenderTarget::release() {
+	auto& deletion = m_context.getDeletionQueue();
+	for (auto& slot: m_slots) {
+		deletion.removeTexture(slot.descriptorSet);
+		deletion.destroyFramebuffer(slot.framebuffer);
+		destroyAttachment(slot.color);
+	}
+	m_slots.clear();
+	m_memorySize = 0;
+}
+
+}// namespace mvi::core::vulkan
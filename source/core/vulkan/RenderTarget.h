@@ -0,0 +1,224 @@
+/**
+ * @file RenderTarget.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "RenderGraph.h"
+#include "vkData.h"
+
+#include <array>
+#include <functional>
+#include <vector>
+
+struct ImDrawList;
+struct ImVec2;
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Offscreen color/depth target displayed inside a view.
+ *
+ * The owner calls prepare() with its ImGui content region each frame, registers a recorder drawing
+ * into the target, then shows it with drawImage(). prepare() adds a pass to the frame graph, running
+ * the recorder inside a render pass covering the whole target; it is culled if the image is not drawn.
+ *
+ * One color image per frame in flight is kept, so a frame never draws into an image still sampled by
+ * a previous one. The depth buffer is a transient image of the frame graph, sharing its memory with
+ * the other targets. The size follows the region only once it has settled for a few frames: while the
+ * user drags a splitter, the last image is stretched instead of reallocating every frame.
+ */
+class RenderTarget final {
+public:
+	/**
+	 * @brief Target configuration.
+	 */
+	struct Config {
+		/// Color format.
+		VkFormat colorFormat = VK_FORMAT_R8G8B8A8_UNORM;
+		/// Depth format (VK_FORMAT_UNDEFINED for none).
+		VkFormat depthFormat = VK_FORMAT_D32_SFLOAT;
+		/// Number of images (frames in flight).
+		uint32_t ringSize = 3;
+		/// Ratio between the target and the displayed pixels.
+		float resolutionScale = 1.f;
+		/// Frames the region must keep its size before the target follows.
+		uint32_t settleFrames = 8;
+		/// Clear color.
+		std::array<float, 4> clearColor = {0.f, 0.f, 0.f, 1.f};
+		/// Content kept across frames: the pass is never culled and the image is shown until the next prepare().
+		bool retained = false;
+	};
+	/// Function recording the target content.
+	using Recorder = std::function<void(VkCommandBuffer, const RenderTarget&)>;
+
+	/**
+	 * @brief Constructor: create the render pass.
+	 * @param[in,out] ioContext The Vulkan context.
+	 * @param[in] iConfig The configuration.
+	 */
+	RenderTarget(VulkanContext& ioContext, Config iConfig);
+	/**
+	 * @brief Destructor.
+	 */
+	~RenderTarget();
+
+	RenderTarget(const RenderTarget&) = delete;
+	RenderTarget(RenderTarget&&) = delete;
+	auto operator=(const RenderTarget&) -> RenderTarget& = delete;
+	auto operator=(RenderTarget&&) -> RenderTarget& = delete;
+
+	/**
+	 * @brief Define the function recording the target content.
+	 * @param[in] iRecorder The recorder.
+	 */
+	void setRecorder(Recorder iRecorder) { m_recorder = std::move(iRecorder); }
+	/**
+	 * @brief Change the resolution scale (applied with the next resize).
+	 * @param[in] iScale The new scale.
+	 */
+	void setResolutionScale(float iScale);
+	/**
+	 * @brief Change the clear color (applied with the next prepare()).
+	 * @param[in] iColor The clear color.
+	 */
+	void setClearColor(const std::array<float, 4>& iColor) { m_config.clearColor = iColor; }
+	/**
+	 * @brief Get the resolution scale.
+	 * @return The resolution scale.
+	 */
+	[[nodiscard]] auto getResolutionScale() const -> float { return m_config.resolutionScale; }
+
+	/**
+	 * @brief Request the target for this frame, following the displayed region.
+	 * @param[in] iRegion The displayed region, in ImGui units.
+	 * @return True if the target can be drawn this frame.
+	 */
+	auto prepare(const ImVec2& iRegion) -> bool;
+	/**
+	 * @brief Display the current image.
+	 * @param[in] iSize The displayed size, in ImGui units.
+	 */
+	void drawImage(const ImVec2& iSize) const;
+	/**
+	 * @brief Display the current image in a draw list.
+	 * @param[in,out] ioDrawList The draw list.
+	 * @param[in] iMin The top left corner, in screen coordinates.
+	 * @param[in] iMax The bottom right corner, in screen coordinates.
+	 */
+	void addImage(ImDrawList* ioDrawList, const ImVec2& iMin, const ImVec2& iMax) const;
+
+	/**
+	 * @brief Get the render pass, compatible with the pipelines drawing into the target.
+	 * @return The render pass.
+	 */
+	[[nodiscard]] auto getRenderPass() const -> VkRenderPass { return m_renderPass; }
+	/**
+	 * @brief Get the target size in pixels.
+	 * @return The size.
+	 */
+	[[nodiscard]] auto getExtent() const -> VkExtent2D { return m_extent; }
+	/**
+	 * @brief Get the memory held by the color images.
+	 * @return The memory size in bytes.
+	 */
+	[[nodiscard]] auto getMemorySize() const -> VkDeviceSize { return m_memorySize; }
+	/**
+	 * @brief Get the number of reallocations.
+	 * @return The number of resizes.
+	 */
+	[[nodiscard]] auto getResizeCount() const -> uint32_t { return m_resizeCount; }
+
+private:
+	/**
+	 * @brief Image, memory and view.
+	 */
+	struct Attachment {
+		/// The image.
+		VkImage image = VK_NULL_HANDLE;
+		/// The image memory.
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		/// The image view.
+		VkImageView view = VK_NULL_HANDLE;
+	};
+	/**
+	 * @brief One image of the ring.
+	 */
+	struct Slot {
+		/// Color attachment.
+		Attachment color;
+		/// Framebuffer.
+		VkFramebuffer framebuffer = VK_NULL_HANDLE;
+		/// Depth image view used by the framebuffer.
+		VkImageView framebufferDepth = VK_NULL_HANDLE;
+		/// Frame graph generation of the depth view.
+		uint32_t framebufferGeneration = 0;
+		/// ImGui texture.
+		VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+	};
+
+	/**
+	 * @brief Record the target pass.
+	 * @param[in] iCommandBuffer The frame command buffer.
+	 * @param[in] iGraph The frame graph.
+	 */
+	void render(VkCommandBuffer iCommandBuffer, const RenderGraph& iGraph);
+	/**
+	 * @brief Create a color attachment.
+	 * @param[out] oAttachment The attachment.
+	 */
+	void createAttachment(Attachment& oAttachment);
+	/**
+	 * @brief Destroy an attachment.
+	 * @param[in,out] ioAttachment The attachment.
+	 */
+	void destroyAttachment(Attachment& ioAttachment) const;
+	/**
+	 * @brief Reallocate the ring.
+	 * @param[in] iExtent The new size.
+	 */
+	void resize(VkExtent2D iExtent);
+	/**
+	 * @brief Destroy the ring.
+	 */
+	void release();
+
+	/// The Vulkan context.
+	VulkanContext& m_context;
+	/// The configuration.
+	Config m_config;
+	/// The render pass.
+	VkRenderPass m_renderPass = VK_NULL_HANDLE;
+	/// Sampler of the displayed images.
+	VkSampler m_sampler = VK_NULL_HANDLE;
+	/// The ring.
+	std::vector<Slot> m_slots;
+	/// Current slot.
+	size_t m_current = 0;
+	/// Current size.
+	VkExtent2D m_extent = {.width = 0, .height = 0};
+	/// Size requested by the region.
+	VkExtent2D m_pending = {.width = 0, .height = 0};
+	/// Frames the requested size was stable.
+	uint32_t m_stableFrames = 0;
+	/// Color image in the frame graph.
+	RenderGraph::ResourceId m_color = RenderGraph::invalidResource;
+	/// Depth image in the frame graph.
+	RenderGraph::ResourceId m_depth = RenderGraph::invalidResource;
+	/// ImGui frame of the last prepare().
+	int m_preparedFrame = -1;
+	/// The recorder.
+	Recorder m_recorder;
+	/// Image memory.
+	VkDeviceSize m_memorySize = 0;
+	/// Number of reallocations.
+	uint32_t m_resizeCount = 0;
+};
+
+}// namespace mvi::core::vulkan
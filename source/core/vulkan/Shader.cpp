@@ -0,0 +1,59 @@
+/**
+ * @file Shader.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Shader.h"
+
+#include "VulkanContext.h"
+#include "core/Log.h"
+
+#include <shaderc/shaderc.hpp>
+
+namespace mvi::core::vulkan {
+
+auto compileShader(const std::string_view iSource, const ShaderStage iStage, const std::string& iName)
+		-> std::vector<uint32_t> {
+	shaderc_shader_kind kind = shaderc_glsl_vertex_shader;
+	switch (iStage) {
+		case ShaderStage::Vertex:
+			kind = shaderc_glsl_vertex_shader;
+			break;
+		case ShaderStage::Fragment:
+			kind = shaderc_glsl_fragment_shader;
+			break;
+		case ShaderStage::Compute:
+			kind = shaderc_glsl_compute_shader;
+			break;
+	}
+	const shaderc::Compiler compiler;
+	shaderc::CompileOptions options;
+	// The instance is created without application info, so for Vulkan 1.0: SPIR-V 1.0 modules only.
+	options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_0);
+	options.SetOptimizationLevel(shaderc_optimization_level_performance);
+	const auto result = compiler.CompileGlslToSpv(iSource.data(), iSource.size(), kind, iName.c_str(), options);
+	if (result.GetCompilationStatus() != shaderc_compilation_status_success) {
+		log_error("Shader '{}' compilation failed: {}", iName, result.GetErrorMessage());
+		return {};
+	}
+	return {result.cbegin(), result.cend()};
+}
+
+auto createShaderModule(const VkData& iData, const std::span<const uint32_t> iCode) -> VkShaderModule {
+	if (iCode.empty())
+		return VK_NULL_HANDLE;
+	const VkShaderModuleCreateInfo info{.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+										.pNext = nullptr,
+										.flags = 0,
+										.codeSize = iCode.size_bytes(),
+										.pCode = iCode.data()};
+	VkShaderModule module = VK_NULL_HANDLE;
+	VulkanContext::checkVkResult(vkCreateShaderModule(iData.device, &info, iData.allocator, &module));
+	return module;
+}
+
+}// namespace mvi::core::vulkan
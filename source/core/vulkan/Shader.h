@@ -0,0 +1,50 @@
+/**
+ * @file Shader.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "vkData.h"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mvi::core::vulkan {
+
+/**
+ * @brief Shader stages.
+ */
+enum struct ShaderStage : uint8_t {
+	/// Vertex shader.
+	Vertex,
+	/// Fragment shader.
+	Fragment,
+	/// Compute shader.
+	Compute,
+};
+
+/**
+ * @brief Compile a GLSL shader to SPIR-V, for Vulkan 1.0.
+ * @param[in] iSource The GLSL source.
+ * @param[in] iStage The shader stage.
+ * @param[in] iName The shader name, for error messages.
+ * @return The SPIR-V code, empty on error.
+ */
+[[nodiscard]] auto compileShader(std::string_view iSource, ShaderStage iStage, const std::string& iName)
+		-> std::vector<uint32_t>;
+
+/**
+ * @brief Create a shader module.
+ * @param[in] iData The Vulkan data.
+ * @param[in] iCode The SPIR-V code.
+ * @return The shader module, VK_NULL_HANDLE on error.
+ */
+[[nodiscard]] auto createShaderModule(const VkData& iData, std::span<const uint32_t> iCode) -> VkShaderModule;
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,159 @@
+/**
+ * @file Texture.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Texture.h"
+
+#include "VulkanContext.h"
+
+#include <backends/imgui_impl_vulkan.h>// NOLINT
+#include <cstring>
+
+namespace mvi::core::vulkan {
+
+Texture::Texture(const VulkanContext& iContext, const uint32_t iWidth, const uint32_t iHeight,
+				 const std::span<const uint8_t> iPixels)
+	: m_context{iContext}, m_width{iWidth}, m_height{iHeight} {
+	const auto& vkData = m_context.getVkData();
+	VkResult err = VK_SUCCESS;
+
+	// Create the image
+	{
+		VkImageCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		info.imageType = VK_IMAGE_TYPE_2D;
+		info.format = VK_FORMAT_R8G8B8A8_UNORM;
+		info.extent = {.width = m_width, .height = m_height, .depth = 1};
+		info.mipLevels = 1;
+		info.arrayLayers = 1;
+		info.samples = VK_SAMPLE_COUNT_1_BIT;
+		info.tiling = VK_IMAGE_TILING_OPTIMAL;
+		info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+		info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		err = vkCreateImage(vkData.device, &info, vkData.allocator, &m_image);
+		VulkanContext::checkVkResult(err);
+		VkMemoryRequirements requirements;
+		vkGetImageMemoryRequirements(vkData.device, m_image, &requirements);
+		VkMemoryAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		alloc_info.allocationSize = requirements.size;
+		alloc_info.memoryTypeIndex =
+				m_context.findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+		err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &m_memory);
+		VulkanContext::checkVkResult(err);
+		err = vkBindImageMemory(vkData.device, m_image, m_memory, 0);
+		VulkanContext::checkVkResult(err);
+		m_memorySize = requirements.size;
+	}
+
+	// Create the image view and sampler
+	{
+		VkImageViewCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		info.image = m_image;
+		info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		info.format = VK_FORMAT_R8G8B8A8_UNORM;
+		info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		info.subresourceRange.levelCount = 1;
+		info.subresourceRange.layerCount = 1;
+		err = vkCreateImageView(vkData.device, &info, vkData.allocator, &m_view);
+		VulkanContext::checkVkResult(err);
+
+		VkSamplerCreateInfo sampler_info = {};
+		sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+		sampler_info.magFilter = VK_FILTER_LINEAR;
+		sampler_info.minFilter = VK_FILTER_LINEAR;
+		sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+		sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+		sampler_info.minLod = -1000;
+		sampler_info.maxLod = 1000;
+		sampler_info.maxAnisotropy = 1.0f;
+		err = vkCreateSampler(vkData.device, &sampler_info, vkData.allocator, &m_sampler);
+		VulkanContext::checkVkResult(err);
+	}
+
+	// Upload the pixels through a staging buffer
+	{
+		VkBuffer staging = VK_NULL_HANDLE;
+		VkDeviceMemory stagingMemory = VK_NULL_HANDLE;
+		VkBufferCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		info.size = iPixels.size();
+		info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+		info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		err = vkCreateBuffer(vkData.device, &info, vkData.allocator, &staging);
+		VulkanContext::checkVkResult(err);
+		VkMemoryRequirements requirements;
+		vkGetBufferMemoryRequirements(vkData.device, staging, &requirements);
+		VkMemoryAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		alloc_info.allocationSize = requirements.size;
+		alloc_info.memoryTypeIndex =
+				m_context.findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+																			  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+		err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &stagingMemory);
+		VulkanContext::checkVkResult(err);
+		err = vkBindBufferMemory(vkData.device, staging, stagingMemory, 0);
+		VulkanContext::checkVkResult(err);
+		void* mapped = nullptr;
+		err = vkMapMemory(vkData.device, stagingMemory, 0, iPixels.size(), 0, &mapped);
+		VulkanContext::checkVkResult(err);
+		std::memcpy(mapped, iPixels.data(), iPixels.size());
+		vkUnmapMemory(vkData.device, stagingMemory);
+
+		m_context.immediateSubmit([this, staging](VkCommandBuffer iCommandBuffer) {
+			VkImageMemoryBarrier barrier = {};
+			barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.image = m_image;
+			barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			barrier.subresourceRange.levelCount = 1;
+			barrier.subresourceRange.layerCount = 1;
+			vkCmdPipelineBarrier(iCommandBuffer, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+								 nullptr, 0, nullptr, 1, &barrier);
+
+			VkBufferImageCopy region = {};
+			region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			region.imageSubresource.layerCount = 1;
+			region.imageExtent = {.width = m_width, .height = m_height, .depth = 1};
+			vkCmdCopyBufferToImage(iCommandBuffer, staging, m_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			vkCmdPipelineBarrier(iCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+								 0, 0, nullptr, 0, nullptr, 1, &barrier);
+		});
+		vkDestroyBuffer(vkData.device, staging, vkData.allocator);
+		vkFreeMemory(vkData.device, stagingMemory, vkData.allocator);
+	}
+
+	m_descriptorSet = ImGui_ImplVulkan_AddTexture(m_sampler, m_view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+}
+
+Texture::~Texture() {
+	// The texture can be released mid-session: the frames in flight may still sample it.
+	auto& deletion = m_context.getDeletionQueue();
+	deletion.removeTexture(m_descriptorSet);
+	deletion.destroySampler(m_sampler);
+	deletion.destroyImageView(m_view);
+	deletion.destroyImage(m_image);
+	deletion.freeMemory(m_memory);
+}
+
+auto Texture::getTextureId() const -> uint64_t { return reinterpret_cast<uint64_t>(m_descriptorSet); }
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,86 @@
+/**
+ * @file Texture.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "vkData.h"
+
+#include <span>
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Sampled RGBA8 texture usable in ImGui draw commands.
+ */
+class Texture final {
+public:
+	/**
+	 * @brief Constructor: create the image and upload the pixels.
+	 * @param[in] iContext The Vulkan context.
+	 * @param[in] iWidth The texture width.
+	 * @param[in] iHeight The texture height.
+	 * @param[in] iPixels The RGBA8 pixels.
+	 */
+	Texture(const VulkanContext& iContext, uint32_t iWidth, uint32_t iHeight, std::span<const uint8_t> iPixels);
+	/**
+	 * @brief Destructor.
+	 *
+	 * @note The texture must no longer be used by the GPU.
+	 */
+	~Texture();
+
+	Texture(const Texture&) = delete;
+	Texture(Texture&&) = delete;
+	auto operator=(const Texture&) -> Texture& = delete;
+	auto operator=(Texture&&) -> Texture& = delete;
+
+	/**
+	 * @brief Get the ImGui texture identifier (the descriptor set).
+	 * @return The texture identifier.
+	 */
+	[[nodiscard]] auto getTextureId() const -> uint64_t;
+	/**
+	 * @brief Get the texture width.
+	 * @return The width.
+	 */
+	[[nodiscard]] auto getWidth() const -> uint32_t { return m_width; }
+	/**
+	 * @brief Get the texture height.
+	 * @return The height.
+	 */
+	[[nodiscard]] auto getHeight() const -> uint32_t { return m_height; }
+	/**
+	 * @brief Get the device memory used by the texture.
+	 * @return The memory size in bytes.
+	 */
+	[[nodiscard]] auto getMemorySize() const -> uint64_t { return m_memorySize; }
+
+private:
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// Width.
+	uint32_t m_width = 0;
+	/// Height.
+	uint32_t m_height = 0;
+	/// Image.
+	VkImage m_image = VK_NULL_HANDLE;
+	/// Image memory.
+	VkDeviceMemory m_memory = VK_NULL_HANDLE;
+	/// Image memory size.
+	uint64_t m_memorySize = 0;
+	/// Image view.
+	VkImageView m_view = VK_NULL_HANDLE;
+	/// Sampler.
+	VkSampler m_sampler = VK_NULL_HANDLE;
+	/// ImGui descriptor set.
+	VkDescriptorSet m_descriptorSet = VK_NULL_HANDLE;
+};
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,358 @@
+/**
+ * @file TextureUploader.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "TextureUploader.h"
+
+#include "VulkanContext.h"
+
+#include <algorithm>
+#include <backends/imgui_impl_vulkan.h>// NOLINT
+#include <bit>
+#include <cstring>
+
+namespace mvi::core::vulkan {
+
+namespace {
+
+/// Minimal staging size, to avoid reallocating for each new glyph.
+constexpr VkDeviceSize g_minStagingSize = 256ull * 1024ull;
+/// Alignment of the regions in the staging buffer.
+constexpr VkDeviceSize g_regionAlignment = 4;
+
+/**
+ * @brief Round up a staging offset to the region alignment.
+ * @param[in] iOffset The offset.
+ * @return The aligned offset.
+ */
+auto alignRegion(const VkDeviceSize iOffset) -> VkDeviceSize {
+	return (iOffset + g_regionAlignment - 1) & ~(g_regionAlignment - 1);
+}
+
+}// namespace
+
+TextureUploader::TextureUploader(const VulkanContext& iContext) : m_context{iContext} {
+	const auto& vkData = m_context.getVkData();
+	VkCommandPoolCreateInfo pool_info = {};
+	pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+	pool_info.queueFamilyIndex = vkData.queueFamily;
+	VkResult err = vkCreateCommandPool(vkData.device, &pool_info, vkData.allocator, &m_commandPool);
+	VulkanContext::checkVkResult(err);
+	m_context.getDebugUtils().setName(VK_OBJECT_TYPE_COMMAND_POOL, m_commandPool, "texture upload command pool");
+
+	VkSamplerCreateInfo sampler_info = {};
+	sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+	sampler_info.magFilter = VK_FILTER_LINEAR;
+	sampler_info.minFilter = VK_FILTER_LINEAR;
+	sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+	sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	sampler_info.minLod = -1000;
+	sampler_info.maxLod = 1000;
+	sampler_info.maxAnisotropy = 1.0f;
+	err = vkCreateSampler(vkData.device, &sampler_info, vkData.allocator, &m_sampler);
+	VulkanContext::checkVkResult(err);
+	m_context.getDebugUtils().setName(VK_OBJECT_TYPE_SAMPLER, m_sampler, "imgui texture sampler");
+}
+
+TextureUploader::~TextureUploader() {
+	const auto& vkData = m_context.getVkData();
+	for (auto& batch: m_batches) {
+		releaseStaging(batch);
+		vkFreeCommandBuffers(vkData.device, m_commandPool, 1, &batch.commandBuffer);
+	}
+	vkDestroySampler(vkData.device, m_sampler, vkData.allocator);
+	vkDestroyCommandPool(vkData.device, m_commandPool, vkData.allocator);
+}
+
+void TextureUploader::update(ImVector<ImTextureData*>& ioTextures) {
+	m_stats.rects = 0;
+	m_stats.bytes = 0;
+	// Whole batch size first: it goes into a single staging buffer.
+	VkDeviceSize size = 0;
+	for (ImTextureData* texture: ioTextures) {
+		if (texture->Status == ImTextureStatus_WantDestroy) {
+			destroy(*texture);
+			continue;
+		}
+		if (texture->Status != ImTextureStatus_WantCreate && texture->Status != ImTextureStatus_WantUpdates)
+			continue;
+		collectRects(*texture);
+		for (const auto& rect: m_rects)
+			size = alignRegion(size) + VkDeviceSize{rect.w} * rect.h * static_cast<VkDeviceSize>(texture->BytesPerPixel);
+	}
+	m_stats.textures = static_cast<uint32_t>(m_images.size());
+	if (size == 0)
+		return;
+
+	Batch& batch = acquireBatch(size);
+	m_copies.clear();
+	m_regions.clear();
+	VkDeviceSize offset = 0;
+	for (ImTextureData* texture: ioTextures) {
+		if (texture->Status != ImTextureStatus_WantCreate && texture->Status != ImTextureStatus_WantUpdates)
+			continue;
+		Image& image = texture->Status == ImTextureStatus_WantCreate ? create(*texture) : m_images.at(texture);
+		collectRects(*texture);
+		const auto firstRegion = static_cast<uint32_t>(m_regions.size());
+		for (const auto& rect: m_rects) {
+			offset = alignRegion(offset);
+			const size_t rowBytes = size_t{rect.w} * static_cast<size_t>(texture->BytesPerPixel);
+			auto* destination = static_cast<uint8_t*>(batch.mapped) + offset;
+			for (int row = 0; row < rect.h; ++row)
+				std::memcpy(destination + static_cast<size_t>(row) * rowBytes, texture->GetPixelsAt(rect.x, rect.y + row),
+							rowBytes);
+			VkBufferImageCopy region = {};
+			region.bufferOffset = offset;
+			region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			region.imageSubresource.layerCount = 1;
+			region.imageOffset = {.x = rect.x, .y = rect.y, .z = 0};
+			region.imageExtent = {.width = rect.w, .height = rect.h, .depth = 1};
+			m_regions.push_back(region);
+			offset += rowBytes * rect.h;
+		}
+		m_copies.push_back({.image = image.image,
+							.firstRegion = firstRegion,
+							.regionCount = static_cast<uint32_t>(m_regions.size()) - firstRegion,
+							.initialized = image.initialized});
+		image.initialized = true;
+		texture->SetStatus(ImTextureStatus_OK);
+	}
+	m_stats.textures = static_cast<uint32_t>(m_images.size());
+	m_stats.rects = static_cast<uint32_t>(m_regions.size());
+	m_stats.bytes = offset;
+	m_stats.totalBytes += offset;
+	++m_stats.batches;
+
+	// One barrier for all the images, the copies, and one barrier back to the shaders.
+	const auto& vkData = m_context.getVkData();
+	VkCommandBufferBeginInfo begin_info = {};
+	begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	VkResult err = vkBeginCommandBuffer(batch.commandBuffer, &begin_info);
+	VulkanContext::checkVkResult(err);
+	{
+		const DebugUtils::ScopedLabel label(m_context.getDebugUtils(), batch.commandBuffer, "texture uploads");
+		m_barriers.clear();
+		for (const auto& copy: m_copies) {
+			VkImageMemoryBarrier barrier = {};
+			barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			// Partial updates keep the rest of the image.
+			barrier.oldLayout =
+					copy.initialized ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_UNDEFINED;
+			barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barrier.image = copy.image;
+			barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			barrier.subresourceRange.levelCount = 1;
+			barrier.subresourceRange.layerCount = 1;
+			m_barriers.push_back(barrier);
+		}
+		vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+							 0, 0, nullptr, 0, nullptr, static_cast<uint32_t>(m_barriers.size()), m_barriers.data());
+		for (const auto& copy: m_copies)
+			vkCmdCopyBufferToImage(batch.commandBuffer, batch.buffer, copy.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+								   copy.regionCount, m_regions.data() + copy.firstRegion);
+		for (auto& barrier: m_barriers) {
+			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		}
+		vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+							 0, 0, nullptr, 0, nullptr, static_cast<uint32_t>(m_barriers.size()), m_barriers.data());
+	}
+	err = vkEndCommandBuffer(batch.commandBuffer);
+	VulkanContext::checkVkResult(err);
+
+	// Submitted before the frame on the same queue: no semaphore needed, the frame fence covers it.
+	VkSubmitInfo submit_info = {};
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &batch.commandBuffer;
+	err = vkQueueSubmit(vkData.queue, 1, &submit_info, VK_NULL_HANDLE);
+	VulkanContext::checkVkResult(err);
+	batch.frame = m_context.getFrameSerial();
+}
+
+void TextureUploader::release() {
+	auto& deletion = m_context.getDeletionQueue();
+	for (auto& [texture, image]: m_images) {
+		deletion.removeTexture(image.descriptorSet);
+		deletion.destroyImageView(image.view);
+		deletion.destroyImage(image.image);
+		deletion.freeMemory(image.memory);
+		texture->SetTexID(ImTextureID_Invalid);
+		texture->BackendUserData = nullptr;
+		texture->SetStatus(ImTextureStatus_Destroyed);
+	}
+	m_images.clear();
+	m_stats.textures = 0;
+}
+
+auto TextureUploader::create(ImTextureData& ioTexture) -> Image& {
+	const auto& vkData = m_context.getVkData();
+	Image& image = m_images[&ioTexture];
+	// Alpha only textures are sampled as white, with the alpha from the red channel.
+	const bool alpha = ioTexture.Format == ImTextureFormat_Alpha8;
+	const VkFormat format = alpha ? VK_FORMAT_R8_UNORM : VK_FORMAT_R8G8B8A8_UNORM;
+	VkResult err = VK_SUCCESS;
+	{
+		VkImageCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		info.imageType = VK_IMAGE_TYPE_2D;
+		info.format = format;
+		info.extent = {.width = static_cast<uint32_t>(ioTexture.Width),
+					   .height = static_cast<uint32_t>(ioTexture.Height),
+					   .depth = 1};
+		info.mipLevels = 1;
+		info.arrayLayers = 1;
+		info.samples = VK_SAMPLE_COUNT_1_BIT;
+		info.tiling = VK_IMAGE_TILING_OPTIMAL;
+		info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+		info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		err = vkCreateImage(vkData.device, &info, vkData.allocator, &image.image);
+		VulkanContext::checkVkResult(err);
+		VkMemoryRequirements requirements;
+		vkGetImageMemoryRequirements(vkData.device, image.image, &requirements);
+		VkMemoryAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		alloc_info.allocationSize = requirements.size;
+		alloc_info.memoryTypeIndex =
+				m_context.findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+		err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &image.memory);
+		VulkanContext::checkVkResult(err);
+		err = vkBindImageMemory(vkData.device, image.image, image.memory, 0);
+		VulkanContext::checkVkResult(err);
+	}
+	{
+		VkImageViewCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		info.image = image.image;
+		info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		info.format = format;
+		if (alpha)
+			info.components = {.r = VK_COMPONENT_SWIZZLE_ONE,
+							   .g = VK_COMPONENT_SWIZZLE_ONE,
+							   .b = VK_COMPONENT_SWIZZLE_ONE,
+							   .a = VK_COMPONENT_SWIZZLE_R};
+		info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		info.subresourceRange.levelCount = 1;
+		info.subresourceRange.layerCount = 1;
+		err = vkCreateImageView(vkData.device, &info, vkData.allocator, &image.view);
+		VulkanContext::checkVkResult(err);
+	}
+	const auto& debug = m_context.getDebugUtils();
+	debug.setName(VK_OBJECT_TYPE_IMAGE, image.image, std::format("imgui texture {}", ioTexture.UniqueID));
+	debug.setName(VK_OBJECT_TYPE_IMAGE_VIEW, image.view, std::format("imgui texture {}", ioTexture.UniqueID));
+
+	image.descriptorSet = ImGui_ImplVulkan_AddTexture(m_sampler, image.view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	ioTexture.SetTexID(reinterpret_cast<ImTextureID>(image.descriptorSet));
+	ioTexture.BackendUserData = &image;
+	return image;
+}
+
+void TextureUploader::destroy(ImTextureData& ioTexture) {
+	if (const auto itImage = m_images.find(&ioTexture); itImage != m_images.end()) {
+		// The frames in flight may still sample it.
+		auto& deletion = m_context.getDeletionQueue();
+		deletion.removeTexture(itImage->second.descriptorSet);
+		deletion.destroyImageView(itImage->second.view);
+		deletion.destroyImage(itImage->second.image);
+		deletion.freeMemory(itImage->second.memory);
+		m_images.erase(itImage);
+	}
+	ioTexture.SetTexID(ImTextureID_Invalid);
+	ioTexture.BackendUserData = nullptr;
+	ioTexture.SetStatus(ImTextureStatus_Destroyed);
+}
+
+void TextureUploader::collectRects(const ImTextureData& iTexture) {
+	m_rects.clear();
+	if (iTexture.Status == ImTextureStatus_WantCreate) {
+		m_rects.push_back({.x = 0,
+						   .y = 0,
+						   .w = static_cast<unsigned short>(iTexture.Width),
+						   .h = static_cast<unsigned short>(iTexture.Height)});
+		return;
+	}
+	// Each rectangle (new glyphs) rather than their bounding box.
+	if (iTexture.Updates.empty())
+		m_rects.push_back(iTexture.UpdateRect);
+	else
+		m_rects.assign(iTexture.Updates.begin(), iTexture.Updates.end());
+	std::erase_if(m_rects, [](const ImTextureRect& iRect) -> bool { return iRect.w == 0 || iRect.h == 0; });
+}
+
+auto TextureUploader::acquireBatch(const VkDeviceSize iSize) -> Batch& {
+	const auto& vkData = m_context.getVkData();
+	auto itBatch = std::ranges::find_if(
+			m_batches, [this](const Batch& iBatch) -> bool { return iBatch.frame <= m_context.getCompletedFrame(); });
+	if (itBatch == m_batches.end()) {
+		Batch& batch = m_batches.emplace_back();
+		VkCommandBufferAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		alloc_info.commandPool = m_commandPool;
+		alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		alloc_info.commandBufferCount = 1;
+		const VkResult err = vkAllocateCommandBuffers(vkData.device, &alloc_info, &batch.commandBuffer);
+		VulkanContext::checkVkResult(err);
+		m_context.getDebugUtils().setName(VK_OBJECT_TYPE_COMMAND_BUFFER, batch.commandBuffer,
+										  std::format("texture upload {}", m_batches.size()));
+		itBatch = std::prev(m_batches.end());
+	}
+	Batch& batch = *itBatch;
+	if (batch.size >= iSize)
+		return batch;
+
+	// The GPU is done with the previous staging buffer.
+	releaseStaging(batch);
+	batch.size = std::max({iSize, g_minStagingSize, std::bit_ceil(iSize)});
+	VkBufferCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	info.size = batch.size;
+	info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	VkResult err = vkCreateBuffer(vkData.device, &info, vkData.allocator, &batch.buffer);
+	VulkanContext::checkVkResult(err);
+	VkMemoryRequirements requirements;
+	vkGetBufferMemoryRequirements(vkData.device, batch.buffer, &requirements);
+	VkMemoryAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.allocationSize = requirements.size;
+	alloc_info.memoryTypeIndex = m_context.findMemoryType(
+			requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+	err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &batch.memory);
+	VulkanContext::checkVkResult(err);
+	err = vkBindBufferMemory(vkData.device, batch.buffer, batch.memory, 0);
+	VulkanContext::checkVkResult(err);
+	err = vkMapMemory(vkData.device, batch.memory, 0, batch.size, 0, &batch.mapped);
+	VulkanContext::checkVkResult(err);
+	m_context.getDebugUtils().setName(VK_OBJECT_TYPE_BUFFER, batch.buffer, "texture upload staging");
+	return batch;
+}
+
+void TextureUploader::releaseStaging(Batch& ioBatch) const {
+	if (ioBatch.buffer == VK_NULL_HANDLE)
+		return;
+	const auto& vkData = m_context.getVkData();
+	vkUnmapMemory(vkData.device, ioBatch.memory);
+	vkDestroyBuffer(vkData.device, ioBatch.buffer, vkData.allocator);
+	vkFreeMemory(vkData.device, ioBatch.memory, vkData.allocator);
+	ioBatch.buffer = VK_NULL_HANDLE;
+	ioBatch.memory = VK_NULL_HANDLE;
+	ioBatch.mapped = nullptr;
+	ioBatch.size = 0;
+}
+
+}// namespace mvi::core::vulkan
@@ -0,0 +1,176 @@
+/**
+ * @file TextureUploader.h
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+
+#include "vkData.h"
+
+#include <imgui.h>
+#include <unordered_map>
+#include <vector>
+
+namespace mvi::core::vulkan {
+
+class VulkanContext;
+
+/**
+ * @brief Upload the ImGui managed textures (font atlas pages), batching the rectangles changed in a frame.
+ *
+ * Replaces the texture handling of the ImGui backend, which uploads the textures one by one, each with its
+ * own submission followed by a queue wait. Here, only the updated rectangles of all the textures are copied
+ * into one staging buffer, and uploaded by a single submission, ordered before the frames using them.
+ */
+class TextureUploader final {
+public:
+	/**
+	 * @brief Upload statistics.
+	 */
+	struct Stats {
+		/// Managed textures.
+		uint32_t textures = 0;
+		/// Rectangles uploaded by the last batch.
+		uint32_t rects = 0;
+		/// Bytes uploaded by the last batch.
+		uint64_t bytes = 0;
+		/// Bytes uploaded since start.
+		uint64_t totalBytes = 0;
+		/// Batches submitted since start.
+		uint64_t batches = 0;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param[in] iContext The Vulkan context.
+	 */
+	explicit TextureUploader(const VulkanContext& iContext);
+	/**
+	 * @brief Destructor, the device must be idle.
+	 */
+	~TextureUploader();
+
+	TextureUploader(const TextureUploader&) = delete;
+	TextureUploader(TextureUploader&&) = delete;
+	auto operator=(const TextureUploader&) -> TextureUploader& = delete;
+	auto operator=(TextureUploader&&) -> TextureUploader& = delete;
+
+	/**
+	 * @brief Create, update or destroy the textures, as requested by ImGui.
+	 * @param[in,out] ioTextures The textures of the frame.
+	 *
+	 * @note To call after ImGui::Render(), before rendering any viewport.
+	 */
+	void update(ImVector<ImTextureData*>& ioTextures);
+	/**
+	 * @brief Release all the textures, before the ImGui backend shutdown.
+	 */
+	void release();
+
+	/**
+	 * @brief Get the statistics.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getStats() const -> const Stats& { return m_stats; }
+
+private:
+	/**
+	 * @brief GPU side of a texture.
+	 */
+	struct Image {
+		/// Image.
+		VkImage image = VK_NULL_HANDLE;
+		/// Image memory.
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		/// Image view.
+		VkImageView view = VK_NULL_HANDLE;
+		/// ImGui descriptor set.
+		VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+		/// Content uploaded at least once.
+		bool initialized = false;
+	};
+	/**
+	 * @brief Staging buffer and commands of a batch.
+	 */
+	struct Batch {
+		/// Commands.
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+		/// Staging buffer.
+		VkBuffer buffer = VK_NULL_HANDLE;
+		/// Staging memory.
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		/// Mapped staging memory.
+		void* mapped = nullptr;
+		/// Staging size.
+		VkDeviceSize size = 0;
+		/// Frame of the last submission.
+		uint64_t frame = 0;
+	};
+	/**
+	 * @brief Copies to one image.
+	 */
+	struct Copy {
+		/// Target image.
+		VkImage image = VK_NULL_HANDLE;
+		/// First region.
+		uint32_t firstRegion = 0;
+		/// Number of regions.
+		uint32_t regionCount = 0;
+		/// Previous content to keep.
+		bool initialized = false;
+	};
+
+	/**
+	 * @brief Create the image of a texture.
+	 * @param[in,out] ioTexture The texture.
+	 * @return The image.
+	 */
+	auto create(ImTextureData& ioTexture) -> Image&;
+	/**
+	 * @brief Release the image of a texture, once the GPU is done with it.
+	 * @param[in,out] ioTexture The texture.
+	 */
+	void destroy(ImTextureData& ioTexture);
+	/**
+	 * @brief Get the rectangles to upload for a texture.
+	 * @param[in] iTexture The texture.
+	 */
+	void collectRects(const ImTextureData& iTexture);
+	/**
+	 * @brief Get a batch no longer used by the GPU.
+	 * @param[in] iSize The required staging size.
+	 * @return The batch.
+	 */
+	auto acquireBatch(VkDeviceSize iSize) -> Batch&;
+	/**
+	 * @brief Release the staging buffer of a batch.
+	 * @param[in,out] ioBatch The batch.
+	 */
+	void releaseStaging(Batch& ioBatch) const;
+
+	/// The Vulkan context.
+	const VulkanContext& m_context;
+	/// Command pool of the batches.
+	VkCommandPool m_commandPool = VK_NULL_HANDLE;
+	/// Sampler shared by the textures.
+	VkSampler m_sampler = VK_NULL_HANDLE;
+	/// Images, by texture.
+	std::unordered_map<ImTextureData*, Image> m_images;
+	/// Batches, in use or not.
+	std::vector<Batch> m_batches;
+	/// Rectangles of the current texture.
+	std::vector<ImTextureRect> m_rects;
+	/// Copies of the current batch.
+	std::vector<Copy> m_copies;
+	/// Regions of the current batch.
+	std::vector<VkBufferImageCopy> m_regions;
+	/// Barriers of the current batch.
+	std::vector<VkImageMemoryBarrier> m_barriers;
+	/// The statistics.
+	Stats m_stats;
+};
+
+}// namespace mvi::core::vulkan
@@ -8,6 +8,7 @@
 #include "pch.h"
 
 #include "VulkanContext.h"
+#include "FrameCapture.h"
 #include "core/Application.h"
 #include "core/Log.h"
 #include "core/defines.h"
@@ -18,6 +19,9 @@ namespace mvi::core::vulkan {
 
 namespace {
 
+/// Descriptor sets reserved for application textures.
+constexpr uint32_t g_applicationTextureCount = 64;
+
 auto IsExtensionAvailable(const std::vector<VkExtensionProperties>& properties, const char* extension) -> bool {
 	for (const auto& [extensionName, specVersion]: properties)
 		if (strcmp(extensionName, extension) == 0)
@@ -29,7 +33,7 @@ auto IsExtensionAvailable(const std::vector<VkExtensionProperties>& properties,
 #ifdef APP_USE_VULKAN_DEBUG_REPORT
 VKAPI_ATTR auto VKAPI_CALL debug_report(VkDebugReportFlagsEXT, const VkDebugReportObjectTypeEXT objectType, uint64_t,
 										size_t, int32_t, const char*, const char* pMessage, void*) -> VkBool32 {
-	log_error("[vulkan] Debug report from ObjectType: %i\nMessage: %s\n", magic_enum::enum_name(objectType), pMessage);
+	log_error("[vulkan] Debug report from ObjectType: {}\nMessage: {}", magic_enum::enum_name(objectType), pMessage);
 	return VK_FALSE;
 }
 #endif// APP_USE_VULKAN_DEBUG_REPORT
@@ -64,12 +68,18 @@ VulkanContext::VulkanContext(std::vector<const char*> iInstanceExtensions) {
 		}
 #endif
 
+		// Object names and labels, for the validation layers and the capture or profiling tools
+		const bool debug_utils = DebugUtils::isAvailable(properties);
+		if (debug_utils)
+			iInstanceExtensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+
 		// Enabling validation layers
 #ifdef APP_USE_VULKAN_DEBUG_REPORT
 		const std::vector<const char*> layers = {"VK_LAYER_KHRONOS_validation"};
 		create_info.enabledLayerCount = static_cast<uint32_t>(layers.size());
 		create_info.ppEnabledLayerNames = layers.data();
-		iInstanceExtensions.push_back("VK_EXT_debug_report");
+		if (!debug_utils)
+			iInstanceExtensions.push_back("VK_EXT_debug_report");
 #endif
 
 		// Create Vulkan Instance
@@ -81,23 +91,26 @@ VulkanContext::VulkanContext(std::vector<const char*> iInstanceExtensions) {
 		volkLoadInstance(g_Instance);
 #endif
 
-		// Setup the debug report callback
+		// Setup the debug messenger, or the debug report callback without debug utils
+		m_debug = std::make_unique<DebugUtils>(*this, debug_utils);
 #ifdef APP_USE_VULKAN_DEBUG_REPORT
-		MVI_DIAG_PUSH
-		MVI_DIAG_DISABLE_CLANG("-Wcast-function-type-strict")
-		auto f_vkCreateDebugReportCallbackEXT = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
-				vkGetInstanceProcAddr(m_data.instance, "vkCreateDebugReportCallbackEXT"));
-		MVI_DIAG_POP
-		assert(f_vkCreateDebugReportCallbackEXT != nullptr);
-		VkDebugReportCallbackCreateInfoEXT debug_report_ci = {};
-		debug_report_ci.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
-		debug_report_ci.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT |
-								VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
-		debug_report_ci.pfnCallback = debug_report;
-		debug_report_ci.pUserData = nullptr;
-		err = f_vkCreateDebugReportCallbackEXT(m_data.instance, &debug_report_ci, m_data.allocator,
-											   &m_data.debugReport);
-		checkVkResult(err);
+		if (!debug_utils) {
+			MVI_DIAG_PUSH
+			MVI_DIAG_DISABLE_CLANG("-Wcast-function-type-strict")
+			auto f_vkCreateDebugReportCallbackEXT = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
+					vkGetInstanceProcAddr(m_data.instance, "vkCreateDebugReportCallbackEXT"));
+			MVI_DIAG_POP
+			assert(f_vkCreateDebugReportCallbackEXT != nullptr);
+			VkDebugReportCallbackCreateInfoEXT debug_report_ci = {};
+			debug_report_ci.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+			debug_report_ci.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT |
+									VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
+			debug_report_ci.pfnCallback = debug_report;
+			debug_report_ci.pUserData = nullptr;
+			err = f_vkCreateDebugReportCallbackEXT(m_data.instance, &debug_report_ci, m_data.allocator,
+												   &m_data.debugReport);
+			checkVkResult(err);
+		}
 #endif
 	}
 
@@ -125,21 +138,75 @@ VulkanContext::VulkanContext(std::vector<const char*> iInstanceExtensions) {
 			device_extensions.push_back(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME);
 #endif
 
+		// A dedicated compute family (async compute) is used for the compute jobs if available.
+		uint32_t family_count = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(m_data.physicalDevice, &family_count, nullptr);
+		std::vector<VkQueueFamilyProperties> families(family_count);
+		vkGetPhysicalDeviceQueueFamilyProperties(m_data.physicalDevice, &family_count, families.data());
+		m_data.computeQueueFamily = m_data.queueFamily;
+		for (uint32_t i = 0; i < family_count; ++i) {
+			if ((families[i].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0 &&
+				(families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0) {
+				m_data.computeQueueFamily = i;
+				break;
+			}
+		}
+
+		// Present timing feedback, for the latency-optimized frame pacing.
+		VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
+		present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+		VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+		present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+		present_id_features.pNext = &present_wait_features;
+		bool present_wait = false;
+		if (IsExtensionAvailable(properties, VK_KHR_PRESENT_ID_EXTENSION_NAME) &&
+			IsExtensionAvailable(properties, VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) {
+			MVI_DIAG_PUSH
+			MVI_DIAG_DISABLE_CLANG("-Wcast-function-type-strict")
+			const auto f_vkGetPhysicalDeviceFeatures2KHR = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(
+					vkGetInstanceProcAddr(m_data.instance, "vkGetPhysicalDeviceFeatures2KHR"));
+			MVI_DIAG_POP
+			if (f_vkGetPhysicalDeviceFeatures2KHR != nullptr) {
+				VkPhysicalDeviceFeatures2 features = {};
+				features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+				features.pNext = &present_id_features;
+				f_vkGetPhysicalDeviceFeatures2KHR(m_data.physicalDevice, &features);
+				present_wait = present_id_features.presentId == VK_TRUE && present_wait_features.presentWait == VK_TRUE;
+			}
+		}
+		if (present_wait) {
+			device_extensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+			device_extensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+		}
+
 		const std::vector<float> queue_priority = {1.0f};
-		VkDeviceQueueCreateInfo queue_info[1] = {};
+		VkDeviceQueueCreateInfo queue_info[2] = {};
 		queue_info[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 		queue_info[0].queueFamilyIndex = m_data.queueFamily;
 		queue_info[0].queueCount = static_cast<uint32_t>(queue_priority.size());
 		queue_info[0].pQueuePriorities = queue_priority.data();
+		queue_info[1] = queue_info[0];
+		queue_info[1].queueFamilyIndex = m_data.computeQueueFamily;
 		VkDeviceCreateInfo create_info = {};
 		create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-		create_info.queueCreateInfoCount = std::size(queue_info);
+		create_info.queueCreateInfoCount = m_data.computeQueueFamily != m_data.queueFamily ? 2 : 1;
 		create_info.pQueueCreateInfos = queue_info;
 		create_info.enabledExtensionCount = static_cast<uint32_t>(device_extensions.size());
 		create_info.ppEnabledExtensionNames = device_extensions.data();
+		if (present_wait)
+			create_info.pNext = &present_id_features;
 		err = vkCreateDevice(m_data.physicalDevice, &create_info, m_data.allocator, &m_data.device);
 		checkVkResult(err);
 		vkGetDeviceQueue(m_data.device, m_data.queueFamily, 0, &m_data.queue);
+		vkGetDeviceQueue(m_data.device, m_data.computeQueueFamily, 0, &m_data.computeQueue);
+		m_debug->setName(VK_OBJECT_TYPE_INSTANCE, m_data.instance, "instance");
+		m_debug->setName(VK_OBJECT_TYPE_PHYSICAL_DEVICE, m_data.physicalDevice, "physical device");
+		m_debug->setName(VK_OBJECT_TYPE_DEVICE, m_data.device, "device");
+		m_debug->setName(VK_OBJECT_TYPE_QUEUE, m_data.queue, "graphics queue");
+		if (m_data.computeQueue != m_data.queue)
+			m_debug->setName(VK_OBJECT_TYPE_QUEUE, m_data.computeQueue, "compute queue");
+		m_pacer = std::make_unique<FramePacer>(*this, present_wait);
+		log_info("[vulkan] Present wait {}", present_wait ? "available" : "not available");
 	}
 
 	// Create Descriptor Pool
@@ -147,7 +214,7 @@ VulkanContext::VulkanContext(std::vector<const char*> iInstanceExtensions) {
 	{
 		std::vector<VkDescriptorPoolSize> pool_sizes = {
 				{.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-				 .descriptorCount = IMGUI_IMPL_VULKAN_MINIMUM_IMAGE_SAMPLER_POOL_SIZE},
+				 .descriptorCount = IMGUI_IMPL_VULKAN_MINIMUM_IMAGE_SAMPLER_POOL_SIZE + g_applicationTextureCount},
 		};
 		VkDescriptorPoolCreateInfo pool_info = {};
 		pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
@@ -158,21 +225,51 @@ VulkanContext::VulkanContext(std::vector<const char*> iInstanceExtensions) {
 		pool_info.pPoolSizes = pool_sizes.data();
 		err = vkCreateDescriptorPool(m_data.device, &pool_info, m_data.allocator, &m_data.descriptorPool);
 		checkVkResult(err);
+		m_debug->setName(VK_OBJECT_TYPE_DESCRIPTOR_POOL, m_data.descriptorPool, "imgui descriptor pool");
+	}
+
+	// Create the command pool for one-time submissions
+	{
+		VkCommandPoolCreateInfo pool_info = {};
+		pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		pool_info.queueFamilyIndex = m_data.queueFamily;
+		err = vkCreateCommandPool(m_data.device, &pool_info, m_data.allocator, &m_uploadPool);
+		checkVkResult(err);
+		m_debug->setName(VK_OBJECT_TYPE_COMMAND_POOL, m_uploadPool, "upload command pool");
 	}
+
+	m_deletion = std::make_unique<DeletionQueue>(*this);
+	m_textures = std::make_unique<TextureUploader>(*this);
+	m_renderGraph = std::make_unique<RenderGraph>(*this);
+	m_compute = std::make_unique<ComputeQueue>(*this);
 }
 
 VulkanContext::~VulkanContext() {
+	m_pacer.reset();
+	m_compute.reset();
+	m_renderGraph.reset();
+	m_textures.reset();
+	// The device is idle: everything can go.
+	m_deletion.reset();
+	for (const auto& frame: m_frameFences) vkDestroyFence(m_data.device, frame.fence, m_data.allocator);
+	for (auto* fence: m_freeFences) vkDestroyFence(m_data.device, fence, m_data.allocator);
+
+	vkDestroyCommandPool(m_data.device, m_uploadPool, m_data.allocator);
 
 	vkDestroyDescriptorPool(m_data.device, m_data.descriptorPool, m_data.allocator);
 
+	// Remove the debug messenger or the debug report callback
+	m_debug.reset();
 #ifdef APP_USE_VULKAN_DEBUG_REPORT
-	// Remove the debug report callback
-	MVI_DIAG_PUSH
-	MVI_DIAG_DISABLE_CLANG("-Wcast-function-type-strict")
-	const auto f_vkDestroyDebugReportCallbackEXT = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
-			vkGetInstanceProcAddr(m_data.instance, "vkDestroyDebugReportCallbackEXT"));
-	MVI_DIAG_POP
-	f_vkDestroyDebugReportCallbackEXT(m_data.instance, m_data.debugReport, m_data.allocator);
+	if (m_data.debugReport != VK_NULL_HANDLE) {
+		MVI_DIAG_PUSH
+		MVI_DIAG_DISABLE_CLANG("-Wcast-function-type-strict")
+		const auto f_vkDestroyDebugReportCallbackEXT = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
+				vkGetInstanceProcAddr(m_data.instance, "vkDestroyDebugReportCallbackEXT"));
+		MVI_DIAG_POP
+		f_vkDestroyDebugReportCallbackEXT(m_data.instance, m_data.debugReport, m_data.allocator);
+	}
 #endif// APP_USE_VULKAN_DEBUG_REPORT
 
 	vkDestroyDevice(m_data.device, m_data.allocator);
@@ -182,25 +279,119 @@ VulkanContext::~VulkanContext() {
 void VulkanContext::checkVkResult(const VkResult err) {
 	if (err == VK_SUCCESS)
 		return;
-	log_error("[vulkan] Error: VkResult = %d", magic_enum::enum_name(err));
-	if (err < 0)
+	log_error("[vulkan] Error: VkResult = {}", magic_enum::enum_name(err));
+	// Without application (headless tools), the caller handles the failure.
+	if (err < 0 && Application::instanced())
 		Application::get().reportError("Vulkan encountered a fatal error.");
 }
 
 
-void VulkanContext::frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapChain) const {
+auto VulkanContext::findMemoryType(const uint32_t iTypeBits, const VkMemoryPropertyFlags iProperties,
+								   const VkMemoryPropertyFlags iPreferred) const -> uint32_t {
+	VkPhysicalDeviceMemoryProperties properties;
+	vkGetPhysicalDeviceMemoryProperties(m_data.physicalDevice, &properties);
+	for (const VkMemoryPropertyFlags wanted: {iProperties | iPreferred, iProperties}) {
+		for (uint32_t index = 0; index < properties.memoryTypeCount; ++index) {
+			if ((iTypeBits & (1u << index)) != 0 && (properties.memoryTypes[index].propertyFlags & wanted) == wanted)
+				return index;
+		}
+	}
+	log_error("[vulkan] No memory type matching {:#x}.", iProperties);
+	return 0;
+}
+
+void VulkanContext::immediateSubmit(const std::function<void(VkCommandBuffer)>& iRecord) const {
+	VkCommandBufferAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	alloc_info.commandPool = m_uploadPool;
+	alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	alloc_info.commandBufferCount = 1;
+	VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+	VkResult err = vkAllocateCommandBuffers(m_data.device, &alloc_info, &command_buffer);
+	checkVkResult(err);
+	m_debug->setName(VK_OBJECT_TYPE_COMMAND_BUFFER, command_buffer, "upload commands");
+
+	VkCommandBufferBeginInfo begin_info = {};
+	begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	err = vkBeginCommandBuffer(command_buffer, &begin_info);
+	checkVkResult(err);
+	iRecord(command_buffer);
+	err = vkEndCommandBuffer(command_buffer);
+	checkVkResult(err);
+
+	VkFenceCreateInfo fence_info = {};
+	fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	VkFence fence = VK_NULL_HANDLE;
+	err = vkCreateFence(m_data.device, &fence_info, m_data.allocator, &fence);
+	checkVkResult(err);
+	VkSubmitInfo submit_info = {};
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &command_buffer;
+	err = vkQueueSubmit(m_data.queue, 1, &submit_info, fence);
+	checkVkResult(err);
+	err = vkWaitForFences(m_data.device, 1, &fence, VK_TRUE, UINT64_MAX);
+	checkVkResult(err);
+	vkDestroyFence(m_data.device, fence, m_data.allocator);
+	vkFreeCommandBuffers(m_data.device, m_uploadPool, 1, &command_buffer);
+}
+
+void VulkanContext::discardFrame() {
+	m_renderGraph->reset();
+	m_uiReads.clear();
+	endFrame();
+}
+
+void VulkanContext::endFrame() {
+	VkFence fence = VK_NULL_HANDLE;
+	if (m_freeFences.empty()) {
+		VkFenceCreateInfo fence_info = {};
+		fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		const VkResult err = vkCreateFence(m_data.device, &fence_info, m_data.allocator, &fence);
+		checkVkResult(err);
+		m_debug->setName(VK_OBJECT_TYPE_FENCE, fence, "frame end fence");
+	} else {
+		fence = m_freeFences.back();
+		m_freeFences.pop_back();
+	}
+	// An empty submission signals its fence once all the work previously submitted to the queue is done.
+	const VkResult err = vkQueueSubmit(m_data.queue, 0, nullptr, fence);
+	checkVkResult(err);
+	m_frameFences.push_back({.fence = fence, .serial = m_frameSerial});
+	++m_frameSerial;
+	pollFrames();
+}
+
+void VulkanContext::pollFrames() {
+	while (!m_frameFences.empty() && vkGetFenceStatus(m_data.device, m_frameFences.front().fence) == VK_SUCCESS) {
+		const auto& frame = m_frameFences.front();
+		m_completedFrame = frame.serial;
+		const VkResult err = vkResetFences(m_data.device, 1, &frame.fence);
+		checkVkResult(err);
+		m_freeFences.push_back(frame.fence);
+		m_frameFences.pop_front();
+	}
+	m_deletion->collect(m_completedFrame);
+}
+
+void VulkanContext::frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapChain) {
 	auto* wd = static_cast<ImGui_ImplVulkanH_Window*>(iWd);
 	auto* draw_data = static_cast<ImDrawData*>(iDrawData);
 	VkSemaphore image_acquired_semaphore =
 			wd->FrameSemaphores[static_cast<int>(wd->SemaphoreIndex)].ImageAcquiredSemaphore;
 	VkSemaphore render_complete_semaphore =
 			wd->FrameSemaphores[static_cast<int>(wd->SemaphoreIndex)].RenderCompleteSemaphore;
+	const auto acquire_start = FramePacer::clock::now();
 	VkResult err = vkAcquireNextImageKHR(m_data.device, wd->Swapchain, UINT64_MAX, image_acquired_semaphore,
 										 VK_NULL_HANDLE, &wd->FrameIndex);
+	m_pacer->acquired(acquire_start);
 	if (err == VK_ERROR_OUT_OF_DATE_KHR || err == VK_SUBOPTIMAL_KHR)
 		oRebuildSwapChain = true;
-	if (err == VK_ERROR_OUT_OF_DATE_KHR)
+	if (err == VK_ERROR_OUT_OF_DATE_KHR) {
+		discardFrame();
 		return;
+	}
 	if (err != VK_SUBOPTIMAL_KHR)
 		checkVkResult(err);
 
@@ -213,6 +404,8 @@ void VulkanContext::frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapCh
 		err = vkResetFences(m_data.device, 1, &fd->Fence);
 		checkVkResult(err);
 	}
+	// A captured frame is copied by a second submission, which then signals the presentation.
+	const bool capture = m_capture != nullptr && m_capture->prepare();
 	{
 		err = vkResetCommandPool(m_data.device, fd->CommandPool, 0);
 		checkVkResult(err);
@@ -222,23 +415,42 @@ void VulkanContext::frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapCh
 		err = vkBeginCommandBuffer(fd->CommandBuffer, &info);
 		checkVkResult(err);
 	}
+	// Frame graph: the passes registered during the frame, then the ImGui pass drawing into the back buffer.
 	{
-		VkRenderPassBeginInfo info = {};
-		info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		info.renderPass = wd->RenderPass;
-		info.framebuffer = fd->Framebuffer;
-		info.renderArea.extent.width = static_cast<uint32_t>(wd->Width);
-		info.renderArea.extent.height = static_cast<uint32_t>(wd->Height);
-		info.clearValueCount = 1;
-		info.pClearValues = &wd->ClearValue;
-		vkCmdBeginRenderPass(fd->CommandBuffer, &info, VK_SUBPASS_CONTENTS_INLINE);
+		const VkExtent2D extent = {.width = static_cast<uint32_t>(wd->Width),
+								   .height = static_cast<uint32_t>(wd->Height)};
+		const auto backbuffer = m_renderGraph->importImage(
+				"backbuffer", fd->Backbuffer, fd->BackbufferView,
+				{.format = wd->SurfaceFormat.format,
+				 .extent = extent,
+				 .usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT},
+				{.layout = VK_IMAGE_LAYOUT_UNDEFINED,
+				 .stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+				 .access = 0});
+		m_renderGraph->setOutput(backbuffer);
+		// Draw ranges labeled by window, for the capture and profiling tools.
+		m_debug->labelDrawLists(draw_data);
+		auto& pass = m_renderGraph->addPass("imgui", [wd, fd, draw_data, extent](VkCommandBuffer iCommandBuffer,
+																				  const RenderGraph&) -> void {
+			VkRenderPassBeginInfo info = {};
+			info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+			info.renderPass = wd->RenderPass;
+			info.framebuffer = fd->Framebuffer;
+			info.renderArea.extent = extent;
+			info.clearValueCount = 1;
+			info.pClearValues = &wd->ClearValue;
+			vkCmdBeginRenderPass(iCommandBuffer, &info, VK_SUBPASS_CONTENTS_INLINE);
+			// Record dear imgui primitives into command buffer
+			ImGui_ImplVulkan_RenderDrawData(draw_data, iCommandBuffer);
+			vkCmdEndRenderPass(iCommandBuffer);
+		});
+		pass.write(backbuffer, RenderGraph::Usage::ColorAttachment, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+		for (const auto resource: m_uiReads) pass.read(resource, RenderGraph::Usage::Sampled);
+		m_uiReads.clear();
+		m_renderGraph->execute(fd->CommandBuffer);
 	}
 
-	// Record dear imgui primitives into command buffer
-	ImGui_ImplVulkan_RenderDrawData(draw_data, fd->CommandBuffer);
-
 	// Submit command buffer
-	vkCmdEndRenderPass(fd->CommandBuffer);
 	{
 		constexpr VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 		VkSubmitInfo info = {};
@@ -248,7 +460,7 @@ void VulkanContext::frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapCh
 		info.pWaitDstStageMask = &wait_stage;
 		info.commandBufferCount = 1;
 		info.pCommandBuffers = &fd->CommandBuffer;
-		info.signalSemaphoreCount = 1;
+		info.signalSemaphoreCount = capture ? 0 : 1;
 		info.pSignalSemaphores = &render_complete_semaphore;
 
 		err = vkEndCommandBuffer(fd->CommandBuffer);
@@ -256,10 +468,22 @@ void VulkanContext::frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapCh
 		err = vkQueueSubmit(m_data.queue, 1, &info, fd->Fence);
 		checkVkResult(err);
 	}
+	if (capture)
+		m_capture->record(fd->Backbuffer, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, wd->SurfaceFormat.format,
+						  {.width = static_cast<uint32_t>(wd->Width), .height = static_cast<uint32_t>(wd->Height)},
+						  render_complete_semaphore);
+	endFrame();
 	if (oRebuildSwapChain)
 		return;
+	const uint64_t present_id = m_pacer->nextPresentId();
+	VkPresentIdKHR present_id_info = {};
+	present_id_info.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+	present_id_info.swapchainCount = 1;
+	present_id_info.pPresentIds = &present_id;
 	VkPresentInfoKHR info = {};
 	info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+	if (present_id != 0)
+		info.pNext = &present_id_info;
 	info.waitSemaphoreCount = 1;
 	info.pWaitSemaphores = &render_complete_semaphore;
 	info.swapchainCount = 1;
@@ -272,6 +496,7 @@ void VulkanContext::frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapCh
 		return;
 	if (err != VK_SUBOPTIMAL_KHR)
 		checkVkResult(err);
+	m_pacer->presented(wd->Swapchain, present_id);
 	wd->SemaphoreIndex = (wd->SemaphoreIndex + 1) % wd->SemaphoreCount;// Now we can use the next set of semaphores
 }
 
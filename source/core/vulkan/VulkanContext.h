@@ -8,11 +8,22 @@
 
 #pragma once
 
+#include "ComputeQueue.h"
+#include "DebugUtils.h"
+#include "DeletionQueue.h"
+#include "FramePacer.h"
+#include "RenderGraph.h"
+#include "TextureUploader.h"
 #include "vkData.h"
+#include <deque>
+#include <functional>
+#include <memory>
 #include <vector>
 
 namespace mvi::core::vulkan {
 
+class FrameCapture;
+
 /**
  * @brief Class VulkanContext.
  */
@@ -45,16 +56,134 @@ public:
 	static void checkVkResult(VkResult err);
 
 	/**
-	 * @brief Frame render function.
+	 * @brief Frame render function: run the frame graph, ending with the ImGui pass.
 	 * @param[in,out] iWd The window data.
 	 * @param[in] iDrawData The draw data.
 	 * @param[out] oRebuildSwapChain Swap chain rebuild flag.
 	 */
-	void frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapChain) const;
+	void frameRender(void* iWd, void* iDrawData, bool& oRebuildSwapChain);
+	/**
+	 * @brief Drop the passes registered for a frame that is not rendered.
+	 */
+	void discardFrame();
+
+	/**
+	 * @brief Get the frame graph, where passes are added during the frame.
+	 * @return The render graph.
+	 */
+	[[nodiscard]] auto getRenderGraph() -> RenderGraph& { return *m_renderGraph; }
+	/**
+	 * @brief Get the compute job queue.
+	 * @return The compute queue.
+	 */
+	[[nodiscard]] auto getCompute() -> ComputeQueue& { return *m_compute; }
+	/**
+	 * @brief Get the debug utils, to name objects and label commands.
+	 * @return The debug utils.
+	 */
+	[[nodiscard]] auto getDebugUtils() const -> const DebugUtils& { return *m_debug; }
+	/**
+	 * @brief Get the frame pacer.
+	 * @return The frame pacer.
+	 */
+	[[nodiscard]] auto getFramePacer() -> FramePacer& { return *m_pacer; }
+	/**
+	 * @brief Get the uploader of the ImGui managed textures.
+	 * @return The texture uploader.
+	 */
+	[[nodiscard]] auto getTextureUploader() -> TextureUploader& { return *m_textures; }
+	/**
+	 * @brief Get the queue destroying the released objects once the GPU is done with them.
+	 * @return The deletion queue.
+	 */
+	[[nodiscard]] auto getDeletionQueue() const -> DeletionQueue& { return *m_deletion; }
+	/**
+	 * @brief Get the serial of the frame being recorded.
+	 * @return The frame serial, starting at 1.
+	 */
+	[[nodiscard]] auto getFrameSerial() const -> uint64_t { return m_frameSerial; }
+	/**
+	 * @brief Get the serial of the last frame completed by the GPU.
+	 * @return The frame serial, 0 if none.
+	 */
+	[[nodiscard]] auto getCompletedFrame() const -> uint64_t { return m_completedFrame; }
+	/**
+	 * @brief Declare an image of the frame graph sampled by the ImGui pass.
+	 * @param[in] iResource The image.
+	 */
+	void sampleInUi(const RenderGraph::ResourceId iResource) { m_uiReads.push_back(iResource); }
+
+	/**
+	 * @brief Find a memory type.
+	 * @param[in] iTypeBits The memory types allowed by the resource.
+	 * @param[in] iProperties The required memory properties.
+	 * @param[in] iPreferred Additional properties used when a matching type exists.
+	 * @return The memory type index.
+	 */
+	[[nodiscard]] auto findMemoryType(uint32_t iTypeBits, VkMemoryPropertyFlags iProperties,
+									  VkMemoryPropertyFlags iPreferred = 0) const -> uint32_t;
+
+	/**
+	 * @brief Record and submit a one-time command buffer, then wait for its completion.
+	 * @param[in] iRecord The recording function.
+	 *
+	 * @note Only for loading time transfers, from the main thread.
+	 */
+	void immediateSubmit(const std::function<void(VkCommandBuffer)>& iRecord) const;
+
+	/**
+	 * @brief Define the frame capture fed by frameRender.
+	 * @param[in] iCapture The frame capture (not owned, may be null).
+	 */
+	void setFrameCapture(FrameCapture* iCapture) { m_capture = iCapture; }
 
 private:
+	/**
+	 * @brief Frame submitted to the GPU.
+	 */
+	struct FrameFence {
+		/// Signaled when the frame is done.
+		VkFence fence = VK_NULL_HANDLE;
+		/// Frame serial.
+		uint64_t serial = 0;
+	};
+	/**
+	 * @brief Close the recorded frame: fence its submissions and release what the GPU is done with.
+	 */
+	void endFrame();
+	/**
+	 * @brief Update the completed frame and collect the deletion queue (non-blocking).
+	 */
+	void pollFrames();
+
 	/// Vulkan data.
 	VkData m_data;
+	/// Object names, labels and validation messages.
+	std::unique_ptr<DebugUtils> m_debug;
+	/// Command pool for one-time submissions.
+	VkCommandPool m_uploadPool = VK_NULL_HANDLE;
+	/// Frame capture.
+	FrameCapture* m_capture = nullptr;
+	/// Frame graph.
+	std::unique_ptr<RenderGraph> m_renderGraph;
+	/// Compute jobs.
+	std::unique_ptr<ComputeQueue> m_compute;
+	/// Frame graph images sampled by the ImGui pass.
+	std::vector<RenderGraph::ResourceId> m_uiReads;
+	/// Deferred destructions.
+	std::unique_ptr<DeletionQueue> m_deletion;
+	/// Frame pacing.
+	std::unique_ptr<FramePacer> m_pacer;
+	/// ImGui managed textures.
+	std::unique_ptr<TextureUploader> m_textures;
+	/// Submitted frames, in order.
+	std::deque<FrameFence> m_frameFences;
+	/// Recycled fences.
+	std::vector<VkFence> m_freeFences;
+	/// Frame being recorded.
+	uint64_t m_frameSerial = 1;
+	/// Last frame completed by the GPU.
+	uint64_t m_completedFrame = 0;
 };
 
 }// namespace mvi::core::vulkan
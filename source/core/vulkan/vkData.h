@@ -27,6 +27,10 @@ struct VkData {
 	uint32_t queueFamily = static_cast<uint32_t>(-1);
 	/// Queue.
 	VkQueue queue = VK_NULL_HANDLE;
+	/// Compute queue family index (the graphics one if no dedicated family exists).
+	uint32_t computeQueueFamily = static_cast<uint32_t>(-1);
+	/// Compute queue (the graphics one if no dedicated family exists).
+	VkQueue computeQueue = VK_NULL_HANDLE;
 	/// Pipeline cache.
 	VkPipelineCache pipelineCache = VK_NULL_HANDLE;
 	/// Descriptor pool.
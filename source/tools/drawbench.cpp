@@ -0,0 +1,497 @@
+/**
+ * @file drawbench.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "core/Log.h"
+#include "core/capture/DrawDataRecorder.h"
+#include "core/vulkan/VulkanContext.h"
+
+#include <algorithm>
+#include <array>
+#include <backends/imgui_impl_vulkan.h>// NOLINT
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string_view>
+#include <utility>
+
+namespace {
+
+using mvi::core::capture::RecordedFrame;
+using mvi::core::capture::RecordedTexture;
+using mvi::core::vulkan::VulkanContext;
+
+/// Format of the replay target.
+constexpr VkFormat g_targetFormat = VK_FORMAT_B8G8R8A8_UNORM;
+
+/**
+ * @brief Offscreen color target of the replay.
+ */
+struct Target {
+	/// The image.
+	VkImage image = VK_NULL_HANDLE;
+	/// Image memory.
+	VkDeviceMemory memory = VK_NULL_HANDLE;
+	/// Image view.
+	VkImageView view = VK_NULL_HANDLE;
+	/// Render pass clearing the image.
+	VkRenderPass renderPass = VK_NULL_HANDLE;
+	/// Framebuffer.
+	VkFramebuffer framebuffer = VK_NULL_HANDLE;
+	/// Image size.
+	VkExtent2D extent = {.width = 0, .height = 0};
+};
+
+/**
+ * @brief Create the replay target.
+ * @param[in] iContext The Vulkan context.
+ * @param[in] iExtent The size.
+ * @return The target.
+ */
+auto createTarget(const VulkanContext& iContext, const VkExtent2D iExtent) -> Target {
+	const auto& vkData = iContext.getVkData();
+	Target target;
+	target.extent = iExtent;
+	{
+		VkImageCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		info.imageType = VK_IMAGE_TYPE_2D;
+		info.format = g_targetFormat;
+		info.extent = {.width = iExtent.width, .height = iExtent.height, .depth = 1};
+		info.mipLevels = 1;
+		info.arrayLayers = 1;
+		info.samples = VK_SAMPLE_COUNT_1_BIT;
+		info.tiling = VK_IMAGE_TILING_OPTIMAL;
+		info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+		info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		VkResult err = vkCreateImage(vkData.device, &info, vkData.allocator, &target.image);
+		VulkanContext::checkVkResult(err);
+		VkMemoryRequirements requirements;
+		vkGetImageMemoryRequirements(vkData.device, target.image, &requirements);
+		VkMemoryAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		alloc_info.allocationSize = requirements.size;
+		alloc_info.memoryTypeIndex =
+				iContext.findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+		err = vkAllocateMemory(vkData.device, &alloc_info, vkData.allocator, &target.memory);
+		VulkanContext::checkVkResult(err);
+		err = vkBindImageMemory(vkData.device, target.image, target.memory, 0);
+		VulkanContext::checkVkResult(err);
+	}
+	{
+		VkImageViewCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		info.image = target.image;
+		info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		info.format = g_targetFormat;
+		info.subresourceRange = {.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+								 .baseMipLevel = 0,
+								 .levelCount = 1,
+								 .baseArrayLayer = 0,
+								 .layerCount = 1};
+		const VkResult err = vkCreateImageView(vkData.device, &info, vkData.allocator, &target.view);
+		VulkanContext::checkVkResult(err);
+	}
+	{
+		VkAttachmentDescription attachment = {};
+		attachment.format = g_targetFormat;
+		attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+		attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		VkAttachmentReference color_attachment = {};
+		color_attachment.attachment = 0;
+		color_attachment.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		VkSubpassDescription subpass = {};
+		subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		subpass.colorAttachmentCount = 1;
+		subpass.pColorAttachments = &color_attachment;
+		VkRenderPassCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+		info.attachmentCount = 1;
+		info.pAttachments = &attachment;
+		info.subpassCount = 1;
+		info.pSubpasses = &subpass;
+		const VkResult err = vkCreateRenderPass(vkData.device, &info, vkData.allocator, &target.renderPass);
+		VulkanContext::checkVkResult(err);
+	}
+	{
+		VkFramebufferCreateInfo info = {};
+		info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+		info.renderPass = target.renderPass;
+		info.attachmentCount = 1;
+		info.pAttachments = &target.view;
+		info.width = iExtent.width;
+		info.height = iExtent.height;
+		info.layers = 1;
+		const VkResult err = vkCreateFramebuffer(vkData.device, &info, vkData.allocator, &target.framebuffer);
+		VulkanContext::checkVkResult(err);
+	}
+	return target;
+}
+
+/**
+ * @brief Destroy the replay target.
+ * @param[in] iContext The Vulkan context.
+ * @param[in,out] ioTarget The target.
+ */
+void destroyTarget(const VulkanContext& iContext, Target& ioTarget) {
+	const auto& vkData = iContext.getVkData();
+	vkDestroyFramebuffer(vkData.device, ioTarget.framebuffer, vkData.allocator);
+	vkDestroyRenderPass(vkData.device, ioTarget.renderPass, vkData.allocator);
+	vkDestroyImageView(vkData.device, ioTarget.view, vkData.allocator);
+	vkDestroyImage(vkData.device, ioTarget.image, vkData.allocator);
+	vkFreeMemory(vkData.device, ioTarget.memory, vkData.allocator);
+	ioTarget = {};
+}
+
+/**
+ * @brief Textures of the replay, uploaded by the ImGui backend.
+ */
+class Textures final {
+public:
+	Textures() {
+		// Stand-in for the textures that are not recorded.
+		m_placeholder.Create(ImTextureFormat_RGBA32, 1, 1);
+		std::memset(m_placeholder.GetPixels(), 0xFF, 4);
+		m_placeholder.SetStatus(ImTextureStatus_WantCreate);
+		ImGui_ImplVulkan_UpdateTexture(&m_placeholder);
+	}
+	~Textures() {
+		release(m_placeholder);
+		for (auto& [id, texture]: m_textures) release(*texture);
+	}
+	Textures(const Textures&) = delete;
+	Textures(Textures&&) = delete;
+	auto operator=(const Textures&) -> Textures& = delete;
+	auto operator=(Textures&&) -> Textures& = delete;
+
+	/**
+	 * @brief Create or update a texture.
+	 * @param[in] iTexture The recorded texture.
+	 */
+	void update(const RecordedTexture& iTexture) {
+		auto& texture = m_textures[iTexture.id];
+		if (texture == nullptr)
+			texture = std::make_unique<ImTextureData>();
+		if (texture->Status != ImTextureStatus_Destroyed &&
+			(std::cmp_not_equal(texture->Width, iTexture.width) ||
+			 std::cmp_not_equal(texture->Height, iTexture.height) || texture->Format != iTexture.format))
+			release(*texture);
+		const bool create = texture->Status == ImTextureStatus_Destroyed;
+		if (create)
+			texture->Create(iTexture.format, static_cast<int>(iTexture.width), static_cast<int>(iTexture.height));
+		std::memcpy(texture->GetPixels(), iTexture.pixels.data(),
+					std::min(iTexture.pixels.size(), static_cast<size_t>(texture->GetSizeInBytes())));
+		if (create) {
+			texture->SetStatus(ImTextureStatus_WantCreate);
+		} else {
+			const ImTextureRect rect = {.x = 0,
+										.y = 0,
+										.w = static_cast<unsigned short>(iTexture.width),
+										.h = static_cast<unsigned short>(iTexture.height)};
+			texture->UpdateRect = rect;
+			texture->Updates.resize(0);
+			texture->Updates.push_back(rect);
+			texture->SetStatus(ImTextureStatus_WantUpdates);
+		}
+		ImGui_ImplVulkan_UpdateTexture(texture.get());
+	}
+
+	/**
+	 * @brief Get a texture.
+	 * @param[in] iId The recorded reference.
+	 * @return The texture, the placeholder if unknown.
+	 */
+	[[nodiscard]] auto get(const uint32_t iId) -> ImTextureData* {
+		const auto found = m_textures.find(iId);
+		return found != m_textures.end() ? found->second.get() : &m_placeholder;
+	}
+
+private:
+	/**
+	 * @brief Release the GPU texture.
+	 * @param[in,out] ioTexture The texture.
+	 */
+	static void release(ImTextureData& ioTexture) {
+		if (ioTexture.Status == ImTextureStatus_Destroyed)
+			return;
+		// The GPU is idle between the replayed frames.
+		ioTexture.UnusedFrames = 1 << 16;
+		ioTexture.SetStatus(ImTextureStatus_WantDestroy);
+		ImGui_ImplVulkan_UpdateTexture(&ioTexture);
+		ioTexture.DestroyPixels();
+	}
+
+	/// Texture used for the unknown references.
+	ImTextureData m_placeholder;
+	/// Recorded textures.
+	std::map<uint32_t, std::unique_ptr<ImTextureData>> m_textures;
+};
+
+/**
+ * @brief Fill a draw data from a recorded frame.
+ * @param[in] iFrame The frame.
+ * @param[in,out] ioTextures The textures.
+ * @param[in,out] ioLists The draw list pool.
+ * @param[out] oDrawData The draw data.
+ */
+void fillDrawData(const RecordedFrame& iFrame, Textures& ioTextures, std::vector<std::unique_ptr<ImDrawList>>& ioLists,
+				  ImDrawData& oDrawData) {
+	oDrawData.Clear();
+	oDrawData.Valid = true;
+	oDrawData.DisplayPos = iFrame.displayPos;
+	oDrawData.DisplaySize = iFrame.displaySize;
+	oDrawData.FramebufferScale = iFrame.framebufferScale;
+	oDrawData.Textures = nullptr;
+	while (ioLists.size() < iFrame.lists.size())
+		ioLists.push_back(std::make_unique<ImDrawList>(ImGui::GetDrawListSharedData()));
+	for (size_t index = 0; index < iFrame.lists.size(); ++index) {
+		const auto& recorded = iFrame.lists[index];
+		ImDrawList& list = *ioLists[index];
+		list.VtxBuffer.resize(static_cast<int>(recorded.vertices.size()));
+		list.IdxBuffer.resize(static_cast<int>(recorded.indices.size()));
+		list.CmdBuffer.resize(static_cast<int>(recorded.commands.size()));
+		if (!recorded.vertices.empty())
+			std::memcpy(list.VtxBuffer.Data, recorded.vertices.data(), recorded.vertices.size() * sizeof(ImDrawVert));
+		if (!recorded.indices.empty())
+			std::memcpy(list.IdxBuffer.Data, recorded.indices.data(), recorded.indices.size() * sizeof(ImDrawIdx));
+		for (size_t command = 0; command < recorded.commands.size(); ++command) {
+			const auto& source = recorded.commands[command];
+			ImDrawCmd& target = list.CmdBuffer[static_cast<int>(command)];
+			target = ImDrawCmd{};
+			target.ClipRect = source.clipRect;
+			target.TexRef._TexData = ioTextures.get(source.texture);
+			target.VtxOffset = source.vertexOffset;
+			target.IdxOffset = source.indexOffset;
+			target.ElemCount = source.elementCount;
+		}
+		oDrawData.AddDrawList(&list);
+	}
+}
+
+/**
+ * @brief Get a percentile of the samples.
+ * @param[in] iSamples The sorted samples.
+ * @param[in] iRatio The percentile, between 0 and 1.
+ * @return The value.
+ */
+auto percentile(const std::vector<double>& iSamples, const double iRatio) -> double {
+	if (iSamples.empty())
+		return 0.0;
+	const auto index = static_cast<size_t>(iRatio * static_cast<double>(iSamples.size() - 1));
+	return iSamples[index];
+}
+
+/**
+ * @brief Log the statistics of a series.
+ * @param[in] iName The series name.
+ * @param[in] iSamples The samples, in milliseconds.
+ */
+void report(const std::string_view iName, std::vector<double> iSamples) {
+	if (iSamples.empty())
+		return;
+	std::ranges::sort(iSamples);
+	const double mean = std::accumulate(iSamples.begin(), iSamples.end(), 0.0) / static_cast<double>(iSamples.size());
+	log_info("{:>10}: mean {:8.4f} ms, median {:8.4f} ms, p95 {:8.4f} ms, max {:8.4f} ms", iName, mean,
+			 percentile(iSamples, 0.5), percentile(iSamples, 0.95), iSamples.back());
+}
+
+}// namespace
+
+// Usage: drawbench <recording> [repeat] [--frames]
+auto main(const int iArgc, char** iArgv) -> int {
+	mvi::Log::init(mvi::Log::Level::Info);
+	if (iArgc < 2) {
+		log_error("Usage: {} <recording> [repeat] [--frames]", iArgv[0]);
+		return 1;
+	}
+	uint32_t repeat = 1;
+	bool perFrame = false;
+	for (int index = 2; index < iArgc; ++index) {
+		if (std::string_view(iArgv[index]) == "--frames")
+			perFrame = true;
+		else
+			repeat = std::max(static_cast<uint32_t>(std::strtoul(iArgv[index], nullptr, 10)), 1u);
+	}
+	std::vector<RecordedFrame> frames;
+	if (!mvi::core::capture::DrawDataRecorder::load(iArgv[1], frames))
+		return 1;
+
+	// Headless context: no surface, the frames are rendered into an offscreen image.
+	auto context = std::make_unique<VulkanContext>(std::vector<const char*>{});
+	const auto& vkData = context->getVkData();
+	VkExtent2D extent = {.width = 1, .height = 1};
+	for (const auto& frame: frames) {
+		extent.width = std::max(
+				extent.width, static_cast<uint32_t>(std::ceil(frame.displaySize.x * frame.framebufferScale.x)));
+		extent.height = std::max(
+				extent.height, static_cast<uint32_t>(std::ceil(frame.displaySize.y * frame.framebufferScale.y)));
+	}
+	Target target = createTarget(*context, extent);
+
+	IMGUI_CHECKVERSION();
+	ImGui::CreateContext();
+	ImGui_ImplVulkan_InitInfo init_info = {.ApiVersion = VK_API_VERSION_1_4,
+										   .Instance = vkData.instance,
+										   .PhysicalDevice = vkData.physicalDevice,
+										   .Device = vkData.device,
+										   .QueueFamily = vkData.queueFamily,
+										   .Queue = vkData.queue,
+										   .DescriptorPool = vkData.descriptorPool,
+										   .DescriptorPoolSize = 0,
+										   .MinImageCount = 2,
+										   .ImageCount = 2,
+										   .PipelineCache = vkData.pipelineCache,
+										   .PipelineInfoMain = {.RenderPass = target.renderPass,
+																.Subpass = 0,
+																.MSAASamples = VK_SAMPLE_COUNT_1_BIT,
+#ifdef IMGUI_IMPL_VULKAN_HAS_DYNAMIC_RENDERING
+																.PipelineRenderingCreateInfo = {},
+#endif
+																.SwapChainImageUsage = {}},
+										   .PipelineInfoForViewports = {},
+										   .UseDynamicRendering = false,
+										   .Allocator = vkData.allocator,
+										   .CheckVkResultFn = VulkanContext::checkVkResult,
+										   .MinAllocationSize = 0,
+										   .CustomShaderVertCreateInfo = {},
+										   .CustomShaderFragCreateInfo = {}};
+	ImGui_ImplVulkan_Init(&init_info);
+
+	// Command buffer, fence and timestamps of the replayed frames.
+	VkCommandPool command_pool = VK_NULL_HANDLE;
+	VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+	VkFence fence = VK_NULL_HANDLE;
+	VkQueryPool query_pool = VK_NULL_HANDLE;
+	{
+		VkCommandPoolCreateInfo pool_info = {};
+		pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		pool_info.queueFamilyIndex = vkData.queueFamily;
+		VkResult err = vkCreateCommandPool(vkData.device, &pool_info, vkData.allocator, &command_pool);
+		VulkanContext::checkVkResult(err);
+		VkCommandBufferAllocateInfo alloc_info = {};
+		alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		alloc_info.commandPool = command_pool;
+		alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		alloc_info.commandBufferCount = 1;
+		err = vkAllocateCommandBuffers(vkData.device, &alloc_info, &command_buffer);
+		VulkanContext::checkVkResult(err);
+		VkFenceCreateInfo fence_info = {};
+		fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		err = vkCreateFence(vkData.device, &fence_info, vkData.allocator, &fence);
+		VulkanContext::checkVkResult(err);
+		VkQueryPoolCreateInfo query_info = {};
+		query_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		query_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		query_info.queryCount = 2;
+		err = vkCreateQueryPool(vkData.device, &query_info, vkData.allocator, &query_pool);
+		VulkanContext::checkVkResult(err);
+	}
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(vkData.physicalDevice, &properties);
+	const double timestampPeriod = static_cast<double>(properties.limits.timestampPeriod);
+	uint32_t family_count = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(vkData.physicalDevice, &family_count, nullptr);
+	std::vector<VkQueueFamilyProperties> families(family_count);
+	vkGetPhysicalDeviceQueueFamilyProperties(vkData.physicalDevice, &family_count, families.data());
+	const bool gpuTiming = timestampPeriod > 0.0 && families[vkData.queueFamily].timestampValidBits > 0;
+	if (!gpuTiming)
+		log_warning("The queue has no timestamps: GPU times are not measured.");
+
+	log_info("Replaying {} frames {} times at {}x{}.", frames.size(), repeat, extent.width, extent.height);
+	std::vector<double> cpuTimes;
+	std::vector<double> gpuTimes;
+	{
+		Textures textures;
+		std::vector<std::unique_ptr<ImDrawList>> lists;
+		ImDrawData draw_data;
+		for (uint32_t pass = 0; pass < repeat; ++pass) {
+			for (size_t index = 0; index < frames.size(); ++index) {
+				const auto& frame = frames[index];
+				// Texture uploads are not part of the measures.
+				if (pass == 0)
+					for (const auto& texture: frame.textures) textures.update(texture);
+				fillDrawData(frame, textures, lists, draw_data);
+
+				VkResult err = vkResetCommandPool(vkData.device, command_pool, 0);
+				VulkanContext::checkVkResult(err);
+				VkCommandBufferBeginInfo begin_info = {};
+				begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+				begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+				err = vkBeginCommandBuffer(command_buffer, &begin_info);
+				VulkanContext::checkVkResult(err);
+				vkCmdResetQueryPool(command_buffer, query_pool, 0, 2);
+				vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, query_pool, 0);
+				VkClearValue clear = {};
+				VkRenderPassBeginInfo info = {};
+				info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+				info.renderPass = target.renderPass;
+				info.framebuffer = target.framebuffer;
+				info.renderArea.extent = target.extent;
+				info.clearValueCount = 1;
+				info.pClearValues = &clear;
+				vkCmdBeginRenderPass(command_buffer, &info, VK_SUBPASS_CONTENTS_INLINE);
+				const auto start = std::chrono::steady_clock::now();
+				ImGui_ImplVulkan_RenderDrawData(&draw_data, command_buffer);
+				const double cpuMs =
+						std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+				vkCmdEndRenderPass(command_buffer);
+				vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query_pool, 1);
+				err = vkEndCommandBuffer(command_buffer);
+				VulkanContext::checkVkResult(err);
+
+				VkSubmitInfo submit_info = {};
+				submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+				submit_info.commandBufferCount = 1;
+				submit_info.pCommandBuffers = &command_buffer;
+				err = vkQueueSubmit(vkData.queue, 1, &submit_info, fence);
+				VulkanContext::checkVkResult(err);
+				err = vkWaitForFences(vkData.device, 1, &fence, VK_TRUE, UINT64_MAX);
+				VulkanContext::checkVkResult(err);
+				err = vkResetFences(vkData.device, 1, &fence);
+				VulkanContext::checkVkResult(err);
+
+				double gpuMs = 0.0;
+				if (gpuTiming) {
+					std::array<uint64_t, 2> timestamps{};
+					err = vkGetQueryPoolResults(vkData.device, query_pool, 0, 2, sizeof(timestamps), timestamps.data(),
+												sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+					VulkanContext::checkVkResult(err);
+					gpuMs = static_cast<double>(timestamps[1] - timestamps[0]) * timestampPeriod * 1e-6;
+					gpuTimes.push_back(gpuMs);
+				}
+				cpuTimes.push_back(cpuMs);
+				if (perFrame)
+					log_info("frame {:5}: {:3} lists, {:7} vertices, {:7} indices, CPU {:8.4f} ms, GPU {:8.4f} ms",
+							 index, draw_data.CmdListsCount, draw_data.TotalVtxCount, draw_data.TotalIdxCount, cpuMs,
+							 gpuMs);
+			}
+		}
+		const VkResult err = vkDeviceWaitIdle(vkData.device);
+		VulkanContext::checkVkResult(err);
+		draw_data.Clear();
+	}
+	report("CPU record", cpuTimes);
+	report("GPU", gpuTimes);
+
+	ImGui_ImplVulkan_Shutdown();
+	ImGui::DestroyContext();
+	vkDestroyQueryPool(vkData.device, query_pool, vkData.allocator);
+	vkDestroyFence(vkData.device, fence, vkData.allocator);
+	vkDestroyCommandPool(vkData.device, command_pool, vkData.allocator);
+	destroyTarget(*context, target);
+	context.reset();
+	mvi::Log::invalidate();
+	return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file packer.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "core/Log.h"
+#include "core/resources/ResourcePack.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+/**
+ * @brief Read the bytes of a resource file.
+ *
+ * `.embed` files (C byte arrays) are converted back to their raw bytes.
+ *
+ * @param[in] iPath The file.
+ * @param[out] oData The bytes.
+ * @return True if the file is read.
+ */
+auto readResource(const std::filesystem::path& iPath, std::vector<uint8_t>& oData) -> bool {
+	std::ifstream file(iPath, std::ios::binary);
+	if (!file)
+		return false;
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	const std::string content = buffer.str();
+	if (iPath.extension() != ".embed") {
+		oData.assign(content.begin(), content.end());
+		return true;
+	}
+	const size_t begin = content.find('{');
+	const size_t end = content.rfind('}');
+	if (begin == std::string::npos || end == std::string::npos || end < begin)
+		return false;
+	oData.clear();
+	for (size_t position = content.find("0x", begin); position < end; position = content.find("0x", position)) {
+		oData.push_back(static_cast<uint8_t>(std::stoul(content.substr(position + 2, 2), nullptr, 16)));
+		position += 2;
+	}
+	return true;
+}
+
+}// namespace
+
+// Usage: packer <output pack> <resource root> <files...>
+auto main(const int iArgc, char** iArgv) -> int {
+	mvi::Log::init(mvi::Log::Level::Info);
+	if (iArgc < 3) {
+		log_error("Usage: {} <output pack> <resource root> <files...>", iArgv[0]);
+		return 1;
+	}
+	const std::filesystem::path output{iArgv[1]};
+	const std::filesystem::path root{iArgv[2]};
+	std::vector<mvi::core::resources::ResourcePack::Input> inputs;
+	for (int index = 3; index < iArgc; ++index) {
+		const std::filesystem::path file{iArgv[index]};
+		auto& input = inputs.emplace_back();
+		// Resources are named by their path relative to the root, without the '.embed' extension.
+		auto name = std::filesystem::relative(file, root);
+		if (name.extension() == ".embed")
+			name.replace_extension();
+		input.name = name.generic_string();
+		if (!readResource(file, input.data)) {
+			log_error("Unable to read resource '{}'.", file.string());
+			return 1;
+		}
+	}
+	log_info("Packing {} resources into '{}'.", inputs.size(), output.string());
+	const int ret = mvi::core::resources::ResourcePack::write(output, inputs) ? 0 : 1;
+	mvi::Log::invalidate();
+	return ret;
+}
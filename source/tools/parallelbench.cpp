@@ -0,0 +1,134 @@
+/**
+ * @file parallelbench.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "core/Log.h"
+#include "core/jobs/JobSystem.h"
+#include "core/parallel/Parallel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#ifdef MVI_ENGINE_USE_TBB
+#include <oneapi/tbb/global_control.h>
+#endif
+
+namespace {
+
+namespace parallel = mvi::core::parallel;
+namespace jobs = mvi::core::jobs;
+
+/**
+ * @brief Measure a function, keeping the median of the runs.
+ * @param[in] iRepeat The number of runs.
+ * @param[in] iSetup The preparation of each run, not measured.
+ * @param[in] iFunction The measured function.
+ * @return The median duration, in milliseconds.
+ */
+auto measure(const uint32_t iRepeat, const std::function<void()>& iSetup, const std::function<void()>& iFunction)
+		-> double {
+	std::vector<double> samples;
+	samples.reserve(iRepeat);
+	for (uint32_t run = 0; run < iRepeat; ++run) {
+		iSetup();
+		const auto start = std::chrono::steady_clock::now();
+		iFunction();
+		samples.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+	std::ranges::sort(samples);
+	return samples[samples.size() / 2];
+}
+
+/**
+ * @brief Durations of the algorithms, in milliseconds.
+ */
+struct Timings {
+	/// parallelFor.
+	double forMs = 0.0;
+	/// parallelReduce.
+	double reduceMs = 0.0;
+	/// parallelSort.
+	double sortMs = 0.0;
+	/// parallelScan.
+	double scanMs = 0.0;
+};
+
+/**
+ * @brief Run the algorithms on the current threads.
+ * @param[in] iInput The input values.
+ * @param[in] iRepeat The number of runs.
+ * @return The durations.
+ */
+auto runAlgorithms(const std::vector<float>& iInput, const uint32_t iRepeat) -> Timings {
+	std::vector<float> data;
+	const auto copy = [&data, &iInput]() -> void { data = iInput; };
+	Timings timings;
+	timings.forMs = measure(iRepeat, copy, [&data]() -> void {
+		parallel::parallelFor(data, [](float& ioValue) -> void { ioValue = std::sqrt(std::abs(ioValue)) * 0.5f; });
+	});
+	double sum = 0.0;
+	timings.reduceMs = measure(iRepeat, copy, [&data, &sum]() -> void {
+		sum = parallel::parallelReduce(data, 0.0, [](const double iA, const double iB) -> double { return iA + iB; });
+	});
+	timings.sortMs = measure(iRepeat, copy, [&data]() -> void { parallel::parallelSort(data); });
+	timings.scanMs = measure(iRepeat, copy,
+							 [&data]() -> void { std::ignore = parallel::parallelScan(data, data.begin(), 0.f); });
+	log_trace("Checksum {}", sum);
+	return timings;
+}
+
+}// namespace
+
+// Usage: parallelbench [elements] [repeat]
+auto main(const int iArgc, char** iArgv) -> int {
+	mvi::Log::init(mvi::Log::Level::Info);
+	size_t elements = 1 << 24;
+	uint32_t repeat = 5;
+	if (iArgc > 1)
+		elements = std::max<size_t>(std::strtoull(iArgv[1], nullptr, 10), 1);
+	if (iArgc > 2)
+		repeat = std::max(static_cast<uint32_t>(std::strtoul(iArgv[2], nullptr, 10)), 1u);
+	std::vector<float> input(elements);
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> distribution(-1000.f, 1000.f);
+	std::ranges::generate(input, [&]() -> float { return distribution(generator); });
+
+	const uint32_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+	log_info("{} elements, median of {} runs, {} backend, 1 to {} threads.", elements, repeat,
+			 jobs::JobSystem::usesTbb() ? "TBB" : "native", cores);
+	Timings reference;
+	for (uint32_t threads = 1; threads <= cores; ++threads) {
+#ifdef MVI_ENGINE_USE_TBB
+		const tbb::global_control control(tbb::global_control::max_allowed_parallelism, threads);
+#else
+		// The calling thread takes its share, along the workers.
+		std::unique_ptr<jobs::JobSystem> jobSystem;
+		if (threads > 1)
+			jobSystem = std::make_unique<jobs::JobSystem>(
+					jobs::JobSystem::Config{.workers = threads - 1, .ioWorkers = 1});
+		parallel::setJobSystem(jobSystem.get());
+#endif
+		const auto timings = runAlgorithms(input, repeat);
+		if (threads == 1)
+			reference = timings;
+		log_info("{:>3} threads: for {:8.3f} ms (x{:5.2f}), reduce {:8.3f} ms (x{:5.2f}), sort {:8.3f} ms (x{:5.2f}), "
+				 "scan {:8.3f} ms (x{:5.2f})",
+				 threads, timings.forMs, reference.forMs / timings.forMs, timings.reduceMs,
+				 reference.reduceMs / timings.reduceMs, timings.sortMs, reference.sortMs / timings.sortMs,
+				 timings.scanMs, reference.scanMs / timings.scanMs);
+#ifndef MVI_ENGINE_USE_TBB
+		parallel::setJobSystem(nullptr);
+#endif
+	}
+	return 0;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file registrybench.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "core/Log.h"
+#include "core/NameId.h"
+#include "core/actions/ActionRegistry.h"
+#include "core/event/KeyEvent.h"
+#include "core/views/ViewRegistry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace core = mvi::core;
+
+/**
+ * @brief Action without shortcut, ignoring all the events.
+ */
+class DummyAction final : public core::actions::Action {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iName The action name.
+	 */
+	explicit DummyAction(std::string iName) : m_name{std::move(iName)} {}
+	/**
+	 * @brief Get the name of the action.
+	 * @return The name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return m_name; }
+
+private:
+	/// The name.
+	std::string m_name;
+	/**
+	 * @brief Nothing to execute.
+	 */
+	void onExecute() override {}
+};
+
+/**
+ * @brief View without content.
+ */
+class DummyView final : public core::views::View {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param[in] iName The view name.
+	 */
+	explicit DummyView(std::string iName) : m_name{std::move(iName)} {}
+	/**
+	 * @brief Nothing to update.
+	 */
+	void onUpdate() override {}
+	/**
+	 * @brief Get the view name.
+	 * @return The name.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return m_name; }
+
+private:
+	/// The name.
+	std::string m_name;
+};
+
+/**
+ * @brief Measure a function, keeping the median of the runs.
+ * @param[in] iRepeat The number of runs.
+ * @param[in] iFunction The measured function.
+ * @return The median duration, in microseconds.
+ */
+auto measure(const uint32_t iRepeat, const std::function<void()>& iFunction) -> double {
+	std::vector<double> samples;
+	samples.reserve(iRepeat);
+	for (uint32_t run = 0; run < iRepeat; ++run) {
+		const auto start = std::chrono::steady_clock::now();
+		iFunction();
+		samples.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+	}
+	std::ranges::sort(samples);
+	return samples[samples.size() / 2];
+}
+
+}// namespace
+
+// Usage: registrybench [actions] [views] [repeat]
+auto main(const int iArgc, char** iArgv) -> int {
+	mvi::Log::init(mvi::Log::Level::Info);
+	size_t actionCount = 10000;
+	size_t viewCount = 1000;
+	uint32_t repeat = 21;
+	if (iArgc > 1)
+		actionCount = std::max<size_t>(std::strtoull(iArgv[1], nullptr, 10), 1);
+	if (iArgc > 2)
+		viewCount = std::max<size_t>(std::strtoull(iArgv[2], nullptr, 10), 1);
+	if (iArgc > 3)
+		repeat = std::max(static_cast<uint32_t>(std::strtoul(iArgv[3], nullptr, 10)), 1u);
+
+	// The former storage: a list searched by name, against the indexed registry.
+	std::list<std::shared_ptr<core::actions::Action>> actionList;
+	core::actions::ActionRegistry actionRegistry;
+	std::vector<std::string> actionNames;
+	std::vector<core::NameId> actionIds;
+	for (size_t index = 0; index < actionCount; ++index) {
+		auto action = std::make_shared<DummyAction>(std::format("bench_action_{}", index));
+		actionNames.push_back(action->getName());
+		actionList.push_back(action);
+		actionIds.push_back(actionRegistry.add(std::move(action)));
+	}
+	core::views::ViewRegistry viewRegistry;
+	std::vector<std::string> viewNames;
+	std::vector<core::NameId> viewIds;
+	for (size_t index = 0; index < viewCount; ++index) {
+		auto name = std::format("bench_view_{}", index);
+		viewIds.push_back(viewRegistry.registerView(
+				name, [name]() -> std::shared_ptr<core::views::View> { return std::make_shared<DummyView>(name); },
+				{.label = {}, .shown = true, .keepAlive = true}));
+		viewNames.push_back(std::move(name));
+	}
+	viewRegistry.update(core::views::ViewRegistry::clock::now());
+
+	// Random lookup order, so the list walk is not always short.
+	std::vector<size_t> order(actionCount);
+	for (size_t index = 0; index < actionCount; ++index)
+		order[index] = index;
+	std::ranges::shuffle(order, std::mt19937(42));
+	size_t found = 0;
+	const auto listLookup = [&]() -> void {
+		for (const size_t index: order) {
+			const auto action = std::ranges::find_if(
+					actionList, [&](const auto& iAction) -> bool { return iAction->getName() == actionNames[index]; });
+			found += action != actionList.end() ? 1 : 0;
+		}
+	};
+	const auto nameLookup = [&]() -> void {
+		for (const size_t index: order)
+			found += actionRegistry.get(actionNames[index]) != nullptr ? 1 : 0;
+	};
+	const auto idLookup = [&]() -> void {
+		for (const size_t index: order)
+			found += actionRegistry.get(actionIds[index]) != nullptr ? 1 : 0;
+	};
+	// The list lookup is quadratic over the whole order, measure it once.
+	log_info("{} actions, {} views, median of {} runs.", actionCount, viewCount, repeat);
+	log_info("Action lookup, per call: list by name {:9.4f} us, registry by name {:9.4f} us, registry by id {:9.4f} us",
+			 measure(1, listLookup) / static_cast<double>(actionCount),
+			 measure(repeat, nameLookup) / static_cast<double>(actionCount),
+			 measure(repeat, idLookup) / static_cast<double>(actionCount));
+
+	core::event::KeyReleasedEvent event(core::KeyCode::A);
+	const auto listDispatch = [&]() -> void {
+		event.handled = false;
+		for (const auto& action: actionList) {
+			if (event.handled)
+				return;
+			action->onEvent(event);
+		}
+	};
+	const auto registryDispatch = [&]() -> void {
+		event.handled = false;
+		actionRegistry.onEvent(event);
+	};
+	log_info("Action event dispatch: list {:9.3f} us, registry {:9.3f} us", measure(repeat, listDispatch),
+			 measure(repeat, registryDispatch));
+
+	const auto viewNameLookup = [&]() -> void {
+		for (const auto& name: viewNames)
+			found += viewRegistry.get(name) != nullptr ? 1 : 0;
+	};
+	const auto viewIdLookup = [&]() -> void {
+		for (const auto& id: viewIds)
+			found += viewRegistry.get(id) != nullptr ? 1 : 0;
+	};
+	const auto viewBroadcast = [&]() -> void {
+		event.handled = false;
+		for (const auto& view: viewRegistry.getViews()) {
+			if (event.handled)
+				return;
+			view->onEvent(event);
+		}
+	};
+	log_info("View lookup, per call: by name {:9.4f} us, by id {:9.4f} us; event broadcast {:9.3f} us",
+			 measure(repeat, viewNameLookup) / static_cast<double>(viewCount),
+			 measure(repeat, viewIdLookup) / static_cast<double>(viewCount), measure(repeat, viewBroadcast));
+	log_trace("Found {}", found);
+	return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file FrameScheduler_test.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "core/FrameScheduler.h"
+
+#include <gtest/gtest.h>
+
+using namespace mvi::core;
+
+namespace {
+
+/**
+ * @brief Run the ticks of a frame.
+ * @param[in,out] ioScheduler The scheduler.
+ * @param[in] iSeconds The frame duration.
+ * @return The number of ticks run.
+ */
+auto runFrame(FrameScheduler& ioScheduler, const double iSeconds) -> uint32_t {
+	ioScheduler.beginFrame(iSeconds);
+	uint32_t steps = 0;
+	while (ioScheduler.step()) ++steps;
+	return steps;
+}
+
+}// namespace
+
+TEST(FrameScheduler, Config) {
+	FrameScheduler scheduler;
+	scheduler.setConfig({.tickRate = 100.0, .maxSteps = 4});
+	EXPECT_NEAR(scheduler.getStepSeconds(), 0.01, 1e-12);
+	// Out of range values are clamped.
+	scheduler.setConfig({.tickRate = 0.0, .maxSteps = 0});
+	EXPECT_NEAR(scheduler.getStepSeconds(), 1.0, 1e-12);
+	EXPECT_EQ(scheduler.getConfig().maxSteps, 1u);
+	scheduler.setConfig({.tickRate = 1e9, .maxSteps = 2});
+	EXPECT_NEAR(scheduler.getConfig().tickRate, 10000.0, 1e-9);
+}
+
+TEST(FrameScheduler, StepCounts) {
+	FrameScheduler scheduler;
+	scheduler.setConfig({.tickRate = 100.0, .maxSteps = 8});
+	// Frames shorter than a tick accumulate.
+	EXPECT_EQ(runFrame(scheduler, 0.004), 0u);
+	EXPECT_EQ(runFrame(scheduler, 0.004), 0u);
+	EXPECT_EQ(runFrame(scheduler, 0.004), 1u);
+	EXPECT_NEAR(scheduler.getAlpha(), 0.2, 1e-9);
+	// Longer frames run several ticks.
+	EXPECT_EQ(runFrame(scheduler, 0.035), 3u);
+	EXPECT_NEAR(scheduler.getAlpha(), 0.7, 1e-9);
+	EXPECT_EQ(scheduler.getTick(), 4u);
+	EXPECT_EQ(scheduler.getStats().steps, 3u);
+	EXPECT_EQ(scheduler.getStats().dropped, 0u);
+	EXPECT_NEAR(scheduler.getStats().frameMs, 35.0, 1e-9);
+}
+
+TEST(FrameScheduler, Clamp) {
+	FrameScheduler scheduler;
+	scheduler.setConfig({.tickRate = 100.0, .maxSteps = 4});
+	// A 1 s stall runs the maximum steps and drops the rest.
+	EXPECT_EQ(runFrame(scheduler, 1.0), 4u);
+	EXPECT_EQ(scheduler.getStats().dropped, 96u);
+	EXPECT_GE(scheduler.getAlpha(), 0.0);
+	EXPECT_LT(scheduler.getAlpha(), 1.0);
+	// The next frame does not catch up the dropped time.
+	EXPECT_EQ(runFrame(scheduler, 0.01), 1u);
+	EXPECT_EQ(scheduler.getTick(), 5u);
+}
+
+TEST(FrameScheduler, Reset) {
+	FrameScheduler scheduler;
+	scheduler.setConfig({.tickRate = 100.0, .maxSteps = 8});
+	scheduler.beginFrame(0.009);
+	scheduler.reset();
+	EXPECT_NEAR(scheduler.getAlpha(), 0.0, 1e-12);
+	EXPECT_EQ(runFrame(scheduler, 0.009), 0u);
+}
@@ -0,0 +1,99 @@
+/**
+ * @file JobSystem_test.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "core/jobs/JobSystem.h"
+
+#include <gtest/gtest.h>
+
+using namespace mvi::core::jobs;
+
+TEST(JobSystem, Dependencies) {
+	JobSystem jobs({.workers = 4, .ioWorkers = 1});
+	std::mutex mutex;
+	std::vector<int> order;
+	const auto record = [&](const int iValue) -> std::function<void()> {
+		return [&, iValue]() -> void {
+			const std::scoped_lock lock(mutex);
+			order.push_back(iValue);
+		};
+	};
+	const auto first = jobs.submit(record(1));
+	const auto second = jobs.submit(record(2), Priority::Critical, std::array{first});
+	const auto third = jobs.submit(record(3), Priority::Io, std::array{second});
+	const auto last = jobs.submit(record(4), Priority::Background, std::array{first, third});
+	jobs.waitFor(last);
+	EXPECT_TRUE(JobSystem::isDone(first));
+	EXPECT_TRUE(JobSystem::isDone(third));
+	EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST(JobSystem, WaitForMany) {
+	JobSystem jobs({.workers = 3, .ioWorkers = 1});
+	std::atomic<int> sum = 0;
+	std::vector<JobHandle> parts;
+	for (int i = 1; i <= 1000; ++i)
+		parts.push_back(jobs.submit([&sum, i]() -> void { sum.fetch_add(i, std::memory_order_relaxed); }));
+	const auto total = jobs.submit([]() -> void {}, Priority::Critical, parts);
+	jobs.waitFor(total);
+	EXPECT_EQ(sum.load(), 500500);
+	EXPECT_TRUE(JobSystem::isDone(nullptr));
+	jobs.waitFor(nullptr);
+}
+
+TEST(JobSystem, NestedWait) {
+	// Every worker waits on jobs submitted from a job.
+	JobSystem jobs({.workers = 2, .ioWorkers = 1});
+	std::atomic<int> count = 0;
+	std::vector<JobHandle> outer;
+	for (int i = 0; i < 8; ++i) {
+		outer.push_back(jobs.submit(
+				[&jobs, &count]() -> void {
+					std::vector<JobHandle> inner;
+					for (int j = 0; j < 8; ++j)
+						inner.push_back(jobs.submit([&count]() -> void { count.fetch_add(1); }, Priority::Critical));
+					for (const auto& job: inner) jobs.waitFor(job);
+				},
+				Priority::Critical));
+	}
+	for (const auto& job: outer) jobs.waitFor(job);
+	EXPECT_EQ(count.load(), 64);
+}
+
+TEST(JobSystem, WaitSkipsLowerPriorities) {
+	// TBB runs the jobs on its own threads, whatever the waiting thread does.
+	if (JobSystem::usesTbb())
+		GTEST_SKIP();
+	// The only worker is held, so the waiting thread is alone to run the jobs.
+	JobSystem jobs({.workers = 1, .ioWorkers = 1});
+	std::atomic<bool> started = false;
+	std::atomic<bool> release = false;
+	const auto blocker = jobs.submit([&started, &release]() -> void {
+		started = true;
+		while (!release.load()) std::this_thread::yield();
+	});
+	while (!started.load()) std::this_thread::yield();
+	std::atomic<bool> backgroundRun = false;
+	const auto background = jobs.submit([&backgroundRun]() -> void { backgroundRun = true; });
+	const auto critical = jobs.submit([]() -> void {}, Priority::Critical);
+	jobs.waitFor(critical);
+	EXPECT_FALSE(backgroundRun.load());
+	release = true;
+	jobs.waitFor(background);
+	EXPECT_TRUE(backgroundRun.load());
+	jobs.waitFor(blocker);
+}
+
+TEST(JobSystem, Exceptions) {
+	JobSystem jobs({.workers = 2, .ioWorkers = 1});
+	std::atomic<bool> run = false;
+	const auto failed = jobs.submit([]() -> void { throw std::runtime_error("failure"); });
+	const auto unknown = jobs.submit([]() -> void { throw 42; }, Priority::Critical);
+	const auto after = jobs.submit([&run]() -> void { run = true; }, Priority::Background, std::array{failed, unknown});
+	jobs.waitFor(after);
+	EXPECT_TRUE(run.load());
+}
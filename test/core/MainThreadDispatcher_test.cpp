@@ -0,0 +1,90 @@
+/**
+ * @file MainThreadDispatcher_test.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "core/MainThreadDispatcher.h"
+#include "core/event/AppEvent.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace mvi::core;
+
+namespace {
+
+/// Event receiver ignoring everything.
+void ignore(event::Event&) {}
+
+}// namespace
+
+TEST(MainThreadDispatcher, Order) {
+	MainThreadDispatcher dispatcher;
+	std::vector<int> order;
+	for (int i = 0; i < 100; ++i) dispatcher.post([&order, i]() -> void { order.push_back(i); });
+	EXPECT_TRUE(dispatcher.hasPending());
+	EXPECT_EQ(dispatcher.dispatch(ignore), 100u);
+	EXPECT_FALSE(dispatcher.hasPending());
+	ASSERT_EQ(order.size(), 100u);
+	for (int i = 0; i < 100; ++i) EXPECT_EQ(order[static_cast<size_t>(i)], i);
+}
+
+TEST(MainThreadDispatcher, Events) {
+	MainThreadDispatcher dispatcher;
+	uint32_t wakes = 0;
+	dispatcher.setWakeFunction([&wakes]() -> void { ++wakes; });
+	dispatcher.post(std::make_unique<event::AppTickEvent>(0.01, 7));
+	dispatcher.post([]() -> void {});
+	uint64_t ticks = 0;
+	const auto dispatched = dispatcher.dispatch([&ticks](event::Event& ioEvent) -> void {
+		if (const auto* tick = dynamic_cast<event::AppTickEvent*>(&ioEvent); tick != nullptr)
+			ticks += tick->getTick();
+	});
+	EXPECT_EQ(dispatched, 2u);
+	EXPECT_EQ(ticks, 7u);
+	EXPECT_EQ(wakes, 2u);
+	EXPECT_EQ(dispatcher.getStats().posted, 2u);
+	EXPECT_EQ(dispatcher.getStats().dispatched, 2u);
+}
+
+TEST(MainThreadDispatcher, PostDuringDispatch) {
+	MainThreadDispatcher dispatcher;
+	int runs = 0;
+	dispatcher.post([&dispatcher, &runs]() -> void {
+		++runs;
+		dispatcher.post([&runs]() -> void { ++runs; });
+	});
+	EXPECT_EQ(dispatcher.dispatch(ignore), 1u);
+	EXPECT_EQ(runs, 1);
+	EXPECT_EQ(dispatcher.dispatch(ignore), 1u);
+	EXPECT_EQ(runs, 2);
+}
+
+TEST(MainThreadDispatcher, Threads) {
+	// Each producer posts in order, the main thread must see the posts of a producer in the same order.
+	constexpr size_t producers = 4;
+	constexpr size_t posts = 20000;
+	MainThreadDispatcher dispatcher;
+	std::vector<std::vector<size_t>> received(producers);
+	std::vector<std::thread> threads;
+	threads.reserve(producers);
+	for (size_t producer = 0; producer < producers; ++producer) {
+		threads.emplace_back([&dispatcher, &received, producer]() -> void {
+			for (size_t i = 0; i < posts; ++i)
+				dispatcher.post([&received, producer, i]() -> void { received[producer].push_back(i); });
+		});
+	}
+	uint64_t dispatched = 0;
+	while (dispatched < producers * posts) dispatched += dispatcher.dispatch(ignore);
+	for (auto& thread: threads) thread.join();
+	EXPECT_EQ(dispatched, producers * posts);
+	EXPECT_FALSE(dispatcher.hasPending());
+	for (const auto& values: received) {
+		ASSERT_EQ(values.size(), posts);
+		for (size_t i = 0; i < posts; ++i) ASSERT_EQ(values[i], i);
+	}
+}
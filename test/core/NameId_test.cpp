@@ -0,0 +1,73 @@
+/**
+ * @file NameId_test.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "core/NameId.h"
+
+#include <gtest/gtest.h>
+
+#include <format>
+#include <thread>
+
+using namespace mvi::core;
+
+TEST(NameId, Intern) {
+	const NameId first("test_name_first");
+	const NameId second("test_name_second");
+	EXPECT_TRUE(first.isValid());
+	EXPECT_NE(first, second);
+	EXPECT_EQ(NameId("test_name_first"), first);
+	EXPECT_EQ(first.getName(), "test_name_first");
+	EXPECT_EQ(second.getName(), "test_name_second");
+	// Dense identifiers, in interning order.
+	EXPECT_EQ(second.getValue(), first.getValue() + 1);
+}
+
+TEST(NameId, Find) {
+	EXPECT_FALSE(NameId::find("test_name_never_interned").isValid());
+	const NameId id("test_name_found");
+	EXPECT_EQ(NameId::find("test_name_found"), id);
+	const NameId invalid;
+	EXPECT_FALSE(invalid.isValid());
+	EXPECT_TRUE(invalid.getName().empty());
+}
+
+TEST(NameId, Threads) {
+	// All the threads intern the same names, each must get the same identifiers.
+	constexpr size_t threadCount = 4;
+	constexpr size_t names = 1000;
+	std::vector<std::vector<NameId>> ids(threadCount);
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount);
+	for (size_t thread = 0; thread < threadCount; ++thread) {
+		threads.emplace_back([&ids, thread]() -> void {
+			for (size_t i = 0; i < names; ++i) ids[thread].emplace_back(std::format("test_name_thread_{}", i));
+		});
+	}
+	for (auto& thread: threads) thread.join();
+	for (size_t thread = 1; thread < threadCount; ++thread) EXPECT_EQ(ids[thread], ids.front());
+	for (size_t i = 0; i < names; ++i) EXPECT_EQ(ids.front()[i].getName(), std::format("test_name_thread_{}", i));
+}
+
+TEST(SlotIndex, InsertFind) {
+	SlotIndex index;
+	const NameId first("test_slot_first");
+	const NameId second("test_slot_second");
+	EXPECT_EQ(index.find(first), SlotIndex::g_noSlot);
+	index.insert(second, 3);
+	EXPECT_EQ(index.find(second), 3u);
+	EXPECT_EQ(index.find(first), SlotIndex::g_noSlot);
+	index.insert(first, 5);
+	index.insert(second, 4);
+	EXPECT_EQ(index.find(first), 5u);
+	EXPECT_EQ(index.find(second), 4u);
+	index.insert(NameId{}, 1);
+	EXPECT_EQ(index.find(NameId{}), SlotIndex::g_noSlot);
+	index.clear();
+	EXPECT_EQ(index.find(first), SlotIndex::g_noSlot);
+	EXPECT_EQ(index.find(second), SlotIndex::g_noSlot);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file Parallel_test.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "core/jobs/JobSystem.h"
+#include "core/parallel/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <random>
+
+using namespace mvi::core;
+
+namespace {
+
+/**
+ * @brief Generate random values.
+ * @param[in] iSize The number of values.
+ * @param[in] iSeed The generator seed.
+ * @return The values.
+ */
+auto makeValues(const size_t iSize, const uint32_t iSeed) -> std::vector<int64_t> {
+	std::vector<int64_t> values(iSize);
+	std::mt19937 generator(iSeed);
+	std::uniform_int_distribution<int64_t> distribution(-1000, 1000);
+	for (auto& value: values) value = distribution(generator);
+	return values;
+}
+
+/**
+ * @brief Run the algorithms on a job system, then without one.
+ */
+class Parallel : public testing::TestWithParam<bool> {
+protected:
+	/**
+	 * @brief Start the job system if requested.
+	 */
+	void SetUp() override {
+		if (GetParam())
+			m_jobs = std::make_unique<jobs::JobSystem>(jobs::JobSystem::Config{.workers = 3, .ioWorkers = 1});
+		parallel::setJobSystem(m_jobs.get());
+	}
+	/**
+	 * @brief Stop the job system.
+	 */
+	void TearDown() override {
+		parallel::setJobSystem(nullptr);
+		m_jobs.reset();
+	}
+
+private:
+	/// The job system.
+	std::unique_ptr<jobs::JobSystem> m_jobs;
+};
+
+}// namespace
+
+TEST_P(Parallel, For) {
+	for (const size_t grain: {size_t{0}, size_t{1}, size_t{7}, size_t{100000}}) {
+		std::vector<uint32_t> hits(10007, 0);
+		std::atomic<bool> oversized = false;
+		parallel::parallelFor(
+				size_t{3}, hits.size(),
+				[&hits, &oversized, grain](const size_t iBegin, const size_t iEnd) -> void {
+					if (grain != 0 && iEnd - iBegin > grain)
+						oversized = true;
+					for (size_t i = iBegin; i < iEnd; ++i) ++hits[i];
+				},
+				grain);
+		EXPECT_FALSE(oversized.load()) << grain;
+		EXPECT_EQ(std::ranges::count(hits, 0u), 3) << grain;
+		EXPECT_EQ(std::ranges::count(hits, 1u), static_cast<std::ptrdiff_t>(hits.size() - 3)) << grain;
+	}
+	std::vector<int> values(1000, 1);
+	parallel::parallelFor(values, [](int& ioValue) -> void { ioValue *= 3; });
+	EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 3000);
+	bool called = false;
+	parallel::parallelFor(size_t{5}, size_t{5}, [&called](size_t, size_t) -> void { called = true; });
+	EXPECT_FALSE(called);
+}
+
+TEST_P(Parallel, Reduce) {
+	const auto values = makeValues(100003, 1);
+	const int64_t expected = std::accumulate(values.begin(), values.end(), int64_t{0});
+	for (const size_t grain: {size_t{0}, size_t{1}, size_t{999}})
+		EXPECT_EQ(parallel::parallelReduce(values, int64_t{0}, std::plus<>{}, grain), expected) << grain;
+	const int64_t maximum = parallel::parallelReduce(
+			values, std::numeric_limits<int64_t>::min(),
+			[](const int64_t iA, const int64_t iB) -> int64_t { return std::max(iA, iB); });
+	EXPECT_EQ(maximum, std::ranges::max(values));
+	EXPECT_EQ(parallel::parallelReduce(std::vector<int64_t>{}, int64_t{17}), 17);
+}
+
+TEST_P(Parallel, Sort) {
+	for (const size_t size: {size_t{0}, size_t{1}, size_t{1000}, size_t{100001}}) {
+		auto values = makeValues(size, 2);
+		auto expected = values;
+		std::ranges::sort(expected);
+		parallel::parallelSort(values);
+		EXPECT_EQ(values, expected) << size;
+	}
+	auto values = makeValues(50000, 3);
+	auto expected = values;
+	std::ranges::sort(expected, std::ranges::greater{});
+	parallel::parallelSort(values, std::ranges::greater{}, 1000);
+	EXPECT_EQ(values, expected);
+}
+
+TEST_P(Parallel, Scan) {
+	for (const size_t size: {size_t{1}, size_t{1000}, size_t{100003}}) {
+		const auto values = makeValues(size, 4);
+		std::vector<int64_t> expected(size);
+		std::inclusive_scan(values.begin(), values.end(), expected.begin(), std::plus<>{}, int64_t{10});
+		for (const size_t grain: {size_t{0}, size_t{1}, size_t{333}}) {
+			std::vector<int64_t> scanned(size);
+			EXPECT_EQ(parallel::parallelScan(values, scanned.begin(), int64_t{10}, std::plus<>{}, grain), expected.back());
+			EXPECT_EQ(scanned, expected) << size << " " << grain;
+		}
+	}
+	// In place.
+	auto values = makeValues(20000, 5);
+	std::vector<int64_t> expected(values.size());
+	std::inclusive_scan(values.begin(), values.end(), expected.begin());
+	parallel::parallelScan(values, values.begin(), int64_t{0});
+	EXPECT_EQ(values, expected);
+	std::vector<int64_t> none;
+	EXPECT_EQ(parallel::parallelScan(none, none.begin(), int64_t{3}), 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(JobSystem, Parallel, testing::Bool());
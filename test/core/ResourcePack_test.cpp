@@ -0,0 +1,135 @@
+/**
+ * @file ResourcePack_test.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "core/resources/Compression.h"
+#include "core/resources/ResourcePack.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+using namespace mvi::core::resources;
+
+namespace {
+
+/**
+ * @brief Generate bytes from a small alphabet, compressible.
+ * @param[in] iSize The number of bytes.
+ * @return The bytes.
+ */
+auto makeText(const size_t iSize) -> std::vector<uint8_t> {
+	std::vector<uint8_t> data(iSize);
+	std::mt19937 generator(7);
+	std::uniform_int_distribution<int> distribution('a', 'h');
+	for (auto& byte: data) byte = static_cast<uint8_t>(distribution(generator));
+	return data;
+}
+
+/**
+ * @brief Generate random bytes, not compressible.
+ * @param[in] iSize The number of bytes.
+ * @return The bytes.
+ */
+auto makeNoise(const size_t iSize) -> std::vector<uint8_t> {
+	std::vector<uint8_t> data(iSize);
+	std::mt19937 generator(13);
+	std::uniform_int_distribution<int> distribution(0, 255);
+	for (auto& byte: data) byte = static_cast<uint8_t>(distribution(generator));
+	return data;
+}
+
+/**
+ * @brief Get a temporary pack file, removed by the caller.
+ * @param[in] iName The file name.
+ * @return The path.
+ */
+auto tempPack(const std::string& iName) -> std::filesystem::path {
+	return std::filesystem::temp_directory_path() / iName;
+}
+
+}// namespace
+
+TEST(Compression, RoundTrip) {
+	for (const auto& input: {std::vector<uint8_t>{}, makeText(1), makeText(100000), makeNoise(70000)}) {
+		const auto compressed = compress(input);
+		std::vector<uint8_t> output(input.size());
+		EXPECT_TRUE(decompress(compressed, output));
+		EXPECT_EQ(output, input);
+	}
+}
+
+TEST(Compression, Ratio) {
+	const std::vector<uint8_t> input(1 << 20, 0x42);
+	EXPECT_LT(compress(input).size(), input.size() / 100);
+}
+
+TEST(Compression, BadSize) {
+	const auto input = makeText(4096);
+	const auto compressed = compress(input);
+	std::vector<uint8_t> tooSmall(input.size() - 1);
+	EXPECT_FALSE(decompress(compressed, tooSmall));
+	std::vector<uint8_t> tooLarge(input.size() + 1);
+	EXPECT_FALSE(decompress(compressed, tooLarge));
+}
+
+TEST(ResourcePack, RoundTrip) {
+	const auto path = tempPack("mvi_test_roundtrip.mvipack");
+	const std::vector<ResourcePack::Input> inputs{
+			{.name = "fonts/text", .data = makeText(50000)},
+			{.name = "fonts/noise", .data = makeNoise(3000)},
+			{.name = "empty", .data = {}},
+	};
+	ASSERT_TRUE(ResourcePack::write(path, inputs));
+	{
+		ResourcePack pack(path);
+		ASSERT_TRUE(pack.isOpen());
+		EXPECT_EQ(pack.getNames().size(), inputs.size());
+		for (const auto& input: inputs) {
+			EXPECT_TRUE(pack.contains(input.name));
+			const auto data = pack.get(input.name);
+			EXPECT_TRUE(std::ranges::equal(data, input.data)) << input.name;
+		}
+		EXPECT_FALSE(pack.contains("missing"));
+		EXPECT_TRUE(pack.get("missing").empty());
+		// The text is compressed, so expanded once and kept.
+		const auto first = pack.get("fonts/text");
+		EXPECT_EQ(pack.get("fonts/text").data(), first.data());
+		EXPECT_EQ(pack.getStats().entries, inputs.size());
+		EXPECT_GE(pack.getStats().expanded, 1u);
+		EXPECT_LT(pack.getStats().packBytes, uint64_t{50000});
+	}
+	std::filesystem::remove(path);
+}
+
+TEST(ResourcePack, Stored) {
+	const auto path = tempPack("mvi_test_stored.mvipack");
+	const std::vector<ResourcePack::Input> inputs{{.name = "text", .data = makeText(10000)}};
+	ASSERT_TRUE(ResourcePack::write(path, inputs, false));
+	{
+		ResourcePack pack(path);
+		ASSERT_TRUE(pack.isOpen());
+		EXPECT_TRUE(std::ranges::equal(pack.get("text"), inputs.front().data));
+		EXPECT_EQ(pack.getStats().expanded, 0u);
+	}
+	std::filesystem::remove(path);
+}
+
+TEST(ResourcePack, Invalid) {
+	const auto path = tempPack("mvi_test_invalid.mvipack");
+	{
+		std::ofstream file(path, std::ios::binary);
+		file << "not a resource pack, not at all";
+	}
+	ResourcePack pack;
+	EXPECT_FALSE(pack.open(path));
+	EXPECT_FALSE(pack.isOpen());
+	EXPECT_FALSE(pack.open(tempPack("mvi_test_does_not_exist.mvipack")));
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,229 @@
+/**
+ * @file Task_test.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include "core/coro/Task.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace mvi::core::coro;
+
+namespace {
+
+/**
+ * @brief Suspension point resumed by the test.
+ */
+struct Gate {
+	/// The suspended coroutine.
+	PromiseBase* waiting = nullptr;
+
+	/**
+	 * @brief Awaiter keeping the suspended coroutine in the gate.
+	 */
+	struct Awaiter {
+		/// The gate.
+		Gate& gate;
+		/**
+		 * @brief Always suspend.
+		 * @return False.
+		 */
+		[[nodiscard]] auto await_ready() const -> bool { return false; }
+		/**
+		 * @brief Keep the coroutine.
+		 * @tparam P The promise type.
+		 * @param[in] iHandle The coroutine.
+		 */
+		template<typename P>
+		void await_suspend(std::coroutine_handle<P> iHandle) const {
+			gate.waiting = &iHandle.promise();
+		}
+		/**
+		 * @brief Nothing to return.
+		 */
+		void await_resume() const {}
+	};
+
+	/**
+	 * @brief Await the gate.
+	 * @return The awaiter.
+	 */
+	auto operator co_await() -> Awaiter { return {*this}; }
+	/**
+	 * @brief Resume the suspended coroutine.
+	 */
+	void open() { std::exchange(waiting, nullptr)->resume(); }
+};
+
+/**
+ * @brief Count its destructions, to check the coroutine frame release.
+ */
+struct Guard {
+	/// The destruction counter.
+	int& destroyed;
+	/**
+	 * @brief Destructor.
+	 */
+	~Guard() { ++destroyed; }
+};
+
+/**
+ * @brief Coroutine ending at once.
+ * @param[in] iValue The result.
+ * @return The task.
+ */
+auto immediate(const int iValue) -> Task<int> { co_return iValue; }
+
+/**
+ * @brief Coroutine suspended on a gate.
+ * @param[in,out] ioGate The gate.
+ * @param[in,out] ioDestroyed Counter of the frame destructions.
+ * @param[out] oFinished Set once resumed.
+ * @return The task.
+ */
+auto gated(Gate& ioGate, int& ioDestroyed, bool& oFinished) -> Task<int> {
+	const Guard guard{ioDestroyed};
+	co_await ioGate;
+	oFinished = true;
+	co_return 7;
+}
+
+/**
+ * @brief Coroutine awaiting another one.
+ * @param[in,out] ioGate The gate of the awaited one.
+ * @param[in,out] ioDestroyed Counter of the frame destructions.
+ * @param[out] oFinished Set once the awaited one is resumed.
+ * @return The task.
+ */
+auto outer(Gate& ioGate, int& ioDestroyed, bool& oFinished) -> Task<int> {
+	const int value = co_await gated(ioGate, ioDestroyed, oFinished);
+	co_return value * 6;
+}
+
+/**
+ * @brief Coroutine throwing once resumed.
+ * @param[in,out] ioGate The gate.
+ * @return The task.
+ */
+auto failing(Gate& ioGate) -> Task<> {
+	co_await ioGate;
+	throw std::runtime_error("failure");
+}
+
+/**
+ * @brief Coroutine catching the exception of the awaited one.
+ * @param[in,out] ioGate The gate of the awaited one.
+ * @param[out] oCaught Set if the exception is caught.
+ * @return The task.
+ */
+auto catching(Gate& ioGate, bool& oCaught) -> Task<> {
+	try {
+		co_await failing(ioGate);
+	} catch (const std::runtime_error&) { oCaught = true; }
+}
+
+}// namespace
+
+TEST(Task, Immediate) {
+	auto task = immediate(42);
+	EXPECT_TRUE(task.isValid());
+	EXPECT_TRUE(task.isDone());
+	EXPECT_EQ(task.getResult(), 42);
+	task.reset();
+	EXPECT_FALSE(task.isValid());
+}
+
+TEST(Task, Resume) {
+	Gate gate;
+	int destroyed = 0;
+	bool finished = false;
+	auto task = gated(gate, destroyed, finished);
+	EXPECT_FALSE(task.isDone());
+	ASSERT_NE(gate.waiting, nullptr);
+	gate.open();
+	EXPECT_TRUE(finished);
+	EXPECT_TRUE(task.isDone());
+	EXPECT_EQ(task.getResult(), 7);
+	EXPECT_EQ(destroyed, 1);
+}
+
+TEST(Task, AbandonSuspended) {
+	Gate gate;
+	int destroyed = 0;
+	bool finished = false;
+	{
+		auto task = gated(gate, destroyed, finished);
+		ASSERT_NE(gate.waiting, nullptr);
+	}
+	// The frame is kept until the resumption, which destroys it instead of running the rest.
+	EXPECT_EQ(destroyed, 0);
+	EXPECT_TRUE(gate.waiting->isAbandoned());
+	gate.open();
+	EXPECT_FALSE(finished);
+	EXPECT_EQ(destroyed, 1);
+}
+
+TEST(Task, AbandonDone) {
+	Gate gate;
+	int destroyed = 0;
+	bool finished = false;
+	auto task = gated(gate, destroyed, finished);
+	gate.open();
+	EXPECT_TRUE(task.isDone());
+	task = Task<int>{};
+	EXPECT_TRUE(finished);
+	EXPECT_EQ(destroyed, 1);
+	EXPECT_FALSE(task.isValid());
+}
+
+TEST(Task, Detach) {
+	// A scheduler destroyed before the task: the suspended coroutine goes with the task.
+	Gate gate;
+	int destroyed = 0;
+	bool finished = false;
+	auto task = gated(gate, destroyed, finished);
+	std::exchange(gate.waiting, nullptr)->detach();
+	EXPECT_EQ(destroyed, 0);
+	task.reset();
+	EXPECT_EQ(destroyed, 1);
+	EXPECT_FALSE(finished);
+
+	// Already abandoned: destroyed at once.
+	{ const auto abandoned = gated(gate, destroyed, finished); }
+	EXPECT_EQ(destroyed, 1);
+	std::exchange(gate.waiting, nullptr)->detach();
+	EXPECT_EQ(destroyed, 2);
+	EXPECT_FALSE(finished);
+}
+
+TEST(Task, Await) {
+	Gate gate;
+	int destroyed = 0;
+	bool finished = false;
+	auto task = outer(gate, destroyed, finished);
+	EXPECT_FALSE(task.isDone());
+	gate.open();
+	// The inner task ends and resumes the outer one in the same thread.
+	EXPECT_TRUE(task.isDone());
+	EXPECT_EQ(task.getResult(), 42);
+	EXPECT_EQ(destroyed, 1);
+}
+
+TEST(Task, Exception) {
+	Gate gate;
+	bool caught = false;
+	auto task = catching(gate, caught);
+	gate.open();
+	EXPECT_TRUE(task.isDone());
+	EXPECT_TRUE(caught);
+
+	auto direct = failing(gate);
+	gate.open();
+	EXPECT_TRUE(direct.isDone());
+	EXPECT_THROW(direct.getResult(), std::runtime_error);
+}
@@ -0,0 +1,14 @@
+/**
+ * @file main.cpp
+ * @author Silmaen
+ * @date 18/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#include <gtest/gtest.h>
+
+auto main(int iArgc, char** iArgv) -> int {
+	testing::InitGoogleTest(&iArgc, iArgv);
+	return RUN_ALL_TESTS();
+}